@@ -31,17 +31,26 @@
 /////////////////////////////////////////////////////////////////////////////////
 
 
+#include <array>
+#include <atomic>
 #include <cstdio>
+#include <cstdint>
+#include <cstdlib>
 #include <shared_mutex>
 #include <mutex>
 #include <unordered_map>
 #include <utility>
+#include <vector>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
 #ifndef __CUDA_CC__
 #include <driver_types.h>
 #include <cuda_runtime_api.h>
 #endif
 
 #include "matx/core/error.h"
+#include "matx/core/numa.h"
 #include "matx/core/nvtx.h"
 #include <cuda/std/functional>
 
@@ -64,11 +73,15 @@ enum matxMemorySpace_t {
 
 namespace detail {
 struct matxMemoryStats_t {
-  size_t currentBytesAllocated;
-  size_t totalBytesAllocated;
-  size_t maxBytesAllocated;
+  std::atomic<size_t> currentBytesAllocated;
+  std::atomic<size_t> totalBytesAllocated;
+  std::atomic<size_t> maxBytesAllocated;
+  std::atomic<size_t> hostCachedBytes;   ///< Free bytes held by the host memory cache
+  std::atomic<size_t> hostCacheHits;     ///< Host allocations served from the cache
+  std::atomic<size_t> hostCacheMisses;   ///< Host allocations that went to the system allocator
   matxMemoryStats_t()
-      : currentBytesAllocated(0), totalBytesAllocated(0), maxBytesAllocated(0)
+      : currentBytesAllocated(0), totalBytesAllocated(0), maxBytesAllocated(0),
+        hostCachedBytes(0), hostCacheHits(0), hostCacheMisses(0)
   {
   }
 };
@@ -77,24 +90,280 @@ struct matxPointerAttr_t {
   size_t size;
   matxMemorySpace_t kind = MATX_INVALID_MEMORY;
   cudaStream_t stream;
+  bool host_cached = false; ///< Block belongs to the host memory cache
+  bool host_numa = false;   ///< Block was mapped with a NUMA placement
 };
+
+/**
+ * @brief Round an allocation up to its size class
+ *
+ * Sizes are bucketed into four classes per power of two above 256 bytes, which bounds the
+ * wasted space at 25% while keeping the number of distinct classes small.
+ *
+ * @param bytes Requested size in bytes
+ * @return Size of the class that serves the request
+ */
+__MATX_INLINE__ size_t SizeClassBytes(size_t bytes) {
+  if (bytes <= 256) {
+    return 256;
+  }
+
+  size_t pow2 = 256;
+  while (pow2 <= (bytes - 1) / 2) {
+    pow2 *= 2;
+  }
+
+  const size_t step = pow2 / 4;
+  return (bytes + step - 1) / step * step;
+}
+
+static constexpr size_t HOST_CACHE_ALIGNMENT = 64;              // Cache line
+static constexpr size_t HOST_CACHE_HUGE_PAGE = 2 * 1024 * 1024; // Blocks this large are huge-page aligned
+static constexpr size_t HOST_THREAD_CACHE_MAX_BYTES = 1024 * 1024;
+static constexpr size_t HOST_THREAD_CACHE_BLOCKS = 4;
+
+/**
+ * @brief Caching allocator behind MATX_HOST_MALLOC_MEMORY
+ *
+ * Off by default. Once enabled with matxEnableHostMemoryCache(), freed host blocks are kept
+ * on size-class free lists instead of being returned to the system, so repeated temporaries
+ * stop paying for malloc/free and for page faults on large blocks that the system allocator
+ * would have unmapped. Blocks are 64-byte aligned, and blocks of 2 MiB or more are aligned
+ * to (and on Linux advised as) huge pages. Small blocks are first kept in a per-thread cache
+ * that needs no lock. Free blocks that would take the cache above its cap go back to the
+ * system immediately.
+ */
+class HostCachingAllocator {
+  public:
+    ~HostCachingAllocator() {
+      Release();
+    }
+
+    bool Enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    void Enable(size_t max_cached_bytes) {
+      max_cached_bytes_.store(max_cached_bytes);
+      enabled_.store(true);
+    }
+
+    void Disable() {
+      enabled_.store(false);
+      Release();
+    }
+
+    static size_t BlockBytes(size_t bytes) {
+      const size_t cls = SizeClassBytes(bytes);
+      return cls >= HOST_CACHE_HUGE_PAGE ? (cls + HOST_CACHE_HUGE_PAGE - 1) / HOST_CACHE_HUGE_PAGE * HOST_CACHE_HUGE_PAGE : cls;
+    }
+
+    void *allocate(size_t bytes) {
+      const size_t block = BlockBytes(bytes);
+      void *ptr = nullptr;
+
+      if (block <= HOST_THREAD_CACHE_MAX_BYTES) {
+        if (auto *tc = GetThreadCache(); tc != nullptr) {
+          auto iter = tc->blocks.find(block);
+          if (iter != tc->blocks.end() && !iter->second.empty()) {
+            ptr = iter->second.back();
+            iter->second.pop_back();
+          }
+        }
+      }
+
+      if (ptr == nullptr) {
+        [[maybe_unused]] std::unique_lock lck(mtx_);
+        auto iter = free_.find(block);
+        if (iter != free_.end() && !iter->second.empty()) {
+          ptr = iter->second.back();
+          iter->second.pop_back();
+        }
+      }
+
+      if (ptr != nullptr) {
+        cached_bytes_ -= block;
+        hits_++;
+        return ptr;
+      }
+
+      misses_++;
+      ptr = SystemAlloc(block);
+      if (ptr == nullptr) {
+        // Give the cached blocks back and try once more before reporting out of memory
+        Release();
+        ptr = SystemAlloc(block);
+      }
+
+      return ptr;
+    }
+
+    void deallocate(void *ptr, size_t bytes) {
+      const size_t block = BlockBytes(bytes);
+
+      if (!Enabled() || cached_bytes_.load() + block > max_cached_bytes_.load()) {
+        free(ptr);
+        return;
+      }
+
+      cached_bytes_ += block;
+      if (block <= HOST_THREAD_CACHE_MAX_BYTES) {
+        if (auto *tc = GetThreadCache(); tc != nullptr) {
+          auto &list = tc->blocks[block];
+          if (list.size() < HOST_THREAD_CACHE_BLOCKS) {
+            list.push_back(ptr);
+            return;
+          }
+        }
+      }
+
+      [[maybe_unused]] std::unique_lock lck(mtx_);
+      free_[block].push_back(ptr);
+    }
+
+    /**
+     * @brief Return the shared free blocks and the calling thread's cached blocks to the system
+     *
+     * Blocks cached by other threads are returned when those threads exit.
+     */
+    void Release() {
+      if (auto *tc = GetThreadCache(); tc != nullptr) {
+        tc->Flush(*this);
+      }
+
+      [[maybe_unused]] std::unique_lock lck(mtx_);
+      for (const auto &bucket : free_) {
+        for (auto ptr : bucket.second) {
+          free(ptr);
+          cached_bytes_ -= bucket.first;
+        }
+      }
+
+      free_.clear();
+    }
+
+    size_t CachedBytes() const { return cached_bytes_.load(); }
+    size_t Hits() const { return hits_.load(); }
+    size_t Misses() const { return misses_.load(); }
+
+  private:
+    struct ThreadCache {
+      std::unordered_map<size_t, std::vector<void *>> blocks;
+
+      void Flush(HostCachingAllocator &alloc) {
+        [[maybe_unused]] std::unique_lock lck(alloc.mtx_);
+        for (auto &bucket : blocks) {
+          auto &list = alloc.free_[bucket.first];
+          list.insert(list.end(), bucket.second.begin(), bucket.second.end());
+          bucket.second.clear();
+        }
+      }
+
+      ~ThreadCache();
+    };
+
+    static bool &ThreadCacheDestroyed() {
+      thread_local bool destroyed = false;
+      return destroyed;
+    }
+
+    ThreadCache *GetThreadCache();
+
+    static void *SystemAlloc(size_t block) {
+      const size_t align = block >= HOST_CACHE_HUGE_PAGE ? HOST_CACHE_HUGE_PAGE : HOST_CACHE_ALIGNMENT;
+      void *ptr = std::aligned_alloc(align, block);
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+      if (ptr != nullptr && block >= HOST_CACHE_HUGE_PAGE) {
+        madvise(ptr, block, MADV_HUGEPAGE);
+      }
+#endif
+      return ptr;
+    }
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<size_t> max_cached_bytes_{0};
+    std::atomic<size_t> cached_bytes_{0};
+    std::atomic<size_t> hits_{0};
+    std::atomic<size_t> misses_{0};
+    std::mutex mtx_;
+    std::unordered_map<size_t, std::vector<void *>> free_;
+};
+
+__attribute__ ((visibility ("default")))
+__MATX_INLINE__ HostCachingAllocator &GetHostCachingAllocator() {
+  static HostCachingAllocator alloc;
+  return alloc;
+}
+
+// Blocks a thread still caches when it exits move to the shared free lists. The flag lets
+// frees that happen later in the thread's teardown bypass the destroyed cache.
+inline HostCachingAllocator::ThreadCache::~ThreadCache() {
+  Flush(GetHostCachingAllocator());
+  HostCachingAllocator::ThreadCacheDestroyed() = true;
+}
+
+inline HostCachingAllocator::ThreadCache *HostCachingAllocator::GetThreadCache() {
+  if (ThreadCacheDestroyed()) {
+    return nullptr;
+  }
+
+  thread_local ThreadCache cache;
+  return &cache;
+}
 }
 
 
 inline detail::matxMemoryStats_t matxMemoryStats; ///< Statistics object
-inline std::shared_mutex memory_mtx; ///< Mutex protecting updates from map
 
+/**
+ * @brief Tracks every allocation made through matxAlloc
+ *
+ * Pointers are spread over independently locked shards by a hash of their address, so threads
+ * allocating and freeing different pointers rarely contend. Lookups take a shard's lock in
+ * shared mode, and the statistics are updated with atomics outside of any lock.
+ */
 struct MemTracker {
-  std::unordered_map<void *, detail::matxPointerAttr_t> allocationMap;
+  static constexpr int SHARD_BITS = 6;
+  static constexpr size_t NUM_SHARDS = size_t{1} << SHARD_BITS;
+
+  struct alignas(64) Shard {
+    std::shared_mutex mtx;
+    std::unordered_map<void *, detail::matxPointerAttr_t> allocationMap;
+  };
+
+  std::array<Shard, NUM_SHARDS> shards;
+
+  MemTracker() {
+    // Construct the host cache first so it outlives the tracker's cleanup at exit
+    detail::GetHostCachingAllocator();
+  }
+
+  static void update_host_cache_stats() {
+    const auto &cache = detail::GetHostCachingAllocator();
+    matxMemoryStats.hostCachedBytes = cache.CachedBytes();
+    matxMemoryStats.hostCacheHits = cache.Hits();
+    matxMemoryStats.hostCacheMisses = cache.Misses();
+  }
+
+  Shard &get_shard(void *ptr) {
+    // Fibonacci hashing so the zero low bits of aligned addresses don't pile onto one shard
+    const auto key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(ptr));
+    return shards[static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> (64 - SHARD_BITS))];
+  }
 
   auto size() {
-    return allocationMap.size();
+    size_t total = 0;
+    for (auto &shard : shards) {
+      std::shared_lock lck(shard.mtx);
+      total += shard.allocationMap.size();
+    }
+
+    return total;
   }
 
   void update_stream(void *ptr, cudaStream_t stream) {
-    [[maybe_unused]] std::unique_lock lck(memory_mtx);
-    auto iter = allocationMap.find(ptr);
-    if (iter == allocationMap.end()) {
+    auto &shard = get_shard(ptr);
+    [[maybe_unused]] std::unique_lock lck(shard.mtx);
+    auto iter = shard.allocationMap.find(ptr);
+    if (iter == shard.allocationMap.end()) {
       MATX_THROW(matxInvalidParameter, "Couldn't find pointer in allocation cache");
     }
 
@@ -105,25 +374,32 @@ struct MemTracker {
   auto deallocate_internal(void *ptr, [[maybe_unused]] StreamType st) {
     MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
 
-    [[maybe_unused]] std::unique_lock lck(memory_mtx);
-    auto iter = allocationMap.find(ptr);
+    detail::matxPointerAttr_t attr;
+    {
+      auto &shard = get_shard(ptr);
+      [[maybe_unused]] std::unique_lock lck(shard.mtx);
+      auto iter = shard.allocationMap.find(ptr);
+
+      if (iter == shard.allocationMap.end()) {
+    #ifdef MATX_DISABLE_MEM_TRACK_CHECK
+        // This error can occur in situations where the user includes MatX in multiple translation units
+        // and a deallocation occurs in a different one than it was allocated. Allow the user to ignore
+        // these cases if they know the issue.
+        MATX_THROW(matxInvalidParameter, "Couldn't find pointer in allocation cache");
+    #else
+        return;
+    #endif
+      }
 
-    if (iter == allocationMap.end()) {
-  #ifdef MATX_DISABLE_MEM_TRACK_CHECK
-      // This error can occur in situations where the user includes MatX in multiple translation units
-      // and a deallocation occurs in a different one than it was allocated. Allow the user to ignore
-      // these cases if they know the issue.
-      MATX_THROW(matxInvalidParameter, "Couldn't find pointer in allocation cache");
-  #else
-      return;      
-  #endif    
+      attr = iter->second;
+      shard.allocationMap.erase(iter);
     }
 
-    size_t bytes = iter->second.size;
+    size_t bytes = attr.size;
 
     matxMemoryStats.currentBytesAllocated -= bytes;
 
-    switch (iter->second.kind) {
+    switch (attr.kind) {
     case MATX_MANAGED_MEMORY:
       [[fallthrough]];
     case MATX_DEVICE_MEMORY:
@@ -133,11 +409,20 @@ struct MemTracker {
       cudaFreeHost(ptr);
       break;
     case MATX_HOST_MALLOC_MEMORY:
-      free(ptr);
+      if (attr.host_numa) {
+        detail::HostNumaFree(ptr, bytes);
+      }
+      else if (attr.host_cached) {
+        detail::GetHostCachingAllocator().deallocate(ptr, bytes);
+        update_host_cache_stats();
+      }
+      else {
+        free(ptr);
+      }
       break;
     case MATX_ASYNC_DEVICE_MEMORY:
       if constexpr (std::is_same_v<no_stream_t, StreamType>) {
-        cudaFreeAsync(ptr, iter->second.stream);
+        cudaFreeAsync(ptr, attr.stream);
       }
       else {
         cudaFreeAsync(ptr, st.stream);
@@ -146,8 +431,6 @@ struct MemTracker {
     default:
       MATX_THROW(matxInvalidType, "Invalid memory type");
     }
-
-    allocationMap.erase(ptr);    
   }
 
   struct no_stream_t{};
@@ -173,7 +456,8 @@ struct MemTracker {
     }
 
     *ptr = nullptr;
-    
+    bool host_cached = false;
+
     switch (space) {
     case MATX_MANAGED_MEMORY:
       err = cudaMallocManaged(ptr, bytes);
@@ -182,7 +466,13 @@ struct MemTracker {
       err = cudaMallocHost(ptr, bytes);
       break;
     case MATX_HOST_MALLOC_MEMORY:
-      *ptr = malloc(bytes);
+      if (detail::GetHostCachingAllocator().Enabled()) {
+        *ptr = detail::GetHostCachingAllocator().allocate(bytes);
+        host_cached = true;
+      }
+      else {
+        *ptr = malloc(bytes);
+      }
       break;
     case MATX_DEVICE_MEMORY:
       err = cudaMalloc(ptr, bytes);
@@ -201,12 +491,43 @@ struct MemTracker {
       MATX_THROW(matxOutOfMemory, "Failed to allocate memory");
     }
 
-    [[maybe_unused]] std::unique_lock lck(memory_mtx);
-    matxMemoryStats.currentBytesAllocated += bytes;
-    matxMemoryStats.totalBytesAllocated += bytes;
-    matxMemoryStats.maxBytesAllocated = cuda::std::max(
-        matxMemoryStats.maxBytesAllocated, matxMemoryStats.currentBytesAllocated);
-    allocationMap[*ptr] = {bytes, space, stream};
+    track(*ptr, {bytes, space, stream, host_cached, false});
+    if (host_cached) {
+      update_host_cache_stats();
+    }
+  }
+
+  void allocate(void **ptr, size_t bytes, const HostNumaPolicy &policy) {
+    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+
+    if (policy.placement == HostNumaPlacement::DEFAULT) {
+      allocate(ptr, bytes, MATX_HOST_MALLOC_MEMORY);
+      return;
+    }
+
+    if (ptr == nullptr) {
+      MATX_THROW(matxInvalidParameter, "nullptr on allocate");
+    }
+
+    *ptr = detail::HostNumaAlloc(bytes, policy);
+    if (*ptr == nullptr) {
+      MATX_THROW(matxOutOfMemory, "Failed to allocate memory");
+    }
+
+    track(*ptr, {bytes, MATX_HOST_MALLOC_MEMORY, 0, false, true});
+  }
+
+  void track(void *ptr, const detail::matxPointerAttr_t &attr) {
+    {
+      auto &shard = get_shard(ptr);
+      [[maybe_unused]] std::unique_lock lck(shard.mtx);
+      shard.allocationMap[ptr] = attr;
+    }
+
+    const size_t current = matxMemoryStats.currentBytesAllocated += attr.size;
+    matxMemoryStats.totalBytesAllocated += attr.size;
+    size_t prev_max = matxMemoryStats.maxBytesAllocated.load();
+    while (prev_max < current && !matxMemoryStats.maxBytesAllocated.compare_exchange_weak(prev_max, current)) {}
   }
 
   bool is_allocated(void *ptr) {
@@ -214,10 +535,11 @@ struct MemTracker {
       return false;
     }
 
-    [[maybe_unused]] std::unique_lock lck(memory_mtx);
-    auto iter = allocationMap.find(ptr);
+    auto &shard = get_shard(ptr);
+    [[maybe_unused]] std::shared_lock lck(shard.mtx);
+    auto iter = shard.allocationMap.find(ptr);
 
-    return iter != allocationMap.end();    
+    return iter != shard.allocationMap.end();
   }
 
   matxMemorySpace_t get_pointer_kind(void *ptr) {
@@ -225,10 +547,11 @@ struct MemTracker {
       return MATX_INVALID_MEMORY;
     }
 
-    [[maybe_unused]] std::unique_lock lck(memory_mtx);
-    auto iter = allocationMap.find(ptr);
+    auto &shard = get_shard(ptr);
+    [[maybe_unused]] std::shared_lock lck(shard.mtx);
+    auto iter = shard.allocationMap.find(ptr);
 
-    if (iter != allocationMap.end()) {
+    if (iter != shard.allocationMap.end()) {
       return iter->second.kind;
     }
 
@@ -236,8 +559,10 @@ struct MemTracker {
   }
 
   ~MemTracker() {
-    while (allocationMap.size()) {
-      deallocate(allocationMap.begin()->first);
+    for (auto &shard : shards) {
+      while (shard.allocationMap.size()) {
+        deallocate(shard.allocationMap.begin()->first);
+      }
     }
   }
 };
@@ -286,7 +611,6 @@ __MATX_INLINE__ bool DevicePrintable(matxMemorySpace_t mem)
  */
 __MATX_INLINE__ void matxGetMemoryStats(size_t *current, size_t *total, size_t *max)
 {
-  // std::shared_lock lck(memory_mtx);
   *current = matxMemoryStats.currentBytesAllocated;
   *total = matxMemoryStats.totalBytesAllocated;
   *max = matxMemoryStats.maxBytesAllocated;
@@ -333,6 +657,47 @@ __MATX_INLINE__ void matxPrintMemoryStatistics()
          "allocations: %lu\n",
          static_cast<double>(current) / 1e9, static_cast<double>(total) / 1e9,
          static_cast<double>(max) / 1e9, GetAllocMap().size());
+
+  if (matxMemoryStats.hostCacheHits + matxMemoryStats.hostCacheMisses > 0) {
+    printf("Host Memory Cache(GB):  cached: %.2f. Hits: %lu, misses: %lu\n",
+           static_cast<double>(matxMemoryStats.hostCachedBytes.load()) / 1e9,
+           matxMemoryStats.hostCacheHits.load(), matxMemoryStats.hostCacheMisses.load());
+  }
+}
+
+/**
+ * @brief Cache freed MATX_HOST_MALLOC_MEMORY blocks for reuse
+ *
+ * Host allocations made after this call come from size-class free lists of 64-byte aligned
+ * (huge-page aligned from 2 MiB) blocks, and are kept for reuse when freed rather than given
+ * back to the system. Cache hits, misses and the bytes held are reported in matxMemoryStats.
+ *
+ * @param max_cached_bytes Most free bytes the cache holds. Blocks freed beyond this are
+ * returned to the system.
+ */
+__MATX_INLINE__ void matxEnableHostMemoryCache(size_t max_cached_bytes = size_t{1} << 30)
+{
+  detail::GetHostCachingAllocator().Enable(max_cached_bytes);
+}
+
+/**
+ * @brief Stop caching host allocations and return the cached blocks to the system
+ *
+ * Blocks still in use when the cache is disabled are freed normally.
+ */
+__MATX_INLINE__ void matxDisableHostMemoryCache()
+{
+  detail::GetHostCachingAllocator().Disable();
+  MemTracker::update_host_cache_stats();
+}
+
+/**
+ * @brief Return the free blocks held by the host memory cache to the system
+ */
+__MATX_INLINE__ void matxReleaseHostMemoryCache()
+{
+  detail::GetHostCachingAllocator().Release();
+  MemTracker::update_host_cache_stats();
 }
 
 /**
@@ -355,6 +720,22 @@ __MATX_INLINE__ void matxAlloc(void **ptr, size_t bytes,
 }
 
 
+/**
+ * @brief Allocate host memory with a NUMA placement
+ *
+ * The memory is tracked as MATX_HOST_MALLOC_MEMORY and freed with matxFree().
+ *
+ * @param ptr Pointer to store allocated pointer
+ * @param bytes Bytes to allocate
+ * @param policy NUMA placement
+ */
+__MATX_INLINE__ void matxAlloc(void **ptr, size_t bytes, const HostNumaPolicy &policy)
+{
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+
+  return GetAllocMap().allocate(ptr, bytes, policy);
+}
+
 __MATX_INLINE__ void matxFree(void *ptr)
 {
   MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
@@ -424,4 +805,112 @@ __MATX_INLINE__ std::string SpaceString(matxMemorySpace_t space) {
   }
 }
 
+namespace detail {
+
+/**
+ * @brief Size-bucketed pool of temporary buffers
+ *
+ * Transform operators allocate their outputs in PreRun and release them in PostRun on every
+ * run(). Released buffers are kept on per-size-class free lists so a pipeline that runs the
+ * same expressions repeatedly reuses its blocks instead of going back to the system allocator.
+ * Blocks come from matxAlloc, so they are still reported by GetPointerKind() and included in
+ * the memory statistics while the pool holds them.
+ */
+class TempBufferPool {
+  public:
+    TempBufferPool(matxMemorySpace_t space, const HostNumaPolicy &numa = {}) : space_(space), numa_(numa) {
+      // Make sure the tracker is constructed first so it outlives pools owned by static executors
+      GetAllocMap();
+    }
+
+    TempBufferPool(const TempBufferPool &) = delete;
+    TempBufferPool &operator=(const TempBufferPool &) = delete;
+
+    ~TempBufferPool() {
+      Release();
+      for (const auto &block : in_use_) {
+        matxFree(block.first);
+      }
+    }
+
+    /**
+     * @brief Get a block of at least bytes bytes, reusing a released block when one is free
+     *
+     * @param bytes Size in bytes
+     * @return Pointer to the block
+     */
+    void *allocate(size_t bytes) {
+      // Placed blocks are only reused at the same page count so first-touch partitions line up
+      const size_t bucket = numa_.placement == HostNumaPlacement::DEFAULT ? SizeClassBytes(bytes) :
+          (bytes + HostPageBytes() - 1) / HostPageBytes() * HostPageBytes();
+      void *ptr = nullptr;
+
+      [[maybe_unused]] std::unique_lock lck(mtx_);
+      auto iter = free_.find(bucket);
+      if (iter != free_.end() && !iter->second.empty()) {
+        ptr = iter->second.back();
+        iter->second.pop_back();
+        cached_bytes_ -= bucket;
+      }
+      else if (numa_.placement != HostNumaPlacement::DEFAULT) {
+        matxAlloc(&ptr, bucket, numa_);
+      }
+      else {
+        matxAlloc(&ptr, bucket, space_);
+      }
+
+      in_use_[ptr] = bucket;
+      return ptr;
+    }
+
+    /**
+     * @brief Return a block to the pool
+     *
+     * @param ptr Pointer previously returned by allocate()
+     * @return False if the pointer did not come from this pool
+     */
+    bool deallocate(void *ptr) {
+      [[maybe_unused]] std::unique_lock lck(mtx_);
+      auto iter = in_use_.find(ptr);
+      if (iter == in_use_.end()) {
+        return false;
+      }
+
+      free_[iter->second].push_back(ptr);
+      cached_bytes_ += iter->second;
+      in_use_.erase(iter);
+      return true;
+    }
+
+    /**
+     * @brief Free every block that is not currently in use
+     */
+    void Release() {
+      [[maybe_unused]] std::unique_lock lck(mtx_);
+      for (const auto &bucket : free_) {
+        for (auto ptr : bucket.second) {
+          matxFree(ptr);
+        }
+      }
+
+      free_.clear();
+      cached_bytes_ = 0;
+    }
+
+    /**
+     * @brief Bytes held by free blocks waiting to be reused
+     */
+    size_t CachedBytes() const { return cached_bytes_; }
+
+  private:
+    matxMemorySpace_t space_;
+    HostNumaPolicy numa_;
+    std::mutex mtx_;
+    std::unordered_map<size_t, std::vector<void *>> free_;
+    std::unordered_map<void *, size_t> in_use_;
+    size_t cached_bytes_ = 0;
+};
+
+} // end namespace detail
+
 } // end namespace matx
@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "matx/core/allocator.h"
+#include "matx/core/error.h"
+
+namespace matx {
+
+/**
+ * @brief Bump-pointer arena for tensors that share a lifetime
+ *
+ * An arena owns one block of memory and hands out consecutive, 256-byte aligned pieces of it.
+ * Tensors made from an arena do not own their memory and are not tracked individually; all
+ * of them are released at once by reset(), which only rewinds the bump pointer. This suits
+ * pipelines that create the same intermediate tensors every frame:
+ *
+ * @code
+ * matx::Arena arena{64 << 20, MATX_HOST_MALLOC_MEMORY};
+ * for (auto frame : frames) {
+ *   auto tmp = make_tensor<float>({1024, 1024}, arena);
+ *   ...
+ *   arena.reset();
+ * }
+ * @endcode
+ *
+ * Requests that do not fit are served from extra blocks. The next reset() replaces all blocks
+ * with a single one sized to the high-water mark, so a steady-state frame uses one block and
+ * never reaches the system allocator. Tensors from an arena must not be used after reset()
+ * or after the arena is destroyed. Allocating from an arena is not thread-safe.
+ */
+class Arena {
+  public:
+    static constexpr size_t ALIGNMENT = 256;
+
+    /**
+     * @brief Create an arena
+     *
+     * @param capacity Initial size of the arena's block in bytes
+     * @param space Memory space of the block
+     * @param stream CUDA stream (for stream allocations)
+     */
+    Arena(size_t capacity, matxMemorySpace_t space = MATX_HOST_MALLOC_MEMORY, cudaStream_t stream = 0) :
+        space_(space), stream_(stream) {
+      if (capacity > 0) {
+        AddBlock(capacity);
+      }
+    }
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    ~Arena() {
+      FreeBlocks();
+    }
+
+    /**
+     * @brief Take bytes from the arena
+     *
+     * @param bytes Size in bytes
+     * @return Pointer aligned to ALIGNMENT
+     */
+    void *allocate(size_t bytes) {
+      const size_t aligned = (std::max(bytes, size_t{1}) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+      if (blocks_.empty() || offset_ + aligned > blocks_.back().size) {
+        AddBlock(std::max(aligned, capacity()));
+      }
+
+      void *ptr = static_cast<uint8_t *>(blocks_.back().base) + offset_;
+      offset_ += aligned;
+      used_ += aligned;
+      high_water_ = std::max(high_water_, used_);
+      return ptr;
+    }
+
+    /**
+     * @brief Release everything allocated from the arena
+     *
+     * If the last cycle overflowed into extra blocks, they are replaced by one block large
+     * enough for the whole cycle.
+     */
+    void reset() {
+      if (blocks_.size() > 1) {
+        FreeBlocks();
+        AddBlock(high_water_);
+      }
+
+      offset_ = 0;
+      used_ = 0;
+    }
+
+    /**
+     * @brief Bytes handed out since the last reset, including alignment padding
+     */
+    size_t used() const { return used_; }
+
+    /**
+     * @brief Total size of the arena's blocks in bytes
+     */
+    size_t capacity() const {
+      size_t total = 0;
+      for (const auto &block : blocks_) {
+        total += block.size;
+      }
+
+      return total;
+    }
+
+    /**
+     * @brief Memory space the arena allocates from
+     */
+    matxMemorySpace_t space() const { return space_; }
+
+  private:
+    struct Block {
+      void *ptr;    // Pointer returned by matxAlloc
+      void *base;   // ptr rounded up to ALIGNMENT
+      size_t size;  // Usable bytes from base
+    };
+
+    void AddBlock(size_t bytes) {
+      // The allocators only guarantee the alignment of their own memory space, so take
+      // enough extra to round the base up to ALIGNMENT
+      Block block{nullptr, nullptr, bytes};
+      matxAlloc(&block.ptr, bytes + ALIGNMENT - 1, space_, stream_);
+      const auto addr = reinterpret_cast<uintptr_t>(block.ptr);
+      block.base = reinterpret_cast<void *>((addr + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT);
+      blocks_.push_back(block);
+      offset_ = 0;
+    }
+
+    void FreeBlocks() {
+      for (const auto &block : blocks_) {
+        matxFree(block.ptr);
+      }
+
+      blocks_.clear();
+    }
+
+    matxMemorySpace_t space_;
+    cudaStream_t stream_;
+    std::vector<Block> blocks_;
+    size_t offset_ = 0;     // Offset into the newest block
+    size_t used_ = 0;
+    size_t high_water_ = 0;
+};
+
+} // end namespace matx
@@ -34,10 +34,14 @@
 #pragma once
 
 #include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <any>
 #include <shared_mutex>
 #include <unordered_map>
+#include <vector>
 #include <cuda/atomic>
 
 #include "matx/core/error.h"
@@ -51,7 +55,6 @@ using CacheId = uint64_t;
 __attribute__ ((visibility ("default")))
 #endif
 inline cuda::std::atomic<CacheId> CacheIdCounter{0};
-inline std::recursive_mutex cache_mtx; ///< Mutex protecting updates from map
 
 template<typename CacheType>
 __attribute__ ((visibility ("default")))
@@ -67,19 +70,36 @@ struct StreamAllocation {
   size_t size;
 };
 
+/**
+ * Hit, miss and eviction counters of the plan cache
+ */
+struct matxCacheStats_t {
+  size_t hits = 0;      ///< Lookups that found an existing plan
+  size_t misses = 0;    ///< Lookups that created a new plan
+  size_t evictions = 0; ///< Plans dropped because their cache was full
+  size_t entries = 0;   ///< Plans currently cached
+};
+
+// Most plans each cache type keeps before evicting the least recently used one
+static constexpr size_t DEFAULT_CACHE_CAPACITY = 1024;
+
 /**
  * Generic caching object for caching parameters. This class is used for
  * creating handles/plans on-the-fly and caching them to remove the need for
  * plans on certain interfaces. For example, InParams can be all parameters
  * needed to define an FFT, and if that plan already exists, a user doesn't need
  * to create another plan.
+ *
+ * Each cache type has its own lock, so transforms of different types never wait on each other,
+ * and the lock is only held to find or create a plan. Executing a plan takes a lock on that
+ * plan alone. Each type keeps at most its capacity of plans, evicting the least recently used.
  */
 class matxCache_t {
 public:
   matxCache_t() {}
   ~matxCache_t() {
     // Destroy all outstanding objects in the cache to free memory
-    for (auto &[k, v]: cache) {
+    for (auto &[k, v]: shards) {
       v.reset();
     }
   }
@@ -90,41 +110,119 @@ public:
    */
   template <typename CacheType>
   void Clear(const CacheId &id) {
-    [[maybe_unused]] std::lock_guard<std::recursive_mutex> lock(cache_mtx);
+    std::vector<std::shared_ptr<Entry>> removed;
 
-    auto el = cache.find(id);
-    MATX_ASSERT_STR(el != cache.end(), matxInvalidType, "Cache type not found");
+    auto &shard = GetShard<CacheType>(id);
+    [[maybe_unused]] std::lock_guard<std::recursive_mutex> lock(shard.mtx);
+    for (auto &el : shard.lru) {
+      removed.push_back(std::move(el.second));
+    }
 
-    std::any_cast<CacheType>(el->second).clear();
+    shard.index.clear();
+    shard.lru.clear();
   }
 
   template <typename CacheType, typename InParams, typename MakeFun, typename ExecFun>
   void LookupAndExec(const CacheId &id, const InParams &params, const MakeFun &mfun, const ExecFun &efun) {
-    // This mutex should eventually be finer-grained so each transform doesn't get blocked by others
-    [[maybe_unused]] std::lock_guard<std::recursive_mutex> lock(cache_mtx);
+    // Evicted plans are destroyed after the locks are released, and only once no other
+    // thread is still executing them
+    std::vector<std::shared_ptr<Entry>> evicted;
+    std::shared_ptr<Entry> entry;
 
-    // Create named cache if it doesn't exist
-    auto el = cache.find(id);
-    if (el == cache.end()) {
-      cache[id] = CacheType{};
+    auto &shard = GetShard<CacheType>(id);
+    {
+      [[maybe_unused]] std::lock_guard<std::recursive_mutex> lock(shard.mtx);
+      auto cache_el = shard.index.find(params);
+      if (cache_el == shard.index.end()) {
+        shard.stats.misses++;
+        entry = std::make_shared<Entry>();
+        entry->val = mfun();
+        shard.lru.emplace_front(params, entry);
+        shard.index.emplace(params, shard.lru.begin());
+        shard.Evict(evicted);
+      }
+      else {
+        shard.stats.hits++;
+        shard.lru.splice(shard.lru.begin(), shard.lru, cache_el->second);
+        entry = cache_el->second->second;
+      }
     }
 
-    auto &cval = cache[id];
-    auto &rmap = std::any_cast<CacheType&>(cval);
-    auto cache_el = rmap.find(params);
-    if (cache_el == rmap.end()) {
-      std::any tmp = mfun();
-      rmap.insert({params, tmp});
-      efun(std::any_cast<decltype(mfun())>(tmp));
+    [[maybe_unused]] std::lock_guard<std::recursive_mutex> lock(entry->mtx);
+    efun(std::any_cast<decltype(mfun())>(entry->val));
+  }
+
+  /**
+   * Set the most plans one cache type keeps. A capacity of 0 keeps every plan.
+   */
+  template <typename CacheType>
+  void SetCapacity(const CacheId &id, size_t capacity) {
+    std::vector<std::shared_ptr<Entry>> evicted;
+
+    auto &shard = GetShard<CacheType>(id);
+    [[maybe_unused]] std::lock_guard<std::recursive_mutex> lock(shard.mtx);
+    shard.capacity = capacity;
+    shard.Evict(evicted);
+  }
+
+  /**
+   * Set the capacity of every cache type, including types first used later
+   */
+  void SetCapacity(size_t capacity) {
+    std::vector<std::shared_ptr<Entry>> evicted;
+
+    std::vector<ShardBase *> all;
+    {
+      [[maybe_unused]] std::unique_lock lock(shards_mtx);
+      default_capacity = capacity;
+      all = AllShards();
     }
-    else {
-      efun(std::any_cast<decltype(mfun())>(cache_el->second));
+
+    for (auto *shard : all) {
+      [[maybe_unused]] std::lock_guard<std::recursive_mutex> shard_lock(shard->mtx);
+      shard->capacity = capacity;
+      shard->Evict(evicted);
     }
   }
 
+  /**
+   * Counters of one cache type
+   */
+  template <typename CacheType>
+  matxCacheStats_t GetStats(const CacheId &id) {
+    auto &shard = GetShard<CacheType>(id);
+    [[maybe_unused]] std::lock_guard<std::recursive_mutex> lock(shard.mtx);
+    return shard.Stats();
+  }
+
+  /**
+   * Counters summed over every cache type
+   */
+  matxCacheStats_t GetStats() {
+    matxCacheStats_t total;
+
+    std::vector<ShardBase *> all;
+    {
+      [[maybe_unused]] std::shared_lock lock(shards_mtx);
+      all = AllShards();
+    }
+
+    for (auto *shard : all) {
+      [[maybe_unused]] std::lock_guard<std::recursive_mutex> shard_lock(shard->mtx);
+      const auto stats = shard->Stats();
+      total.hits += stats.hits;
+      total.misses += stats.misses;
+      total.evictions += stats.evictions;
+      total.entries += stats.entries;
+    }
+
+    return total;
+  }
+
   void* GetStreamAlloc(cudaStream_t stream, size_t size) {
     void *ptr = nullptr;
 
+    [[maybe_unused]] std::lock_guard<std::mutex> lock(stream_alloc_mtx);
     auto el = stream_alloc_cache.find(stream);
     if (el == stream_alloc_cache.end()) {
       StreamAllocation alloc;
@@ -152,10 +250,102 @@ public:
   }
 
 private:
-  std::unordered_map<CacheId, std::any> cache;
+  struct Entry {
+    std::any val;
+    std::recursive_mutex mtx; ///< Serializes executions of this plan
+  };
+
+  struct ShardBase {
+    virtual ~ShardBase() = default;
+    virtual size_t size() const = 0;
+    virtual void EvictOldest(std::vector<std::shared_ptr<Entry>> &evicted) = 0;
+
+    void Evict(std::vector<std::shared_ptr<Entry>> &evicted) {
+      while (capacity > 0 && size() > capacity) {
+        EvictOldest(evicted);
+        stats.evictions++;
+      }
+    }
+
+    matxCacheStats_t Stats() const {
+      auto cur = stats;
+      cur.entries = size();
+      return cur;
+    }
+
+    std::recursive_mutex mtx; ///< Recursive since making a plan may look up another of the same type
+    size_t capacity = DEFAULT_CACHE_CAPACITY;
+    matxCacheStats_t stats;
+  };
+
+  // Plans of one cache type in most- to least-recently-used order, indexed by their parameters
+  template <typename CacheType>
+  struct Shard : public ShardBase {
+    using key_type = typename CacheType::key_type;
+    using list_type = std::list<std::pair<key_type, std::shared_ptr<Entry>>>;
+
+    size_t size() const override { return lru.size(); }
+
+    void EvictOldest(std::vector<std::shared_ptr<Entry>> &evicted) override {
+      index.erase(lru.back().first);
+      evicted.push_back(std::move(lru.back().second));
+      lru.pop_back();
+    }
+
+    list_type lru;
+    std::unordered_map<key_type, typename list_type::iterator,
+                       typename CacheType::hasher, typename CacheType::key_equal> index;
+  };
+
+  template <typename CacheType>
+  Shard<CacheType> &GetShard(const CacheId &id) {
+    {
+      [[maybe_unused]] std::shared_lock lock(shards_mtx);
+      auto el = shards.find(id);
+      if (el != shards.end()) {
+        return *static_cast<Shard<CacheType> *>(el->second.get());
+      }
+    }
+
+    [[maybe_unused]] std::unique_lock lock(shards_mtx);
+    auto &shard = shards[id];
+    if (!shard) {
+      shard = std::make_unique<Shard<CacheType>>();
+      shard->capacity = default_capacity;
+    }
+
+    return *static_cast<Shard<CacheType> *>(shard.get());
+  }
+
+  // Shards are only removed when the cache is destroyed, so the pointers stay valid after
+  // shards_mtx is released. Callers must hold shards_mtx, and must release it before locking
+  // any shard: making a plan under a shard's lock may take shards_mtx to find another type.
+  std::vector<ShardBase *> AllShards() const {
+    std::vector<ShardBase *> all;
+    all.reserve(shards.size());
+    for (const auto &[k, shard] : shards) {
+      all.push_back(shard.get());
+    }
+
+    return all;
+  }
+
+  std::shared_mutex shards_mtx; ///< Protects the set of cache types, not their contents
+  std::unordered_map<CacheId, std::unique_ptr<ShardBase>> shards;
+  size_t default_capacity = DEFAULT_CACHE_CAPACITY;
+  std::mutex stream_alloc_mtx;
   std::unordered_map<cudaStream_t, StreamAllocation> stream_alloc_cache;
 };
 
+/**
+ * Mixes a hash value into a running seed. Unlike a sum, the result depends on the order of
+ * the values, so permuted parameters don't collide.
+ */
+__MATX_INLINE__ size_t HashCombine(size_t seed, size_t hash)
+{
+  return seed ^ (hash + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+}
+
 /**
  * Converts elements in a POD container to a hash value
  */
@@ -164,7 +354,7 @@ inline size_t PodArrayToHash(cuda::std::array<T, len> c)
 {
   size_t hash = 0;
   for (auto &el : c) {
-    hash += std::hash<T>()(el);
+    hash = HashCombine(hash, std::hash<T>()(el));
   }
 
   return hash;
@@ -183,4 +373,28 @@ __MATX_INLINE__ matxCache_t &GetCache() {
 }
 
 }  // namespace detail
+
+/**
+ * @brief Set the most plans the cache keeps for each transform type
+ *
+ * When a type's cache is full, its least recently used plan is destroyed to make room. Plans
+ * still executing on another thread are destroyed once that execution finishes.
+ *
+ * @param capacity Plans kept per transform type. 0 keeps every plan.
+ */
+__MATX_INLINE__ void matxSetPlanCacheCapacity(size_t capacity)
+{
+  detail::GetCache().SetCapacity(capacity);
+}
+
+/**
+ * @brief Get the plan cache's hit, miss and eviction counters summed over all transform types
+ *
+ * @return Cache statistics
+ */
+__MATX_INLINE__ detail::matxCacheStats_t matxGetPlanCacheStats()
+{
+  return detail::GetCache().GetStats();
+}
+
 }; // namespace matx
@@ -59,6 +59,7 @@ namespace detail {
     NONE,
     SUPPORTS_JIT,                 // Can this operation be JIT-compiled?
     ELEMENTS_PER_THREAD,          // How many elements per thread?
+    ACCESSED_MEMORY,              // What range of memory do the operator's tensors span?
     // Add more capabilities as needed
   };
 
@@ -69,6 +70,23 @@ namespace detail {
     AND_QUERY,  // Result is true only if ALL relevant operators in the expression have the capability.
             // The operator itself AND its children.
     MIN_QUERY,  // Result is the minimum of the capabilities of the operator and its children.
+    UNION_QUERY, // Result covers the capabilities of the operator and all of its children.
+  };
+
+  // Address range [begin, end) of memory read through an operator. Empty by default.
+  struct MemoryRange {
+    uintptr_t begin = std::numeric_limits<uintptr_t>::max();
+    uintptr_t end = 0;
+
+    bool Empty() const { return begin >= end; }
+
+    bool Overlaps(const MemoryRange &other) const {
+      return !Empty() && !other.Empty() && begin < other.end && other.begin < end;
+    }
+
+    MemoryRange Union(const MemoryRange &other) const {
+      return {std::min(begin, other.begin), std::max(end, other.end)};
+    }
   };
 
   // Trait to get default values and identities based on capability
@@ -83,6 +101,12 @@ namespace detail {
     static constexpr bool and_identity = true;
   };
 
+  template <>
+  struct capability_attributes<OperatorCapability::ACCESSED_MEMORY> {
+    using type = MemoryRange;
+    static constexpr MemoryRange default_value = {};
+  };
+
   template <>
   struct capability_attributes<OperatorCapability::ELEMENTS_PER_THREAD> {
     using type = ElementsPerThread;
@@ -111,6 +135,8 @@ namespace detail {
         return CapabilityQueryType::OR_QUERY; // If any sub-operator supports JIT, the expression might be JIT-able.
       case OperatorCapability::ELEMENTS_PER_THREAD:
         return CapabilityQueryType::MIN_QUERY; // The expression should use the minimum elements per thread of its children.
+      case OperatorCapability::ACCESSED_MEMORY:
+        return CapabilityQueryType::UNION_QUERY; // The expression reads the memory of every one of its tensors.
       default:
         // Default to OR_QUERY or handle as an error/assertion if a capability isn't mapped.
         return CapabilityQueryType::OR_QUERY; 
@@ -159,6 +185,9 @@ namespace detail {
           } else { // AND_QUERY
               children_aggregated_val = (child_vals && ...);
           }
+      } else if constexpr (std::is_same_v<CapType, MemoryRange>) {
+          children_aggregated_val = capability_attributes<Cap>::default_value;
+          ((children_aggregated_val = children_aggregated_val.Union(child_vals)), ...);
       } else if constexpr (std::is_same_v<CapType, int> || std::is_same_v<std::underlying_type_t<CapType>, int>) {
           if (query_type == CapabilityQueryType::MIN_QUERY) {
               children_aggregated_val = capability_attributes<Cap>::min_identity;
@@ -184,6 +213,8 @@ namespace detail {
         } else { // AND_QUERY
             return self_val && children_aggregated_val;
         }
+    } else if constexpr (std::is_same_v<CapType, MemoryRange>) {
+        return self_val.Union(children_aggregated_val);
     } else if constexpr (std::is_same_v<CapType, int> || std::is_same_v<std::underlying_type_t<CapType>, int>) {
         if (query_type == CapabilityQueryType::MIN_QUERY) {
             return static_cast<CapType>(cuda::std::min(static_cast<int>(self_val), static_cast<int>(children_aggregated_val)));
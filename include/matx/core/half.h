@@ -33,14 +33,211 @@
 #pragma once
 
 #include <cuda/std/cmath>
+#include <cstdint>
+#include <cstring>
 #include <type_traits>
 
 #include "cuda_bf16.h"
 #include "cuda_fp16.h"
 #include "matx/core/defines.h"
 
+// Hardware conversions for half types in host code
+#if !defined(__CUDA_ARCH__) && defined(__F16C__)
+#include <immintrin.h>
+#define MATX_HALF_HOST_F16C
+#elif !defined(__CUDA_ARCH__) && defined(__aarch64__) && defined(__ARM_FP16_FORMAT_IEEE)
+#include <arm_neon.h>
+#define MATX_HALF_HOST_NEON
+#endif
+
 namespace matx {
 
+namespace detail {
+
+/**
+ * Host conversions between float and the 16-bit storage of __half and
+ * __nv_bfloat16. The conversion functions in cuda_fp16.h and cuda_bf16.h are
+ * written for portability and go through several branches per value on the
+ * host, which dominates the cost of any host expression on half tensors. These
+ * use the F16C or ARM fp16 instructions when the compiler targets them, and
+ * otherwise branch-free bit manipulation that the compiler can vectorize. All
+ * of them round to nearest even, matching the CUDA conversions.
+ */
+__MATX_HOST__ __MATX_INLINE__ uint32_t HostFloatBits(float f)
+{
+  uint32_t u;
+  std::memcpy(&u, &f, sizeof(u));
+  return u;
+}
+
+__MATX_HOST__ __MATX_INLINE__ float HostBitsFloat(uint32_t u)
+{
+  float f;
+  std::memcpy(&f, &u, sizeof(f));
+  return f;
+}
+
+/**
+ * @brief Convert IEEE binary16 bits to float on the host
+ *
+ * @param h fp16 bits
+ * @return Value as float
+ */
+__MATX_HOST__ __MATX_INLINE__ float HostFp16BitsToFloat(uint16_t h)
+{
+#if defined(MATX_HALF_HOST_F16C)
+  return _cvtsh_ss(h);
+#elif defined(MATX_HALF_HOST_NEON)
+  __fp16 v;
+  std::memcpy(&v, &h, sizeof(v));
+  return static_cast<float>(v);
+#else
+  // Rebias the exponent; denormals are renormalized by a float subtraction
+  const uint32_t shifted_exp = 0x7c00u << 13;
+  uint32_t o = (static_cast<uint32_t>(h) & 0x7fffu) << 13;
+  const uint32_t exp = shifted_exp & o;
+  o += (127u - 15u) << 23;
+  if (exp == shifted_exp) {
+    o += (128u - 16u) << 23;
+  }
+  else if (exp == 0) {
+    o = HostFloatBits(HostBitsFloat(o + (1u << 23)) - HostBitsFloat(113u << 23));
+  }
+  return HostBitsFloat(o | ((static_cast<uint32_t>(h) & 0x8000u) << 16));
+#endif
+}
+
+/**
+ * @brief Convert float to IEEE binary16 bits on the host
+ *
+ * @param f Value to convert
+ * @return fp16 bits
+ */
+__MATX_HOST__ __MATX_INLINE__ uint16_t HostFloatToFp16Bits(float f)
+{
+#if defined(MATX_HALF_HOST_F16C)
+  return static_cast<uint16_t>(_cvtss_sh(f, _MM_FROUND_TO_NEAREST_INT));
+#elif defined(MATX_HALF_HOST_NEON)
+  const __fp16 v = static_cast<__fp16>(f);
+  uint16_t h;
+  std::memcpy(&h, &v, sizeof(h));
+  return h;
+#else
+  uint32_t u = HostFloatBits(f);
+  const uint32_t sign = u & 0x80000000u;
+  u ^= sign;
+
+  uint32_t o;
+  if (u >= ((127u + 16u) << 23)) {
+    // Overflow to infinity, or a quiet NaN
+    o = u > (255u << 23) ? 0x7e00u : 0x7c00u;
+  }
+  else if (u < (113u << 23)) {
+    // Denormal or zero result: let the float adder do the rounding
+    const uint32_t denorm_magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+    o = HostFloatBits(HostBitsFloat(u) + HostBitsFloat(denorm_magic)) - denorm_magic;
+  }
+  else {
+    const uint32_t mant_odd = (u >> 13) & 1u;
+    u += ((15u - 127u) << 23) + 0xfffu + mant_odd;
+    o = u >> 13;
+  }
+  return static_cast<uint16_t>(o | (sign >> 16));
+#endif
+}
+
+/**
+ * @brief Convert bfloat16 bits to float on the host
+ *
+ * @param h bf16 bits
+ * @return Value as float
+ */
+__MATX_HOST__ __MATX_INLINE__ float HostBf16BitsToFloat(uint16_t h)
+{
+  return HostBitsFloat(static_cast<uint32_t>(h) << 16);
+}
+
+/**
+ * @brief Convert float to bfloat16 bits on the host
+ *
+ * @param f Value to convert
+ * @return bf16 bits
+ */
+__MATX_HOST__ __MATX_INLINE__ uint16_t HostFloatToBf16Bits(float f)
+{
+  const uint32_t u = HostFloatBits(f);
+  if ((u & 0x7fffffffu) > 0x7f800000u) {
+    return static_cast<uint16_t>((u >> 16) | 0x40u);
+  }
+
+  return static_cast<uint16_t>((u + 0x7fffu + ((u >> 16) & 1u)) >> 16);
+}
+
+/**
+ * @brief Convert a __half or __nv_bfloat16 to float on the host
+ *
+ * @tparam T __half or __nv_bfloat16
+ * @param x Value to convert
+ * @return Value as float
+ */
+template <typename T>
+__MATX_HOST__ __MATX_INLINE__ float HostHalfToFloat(const T &x)
+{
+  uint16_t h;
+  std::memcpy(&h, &x, sizeof(h));
+  if constexpr (std::is_same_v<T, __nv_bfloat16>) {
+    return HostBf16BitsToFloat(h);
+  }
+  else {
+    return HostFp16BitsToFloat(h);
+  }
+}
+
+/**
+ * @brief Convert a float to __half or __nv_bfloat16 on the host
+ *
+ * @tparam T __half or __nv_bfloat16
+ * @param f Value to convert
+ * @return Converted value
+ */
+template <typename T>
+__MATX_HOST__ __MATX_INLINE__ T HostFloatToHalf(float f)
+{
+  uint16_t h;
+  if constexpr (std::is_same_v<T, __nv_bfloat16>) {
+    h = HostFloatToBf16Bits(f);
+  }
+  else {
+    h = HostFloatToFp16Bits(f);
+  }
+
+  T x;
+  std::memcpy(&x, &h, sizeof(h));
+  return x;
+}
+
+/**
+ * @brief Convert any arithmetic or half value to the half type T on the host
+ *
+ * Values already of type T are passed through, and other 16-bit types are
+ * widened with HostHalfToFloat() instead of the CUDA conversions.
+ */
+template <typename T, typename T2>
+__MATX_HOST__ __MATX_INLINE__ T HostConvertToHalf(const T2 &v)
+{
+  if constexpr (std::is_same_v<T2, T>) {
+    return v;
+  }
+  else if constexpr (std::is_same_v<T2, __half> || std::is_same_v<T2, __nv_bfloat16>) {
+    return HostFloatToHalf<T>(HostHalfToFloat(v));
+  }
+  else {
+    return HostFloatToHalf<T>(static_cast<float>(v));
+  }
+}
+
+} // end namespace detail
+
 /**
  * Template class for half precison numbers (__half and __nv_bfloat16). CUDA
  * does not have standardized classes/operators available on both host and
@@ -71,7 +268,11 @@ template <typename T> struct alignas(sizeof(T)) matxHalf {
    */
   template <typename T2>
   __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf(const T2 &x_) noexcept
+#ifdef __CUDA_ARCH__
       : x(static_cast<float>(x_))
+#else
+      : x(detail::HostConvertToHalf<T>(x_))
+#endif
   {
   }
 
@@ -108,7 +309,11 @@ template <typename T> struct alignas(sizeof(T)) matxHalf {
    */
   __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ operator float() const
   {
+#ifdef __CUDA_ARCH__
     return static_cast<float>(x);
+#else
+    return detail::HostHalfToFloat(x);
+#endif
   }
 
   /**
@@ -127,7 +332,11 @@ template <typename T> struct alignas(sizeof(T)) matxHalf {
   template <typename T2>
   __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> &operator=(const T2 &rhs)
   {
+#ifdef __CUDA_ARCH__
     x = static_cast<float>(rhs);
+#else
+    x = detail::HostConvertToHalf<T>(rhs);
+#endif
     return *this;
   }
 
@@ -365,7 +574,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> operator-(const matxHa
 #ifdef __CUDA_ARCH__
   return {-l.x};
 #else
-  return {-static_cast<float>(l.x)};
+  return {-static_cast<float>(l)};
 #endif
 }
 
@@ -384,7 +593,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ bool operator==(const matxHalf<T>
 #ifdef __CUDA_ARCH__
   return lhs.x == rhs.x;
 #else
-  return static_cast<float>(lhs.x) == static_cast<float>(rhs.x);
+  return static_cast<float>(lhs) == static_cast<float>(rhs);
 #endif
 }
 
@@ -482,7 +691,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ bool operator>(const matxHalf<T> &
 #ifdef __CUDA_ARCH__
   return lhs.x > rhs.x;
 #else
-  return static_cast<float>(lhs.x) > static_cast<float>(rhs.x);
+  return static_cast<float>(lhs) > static_cast<float>(rhs);
 #endif
 }
 
@@ -501,7 +710,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ bool operator<(const matxHalf<T> &
 #ifdef __CUDA_ARCH__
   return lhs.x < rhs.x;
 #else
-  return static_cast<float>(lhs.x) < static_cast<float>(rhs.x);
+  return static_cast<float>(lhs) < static_cast<float>(rhs);
 #endif
 }
 
@@ -550,7 +759,7 @@ operator+(const matxHalf<T> &lhs, const matxHalf<T> &rhs)
 #ifdef __CUDA_ARCH__
   return lhs.x + rhs.x;
 #else
-  return static_cast<T>(static_cast<float>(lhs) + static_cast<float>(rhs));
+  return matxHalf<T>{static_cast<float>(lhs) + static_cast<float>(rhs)};
 #endif
 }
 
@@ -569,7 +778,7 @@ operator-(const matxHalf<T> &lhs, const matxHalf<T> &rhs)
 #ifdef __CUDA_ARCH__
   return lhs.x - rhs.x;
 #else
-  return static_cast<T>(static_cast<float>(lhs) - static_cast<float>(rhs));
+  return matxHalf<T>{static_cast<float>(lhs) - static_cast<float>(rhs)};
 #endif
 }
 
@@ -588,7 +797,7 @@ operator*(const matxHalf<T> &lhs, const matxHalf<T> &rhs)
 #ifdef __CUDA_ARCH__
   return lhs.x * rhs.x;
 #else
-  return static_cast<T>(static_cast<float>(lhs.x) * static_cast<float>(rhs.x));
+  return matxHalf<T>{static_cast<float>(lhs) * static_cast<float>(rhs)};
 #endif
 }
 
@@ -607,7 +816,7 @@ operator/(const matxHalf<T> &lhs, const matxHalf<T> &rhs)
 #ifdef __CUDA_ARCH__
   return lhs.x / rhs.x;
 #else
-  return static_cast<T>(static_cast<float>(lhs.x) / static_cast<float>(rhs.x));
+  return matxHalf<T>{static_cast<float>(lhs) / static_cast<float>(rhs)};
 #endif
 }
 
@@ -624,7 +833,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> abs(const matxHalf<T>
 #ifdef __CUDA_ARCH__
   return __habs(x.x);
 #else
-  return static_cast<T>(cuda::std::abs(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::abs(static_cast<float>(x)));
 #endif
 }
 
@@ -642,7 +851,7 @@ abs(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return __habs(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::abs(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::abs(static_cast<float>(x)));
 #endif
 }
 
@@ -659,7 +868,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> log(const matxHalf<T>
 #ifdef __CUDA_ARCH__
   return hlog(x.x);
 #else
-  return static_cast<T>(cuda::std::log(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::log(static_cast<float>(x)));
 #endif
 }
 
@@ -676,7 +885,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> sqrt(const matxHalf<T>
 #ifdef __CUDA_ARCH__
   return hsqrt(x.x);
 #else
-  return static_cast<T>(cuda::std::sqrt(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::sqrt(static_cast<float>(x)));
 #endif
 }
 
@@ -694,7 +903,7 @@ sqrt(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hsqrt(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::sqrt(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::sqrt(static_cast<float>(x)));
 #endif
 }
 
@@ -712,9 +921,9 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> rsqrt(const matxHalf<T
   return hrsqrt(x.x);
 #else
   #ifdef __CUDACC__
-    return static_cast<__nv_bfloat16>(::rsqrt(static_cast<float>(x.x)));
+    return matxHalf<__nv_bfloat16>(::rsqrt(static_cast<float>(x)));
   #else
-    return static_cast<__nv_bfloat16>(1.f / cuda::std::sqrt(static_cast<float>(x.x)));
+    return matxHalf<__nv_bfloat16>(1.f / cuda::std::sqrt(static_cast<float>(x)));
   #endif
 #endif
 }
@@ -734,9 +943,9 @@ rsqrt(const matxHalf<__nv_bfloat16> &x)
   return hrsqrt(x.x);
 #else
   #ifdef __CUDACC__
-    return static_cast<__nv_bfloat16>(::rsqrt(static_cast<float>(x.x)));
+    return matxHalf<__nv_bfloat16>(::rsqrt(static_cast<float>(x)));
   #else
-    return static_cast<__nv_bfloat16>(1.f / cuda::std::sqrt(static_cast<float>(x.x)));
+    return matxHalf<__nv_bfloat16>(1.f / cuda::std::sqrt(static_cast<float>(x)));
   #endif
 #endif
 }
@@ -754,7 +963,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ int isinf(const matxHalf<T> &x)
 #ifdef __CUDA_ARCH__
   return __hisinf(x.x);
 #else
-  return static_cast<int>(cuda::std::isinf(static_cast<float>(x.x)));
+  return static_cast<int>(cuda::std::isinf(static_cast<float>(x)));
 #endif
 }
 
@@ -771,7 +980,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ int isinf(const matxHalf<__nv_bflo
 #if __CUDA_ARCH__ >= 800
   return __hisinf(x.x);
 #else
-  return static_cast<int>(cuda::std::isinf(static_cast<float>(x.x)));
+  return static_cast<int>(cuda::std::isinf(static_cast<float>(x)));
 #endif
 }
 
@@ -789,7 +998,7 @@ log(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hlog(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::log(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::log(static_cast<float>(x)));
 #endif
 }
 
@@ -806,7 +1015,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> log10(const matxHalf<T
 #ifdef __CUDA_ARCH__
   return hlog10(x.x);
 #else
-  return static_cast<T>(cuda::std::log10(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::log10(static_cast<float>(x)));
 #endif
 }
 
@@ -824,7 +1033,7 @@ log10(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hlog10(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::log10(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::log10(static_cast<float>(x)));
 #endif
 }
 
@@ -841,7 +1050,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> log2(const matxHalf<T>
 #ifdef __CUDA_ARCH__
   return hlog2(x.x);
 #else
-  return static_cast<T>(cuda::std::log2(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::log2(static_cast<float>(x)));
 #endif
 }
 
@@ -859,7 +1068,7 @@ log2(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hlog2(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::log2(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::log2(static_cast<float>(x)));
 #endif
 }
 
@@ -876,7 +1085,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> exp(const matxHalf<T>
 #ifdef __CUDA_ARCH__
   return hexp(x.x);
 #else
-  return static_cast<T>(cuda::std::exp(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::exp(static_cast<float>(x)));
 #endif
 }
 
@@ -894,7 +1103,7 @@ exp(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hexp(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::exp(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::exp(static_cast<float>(x)));
 #endif
 }
 
@@ -910,8 +1119,8 @@ template <class T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> pow(const matxHalf<T> &x,
                                                     const matxHalf<T> &y)
 {
-  auto tmp = cuda::std::pow(static_cast<float>(x.x), static_cast<float>(y.x));
-  return static_cast<T>(tmp);
+  auto tmp = cuda::std::pow(static_cast<float>(x), static_cast<float>(y));
+  return matxHalf<T>(tmp);
 }
 
 /**
@@ -926,8 +1135,8 @@ template <class T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> pow(const matxHalf<T> &x,
                                                     const T &y)
 {
-  auto tmp = cuda::std::pow(static_cast<float>(x.x), static_cast<float>(y));
-  return static_cast<T>(tmp);
+  auto tmp = cuda::std::pow(static_cast<float>(x), static_cast<float>(y));
+  return matxHalf<T>(tmp);
 }
 
 /**
@@ -942,8 +1151,8 @@ template <class T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> pow(const T &x,
                                                     const matxHalf<T> &y)
 {
-  auto tmp = cuda::std::pow(x, static_cast<float>(y.x));
-  return static_cast<T>(tmp);
+  auto tmp = cuda::std::pow(x, static_cast<float>(y));
+  return matxHalf<T>(tmp);
 }
 
 /**
@@ -959,7 +1168,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> floor(const matxHalf<T
 #ifdef __CUDA_ARCH__
   return hfloor(x.x);
 #else
-  return static_cast<T>(cuda::std::floor(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::floor(static_cast<float>(x)));
 #endif
 }
 
@@ -977,7 +1186,7 @@ floor(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hfloor(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::floor(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::floor(static_cast<float>(x)));
 #endif
 }
 
@@ -994,7 +1203,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> ceil(const matxHalf<T>
 #ifdef __CUDA_ARCH__
   return hceil(x.x);
 #else
-  return static_cast<T>(cuda::std::ceil(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::ceil(static_cast<float>(x)));
 #endif
 }
 
@@ -1012,7 +1221,7 @@ ceil(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hceil(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::ceil(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::ceil(static_cast<float>(x)));
 #endif
 }
 
@@ -1029,7 +1238,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> round(const matxHalf<T
 #ifdef __CUDA_ARCH__
   return hrint(x.x);
 #else
-  return static_cast<T>(cuda::std::round(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::round(static_cast<float>(x)));
 #endif
 }
 
@@ -1047,7 +1256,7 @@ round(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hrint(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::round(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::round(static_cast<float>(x)));
 #endif
 }
 
@@ -1062,8 +1271,8 @@ round(const matxHalf<__nv_bfloat16> &x)
 template <class T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T>
 fmod(const T &x, const matxHalf<T> &y) {
-  auto tmp = cuda::std::fmod(x, static_cast<float>(y.x));
-  return static_cast<T>(tmp);
+  auto tmp = cuda::std::fmod(x, static_cast<float>(y));
+  return matxHalf<T>(tmp);
 }
 
 /**
@@ -1077,8 +1286,8 @@ fmod(const T &x, const matxHalf<T> &y) {
 template <class T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T>
 fmod(const matxHalf<T> &x, const matxHalf<T> &y) {
-  auto tmp = cuda::std::fmod(static_cast<float>(x.x), static_cast<float>(y.x));
-  return static_cast<T>(tmp);
+  auto tmp = cuda::std::fmod(static_cast<float>(x), static_cast<float>(y));
+  return matxHalf<T>(tmp);
 }
 
 /**
@@ -1092,8 +1301,8 @@ fmod(const matxHalf<T> &x, const matxHalf<T> &y) {
 template <class T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T>
 fmod(const matxHalf<T> &x, const T &y) {
-  auto tmp = cuda::std::fmod(static_cast<float>(x.x), y);
-  return static_cast<T>(tmp);
+  auto tmp = cuda::std::fmod(static_cast<float>(x), y);
+  return matxHalf<T>(tmp);
 }
 
 /**
@@ -1109,7 +1318,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> sin(const matxHalf<T>
 #ifdef __CUDA_ARCH__
   return hsin(x.x);
 #else
-  return static_cast<T>(cuda::std::sin(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::sin(static_cast<float>(x)));
 #endif
 }
 
@@ -1127,7 +1336,7 @@ sin(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hsin(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::sin(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::sin(static_cast<float>(x)));
 #endif
 }
 
@@ -1144,7 +1353,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> cos(const matxHalf<T>
 #ifdef __CUDA_ARCH__
   return hcos(x.x);
 #else
-  return static_cast<T>(cuda::std::cos(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::cos(static_cast<float>(x)));
 #endif
 }
 
@@ -1162,7 +1371,7 @@ cos(const matxHalf<__nv_bfloat16> &x)
 #if __CUDA_ARCH__ >= 800
   return hcos(x.x);
 #else
-  return static_cast<__nv_bfloat16>(cuda::std::cos(static_cast<float>(x.x)));
+  return matxHalf<__nv_bfloat16>(cuda::std::cos(static_cast<float>(x)));
 #endif
 }
 
@@ -1176,7 +1385,7 @@ cos(const matxHalf<__nv_bfloat16> &x)
 template <class T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> tan(const matxHalf<T> &x)
 {
-  return static_cast<T>(cuda::std::tan(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::tan(static_cast<float>(x)));
 }
 
 /**
@@ -1189,7 +1398,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> tan(const matxHalf<T>
 template <class T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> asin(const matxHalf<T> &x)
 {
-  return static_cast<T>(cuda::std::asin(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::asin(static_cast<float>(x)));
 }
 
 
@@ -1203,7 +1412,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> asin(const matxHalf<T>
 template <class T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> acos(const matxHalf<T> &x)
 {
-  return static_cast<T>(cuda::std::acos(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::acos(static_cast<float>(x)));
 }
 
 /**
@@ -1216,7 +1425,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> acos(const matxHalf<T>
 template <class T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> atan(const matxHalf<T> &x)
 {
-  return static_cast<T>(cuda::std::atan(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::atan(static_cast<float>(x)));
 }
 
 /**
@@ -1230,7 +1439,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> atan(const matxHalf<T>
 template <class T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> atan2(const matxHalf<T> x, const matxHalf<T> y)
 {
-  return static_cast<T>(cuda::std::atan2(static_cast<float>(x.x), static_cast<float>(y.x)));
+  return matxHalf<T>(cuda::std::atan2(static_cast<float>(x), static_cast<float>(y)));
 }
 
 
@@ -1244,7 +1453,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> atan2(const matxHalf<T
 template <class T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> asinh(const matxHalf<T> &x)
 {
-  return static_cast<T>(cuda::std::asinh(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::asinh(static_cast<float>(x)));
 }
 
 /**
@@ -1257,7 +1466,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> asinh(const matxHalf<T
 template <class T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> acosh(const matxHalf<T> &x)
 {
-  return static_cast<T>(cuda::std::acosh(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::acosh(static_cast<float>(x)));
 }
 
 /**
@@ -1270,7 +1479,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> acosh(const matxHalf<T
 template <class T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> atanh(const matxHalf<T> &x)
 {
-  return static_cast<T>(cuda::std::atanh(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::atanh(static_cast<float>(x)));
 }
 
 /**
@@ -1283,7 +1492,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> atanh(const matxHalf<T
 template <class T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> sinh(const matxHalf<T> &x)
 {
-  return static_cast<T>(cuda::std::sinh(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::sinh(static_cast<float>(x)));
 }
 
 /**
@@ -1296,7 +1505,7 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> sinh(const matxHalf<T>
 template <class T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> cosh(const matxHalf<T> &x)
 {
-  return static_cast<T>(cuda::std::cosh(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::cosh(static_cast<float>(x)));
 }
 
 /**
@@ -1309,10 +1518,106 @@ __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> cosh(const matxHalf<T>
 template <class T>
 __MATX_HOST__ __MATX_DEVICE__ __MATX_INLINE__ matxHalf<T> tanh(const matxHalf<T> &x)
 {
-  return static_cast<T>(cuda::std::tanh(static_cast<float>(x.x)));
+  return matxHalf<T>(cuda::std::tanh(static_cast<float>(x)));
 }
 
 using matxFp16 = matxHalf<__half>; ///< Alias for fp16
 using matxBf16 = matxHalf<__nv_bfloat16>; ///< Alias for bf16
 
+namespace detail {
+
+/**
+ * @brief Widen n contiguous half values to float on the host
+ *
+ * fp16 is converted 16 lanes at a time with AVX-512, 8 with F16C or NEON, and
+ * bf16 with a shift that the compiler vectorizes. The tail, and targets
+ * without these instructions, use HostHalfToFloat().
+ *
+ * @tparam T __half or __nv_bfloat16
+ * @param in Values to convert
+ * @param out Destination of n floats
+ * @param n Number of values
+ */
+template <typename T>
+__MATX_HOST__ __MATX_INLINE__ void HostHalfToFloatN(const matxHalf<T> *in, float *out, index_t n)
+{
+  const uint16_t *bits = reinterpret_cast<const uint16_t *>(in);
+  index_t i = 0;
+  if constexpr (std::is_same_v<T, __nv_bfloat16>) {
+#pragma omp simd
+    for (i = 0; i < n; i++) {
+      out[i] = HostBf16BitsToFloat(bits[i]);
+    }
+  }
+  else {
+#if defined(MATX_HALF_HOST_F16C)
+#if defined(__AVX512F__)
+    for (; i + 16 <= n; i += 16) {
+      // Zero-masked forms: the unmasked ones trip -Wmaybe-uninitialized in GCC 12
+      _mm512_storeu_ps(out + i, _mm512_maskz_cvtph_ps(0xffff, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bits + i))));
+    }
+#endif
+    for (; i + 8 <= n; i += 8) {
+      _mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(bits + i))));
+    }
+#elif defined(MATX_HALF_HOST_NEON)
+    for (; i + 8 <= n; i += 8) {
+      const float16x8_t v = vld1q_f16(reinterpret_cast<const float16_t *>(bits + i));
+      vst1q_f32(out + i, vcvt_f32_f16(vget_low_f16(v)));
+      vst1q_f32(out + i + 4, vcvt_high_f32_f16(v));
+    }
+#endif
+    for (; i < n; i++) {
+      out[i] = HostFp16BitsToFloat(bits[i]);
+    }
+  }
+}
+
+/**
+ * @brief Narrow n contiguous floats to a half type on the host
+ *
+ * Counterpart of HostHalfToFloatN(), rounding to nearest even.
+ *
+ * @tparam T __half or __nv_bfloat16
+ * @param in Values to convert
+ * @param out Destination of n half values
+ * @param n Number of values
+ */
+template <typename T>
+__MATX_HOST__ __MATX_INLINE__ void HostFloatToHalfN(const float *in, matxHalf<T> *out, index_t n)
+{
+  uint16_t *bits = reinterpret_cast<uint16_t *>(out);
+  index_t i = 0;
+  if constexpr (std::is_same_v<T, __nv_bfloat16>) {
+#pragma omp simd
+    for (i = 0; i < n; i++) {
+      bits[i] = HostFloatToBf16Bits(in[i]);
+    }
+  }
+  else {
+#if defined(MATX_HALF_HOST_F16C)
+#if defined(__AVX512F__)
+    for (; i + 16 <= n; i += 16) {
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(bits + i),
+                          _mm512_maskz_cvtps_ph(0xffff, _mm512_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+    }
+#endif
+    for (; i + 8 <= n; i += 8) {
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(bits + i),
+                       _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+    }
+#elif defined(MATX_HALF_HOST_NEON)
+    for (; i + 8 <= n; i += 8) {
+      const float16x8_t v = vcombine_f16(vcvt_f16_f32(vld1q_f32(in + i)), vcvt_f16_f32(vld1q_f32(in + i + 4)));
+      vst1q_f16(reinterpret_cast<float16_t *>(bits + i), v);
+    }
+#endif
+    for (; i < n; i++) {
+      bits[i] = HostFloatToFp16Bits(in[i]);
+    }
+  }
+}
+
+} // end namespace detail
+
 }; // namespace matx
@@ -206,6 +206,43 @@ auto make_zero_tensor_csc(const index_t (&shape)[2],
        makeDefaultNonOwningZeroStorage<POS>(shape[1] + 1, space)});
 }
 
+// Constructs a sparse matrix in BSR format directly from the values, the
+// block row positions, and block column coordinates vectors. The matrix is
+// tiled into dense BM x BN blocks, and each stored block keeps all of its
+// BM * BN values consecutively in row-major order. The blocks should be
+// sorted by block row, then block column. This format is most efficient for
+// matrices whose nonzeros cluster in small dense blocks.
+template <int BM, int BN, typename ValTensor, typename PosTensor,
+          typename CrdTensor>
+auto make_tensor_bsr(ValTensor &val, PosTensor &browp, CrdTensor &bcol,
+                     const index_t (&shape)[2]) {
+  using VAL = typename ValTensor::value_type;
+  using CRD = typename CrdTensor::value_type;
+  using POS = typename PosTensor::value_type;
+  // Proper structure.
+  MATX_STATIC_ASSERT_STR(ValTensor::Rank() == 1 && PosTensor::Rank() == 1 &&
+                             CrdTensor::Rank() == 1,
+                         matxInvalidParameter, "data arrays should be rank-1");
+  MATX_STATIC_ASSERT_STR(BM > 0 && BN > 0, matxInvalidParameter,
+                         "block dimensions should be positive");
+  MATX_ASSERT_STR(shape[0] % BM == 0 && shape[1] % BN == 0,
+                  matxInvalidParameter,
+                  "matrix dimensions should be a multiple of the block size");
+  MATX_ASSERT_STR(browp.Size(0) == shape[0] / BM + 1, matxInvalidParameter,
+                  "block row positions array should have length #block rows + 1");
+  MATX_ASSERT_STR(val.Size(0) == bcol.Size(0) * BM * BN, matxInvalidParameter,
+                  "data arrays should contain a full block per block column");
+  // Construct BSR.
+  return sparse_tensor_t<VAL, CRD, POS, BSR<BM, BN>>(
+      shape, val.GetStorage(),
+      {makeDefaultNonOwningEmptyStorage<CRD>(), bcol.GetStorage(),
+       makeDefaultNonOwningEmptyStorage<CRD>(),
+       makeDefaultNonOwningEmptyStorage<CRD>()},
+      {makeDefaultNonOwningEmptyStorage<POS>(), browp.GetStorage(),
+       makeDefaultNonOwningEmptyStorage<POS>(),
+       makeDefaultNonOwningEmptyStorage<POS>()});
+}
+
 // Constructs a sparse matrix in DIA format directly from the values and the
 // offset vectors. For an m x n matrix, this format uses a linearized storage
 // where each diagonal has m or n entries and is accessed by either index I or
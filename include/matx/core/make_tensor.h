@@ -206,6 +206,217 @@ auto make_tensor_p( ShapeType &&shape,
 }
 
 
+/**
+ * Create a tensor with a C array for the shape using memory from an arena
+ *
+ * The tensor does not own its memory, which is released when the arena is reset.
+ *
+ * @param shape Shape of tensor
+ * @param arena Arena to allocate from
+ * @returns New tensor
+ **/
+template <typename T, int RANK>
+auto make_tensor( const index_t (&shape)[RANK],
+                  Arena &arena) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+
+  DefaultDescriptor<RANK> desc{shape};
+
+  size_t size = static_cast<size_t>(desc.TotalSize()) * sizeof(T);
+  raw_pointer_buffer<T, matx_allocator<T>> rp(size, arena);
+  basic_storage<decltype(rp)> s{std::move(rp)};
+  return tensor_t<T, RANK, decltype(s), decltype(desc)>{std::move(s), std::move(desc)};
+}
+
+/**
+ * Create a tensor with a C array for the shape using memory from an arena
+ *
+ * @param tensor Tensor object to store newly-created tensor into
+ * @param shape Shape of tensor
+ * @param arena Arena to allocate from
+ **/
+template <typename TensorType, std::enable_if_t< is_tensor_view_v<TensorType>, bool> = true>
+void make_tensor( TensorType &tensor,
+                  const index_t (&shape)[TensorType::Rank()],
+                  Arena &arena) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+
+  auto tmp = make_tensor<typename TensorType::value_type, TensorType::Rank()>(shape, arena);
+  tensor.Shallow(tmp);
+}
+
+/**
+ * Create a tensor with a C array for the shape using memory from an arena.
+ * Caller is responsible for deleting the tensor.
+ *
+ * @param shape Shape of tensor
+ * @param arena Arena to allocate from
+ * @returns Pointer to new tensor
+ **/
+template <typename T, int RANK>
+auto make_tensor_p( const index_t (&shape)[RANK],
+                    Arena &arena) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+
+  DefaultDescriptor<RANK> desc{shape};
+
+  size_t size = static_cast<size_t>(desc.TotalSize()) * sizeof(T);
+  raw_pointer_buffer<T, matx_allocator<T>> rp(size, arena);
+  basic_storage<decltype(rp)> s{std::move(rp)};
+  return new tensor_t<T, RANK, decltype(s), decltype(desc)>{std::move(s), std::move(desc)};
+}
+
+/**
+ * Create a tensor from a conforming container type using memory from an arena
+ *
+ * @param shape Shape of tensor
+ * @param arena Arena to allocate from
+ * @returns New tensor
+ **/
+template <typename T, typename ShapeType,
+  std::enable_if_t< !is_matx_shape_v<ShapeType> &&
+                    !is_matx_descriptor_v<ShapeType> &&
+                    !std::is_array_v<typename remove_cvref<ShapeType>::type>, bool> = true>
+auto make_tensor( ShapeType &&shape,
+                  Arena &arena) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+
+  constexpr int rank = static_cast<int>(cuda::std::tuple_size<typename remove_cvref<ShapeType>::type>::value);
+  DefaultDescriptor<rank> desc{std::move(shape)};
+
+  size_t size = static_cast<size_t>(desc.TotalSize()) * sizeof(T);
+  raw_pointer_buffer<T, matx_allocator<T>> rp(size, arena);
+  basic_storage<decltype(rp)> s{std::move(rp)};
+  return tensor_t<T, rank, decltype(s), decltype(desc)>{std::move(s), std::move(desc)};
+}
+
+/**
+ * Create a tensor from a conforming container type using memory from an arena
+ *
+ * @param tensor Tensor object to store newly-created tensor into
+ * @param shape Shape of tensor
+ * @param arena Arena to allocate from
+ **/
+template <typename TensorType,typename ShapeType,
+  std::enable_if_t<is_tensor_view_v<TensorType> && !std::is_array_v<typename remove_cvref<ShapeType>::type>, bool> = true>
+auto make_tensor( TensorType &tensor,
+                  ShapeType &&shape,
+                  Arena &arena) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+
+  auto tmp = make_tensor<typename TensorType::value_type, ShapeType>(std::forward<ShapeType>(shape), arena);
+  tensor.Shallow(tmp);
+}
+
+/**
+ * Create a tensor from a conforming container type using memory from an arena.
+ * Caller is responsible for deleting the tensor.
+ *
+ * @param shape Shape of tensor
+ * @param arena Arena to allocate from
+ * @returns Pointer to new tensor
+ **/
+template <typename T, typename ShapeType,
+  std::enable_if_t< !is_matx_shape_v<ShapeType> &&
+                    !std::is_array_v<typename remove_cvref<ShapeType>::type>, bool> = true>
+auto make_tensor_p( ShapeType &&shape,
+                    Arena &arena) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+
+  constexpr int rank = static_cast<int>(cuda::std::tuple_size<typename remove_cvref<ShapeType>::type>::value);
+  DefaultDescriptor<rank> desc{std::move(shape)};
+
+  size_t size = static_cast<size_t>(desc.TotalSize()) * sizeof(T);
+  raw_pointer_buffer<T, matx_allocator<T>> rp(size, arena);
+  basic_storage<decltype(rp)> s{std::move(rp)};
+  return new tensor_t<T, rank, decltype(s), decltype(desc)>{std::move(s), std::move(desc)};
+}
+
+/**
+ * Create a tensor with a C array for the shape using host memory with a NUMA placement
+ *
+ * @param shape Shape of tensor
+ * @param numa NUMA placement of the tensor's pages
+ * @returns New tensor
+ **/
+template <typename T, int RANK>
+auto make_tensor( const index_t (&shape)[RANK],
+                  const HostNumaPolicy &numa) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+
+  T *ptr;
+  DefaultDescriptor<RANK> desc{shape};
+
+  size_t size = static_cast<size_t>(desc.TotalSize()) * sizeof(T);
+  matxAlloc((void**)&ptr, size, numa);
+
+  raw_pointer_buffer<T, matx_allocator<T>> rp(ptr, size, true);
+  basic_storage<decltype(rp)> s{std::move(rp)};
+  return tensor_t<T, RANK, decltype(s), decltype(desc)>{std::move(s), std::move(desc)};
+}
+
+/**
+ * Create a tensor with a C array for the shape using host memory with a NUMA placement
+ *
+ * @param tensor Tensor object to store newly-created tensor into
+ * @param shape Shape of tensor
+ * @param numa NUMA placement of the tensor's pages
+ **/
+template <typename TensorType, std::enable_if_t< is_tensor_view_v<TensorType>, bool> = true>
+void make_tensor( TensorType &tensor,
+                  const index_t (&shape)[TensorType::Rank()],
+                  const HostNumaPolicy &numa) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+
+  auto tmp = make_tensor<typename TensorType::value_type, TensorType::Rank()>(shape, numa);
+  tensor.Shallow(tmp);
+}
+
+/**
+ * Create a tensor from a conforming container type using host memory with a NUMA placement
+ *
+ * @param shape Shape of tensor
+ * @param numa NUMA placement of the tensor's pages
+ * @returns New tensor
+ **/
+template <typename T, typename ShapeType,
+  std::enable_if_t< !is_matx_shape_v<ShapeType> &&
+                    !is_matx_descriptor_v<ShapeType> &&
+                    !std::is_array_v<typename remove_cvref<ShapeType>::type>, bool> = true>
+auto make_tensor( ShapeType &&shape,
+                  const HostNumaPolicy &numa) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+
+  T *ptr;
+  constexpr int rank = static_cast<int>(cuda::std::tuple_size<typename remove_cvref<ShapeType>::type>::value);
+  DefaultDescriptor<rank> desc{std::move(shape)};
+
+  size_t size = static_cast<size_t>(desc.TotalSize()) * sizeof(T);
+  matxAlloc((void**)&ptr, size, numa);
+
+  raw_pointer_buffer<T, matx_allocator<T>> rp(ptr, size, true);
+  basic_storage<decltype(rp)> s{std::move(rp)};
+  return tensor_t<T, rank, decltype(s), decltype(desc)>{std::move(s), std::move(desc)};
+}
+
+/**
+ * Create a tensor from a conforming container type using host memory with a NUMA placement
+ *
+ * @param tensor Tensor object to store newly-created tensor into
+ * @param shape Shape of tensor
+ * @param numa NUMA placement of the tensor's pages
+ **/
+template <typename TensorType,typename ShapeType,
+  std::enable_if_t<is_tensor_view_v<TensorType> && !std::is_array_v<typename remove_cvref<ShapeType>::type>, bool> = true>
+auto make_tensor( TensorType &tensor,
+                  ShapeType &&shape,
+                  const HostNumaPolicy &numa) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+
+  auto tmp = make_tensor<typename TensorType::value_type, ShapeType>(std::forward<ShapeType>(shape), numa);
+  tensor.Shallow(tmp);
+}
+
 /**
  * Create a 0D tensor with implicitly-allocated memory.
  *
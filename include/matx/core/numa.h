@@ -0,0 +1,221 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "matx/core/error.h"
+#include "matx/executors/host_parallel.h"
+
+namespace matx {
+
+/**
+ * @brief Where the pages of a host allocation are placed on a NUMA system
+ */
+enum class HostNumaPlacement {
+  DEFAULT,     ///< Allocator's default: pages land on the node of whichever thread touches them first
+  FIRST_TOUCH, ///< Pages are touched in parallel using a host executor's static partition
+  NODE,        ///< Pages are bound to one node
+  INTERLEAVE,  ///< Pages are interleaved across all online nodes
+};
+
+/**
+ * @brief NUMA placement for MATX_HOST_MALLOC_MEMORY allocations
+ *
+ * Passed to make_tensor() in place of a memory space, or to HostExecParams for the host
+ * executor's temporaries. Allocations with a placement other than DEFAULT are page-aligned
+ * and tracked as MATX_HOST_MALLOC_MEMORY. Placement is best-effort: on systems without NUMA
+ * support the memory is still allocated, just without the binding.
+ */
+struct HostNumaPolicy {
+  HostNumaPlacement placement = HostNumaPlacement::DEFAULT;
+  int node = 0;    ///< Node for NODE placement
+  int threads = 1; ///< Threads touching the pages for FIRST_TOUCH placement
+
+  /**
+   * @brief Bind pages to one NUMA node
+   */
+  static HostNumaPolicy Node(int node) { return {HostNumaPlacement::NODE, node, 1}; }
+
+  /**
+   * @brief Interleave pages across all online NUMA nodes
+   */
+  static HostNumaPolicy Interleave() { return {HostNumaPlacement::INTERLEAVE, 0, 1}; }
+
+  /**
+   * @brief Touch pages in parallel so each lands on the node of the thread that will use it
+   *
+   * The pages are split the same way HostExecutor splits an expression's iterations, so a
+   * contiguous tensor that is later written by an executor with the same thread count is
+   * accessed from the local node.
+   */
+  static HostNumaPolicy FirstTouch(int threads) { return {HostNumaPlacement::FIRST_TOUCH, 0, threads}; }
+
+  /**
+   * @brief Touch pages in parallel using an executor's thread count
+   */
+  template <typename Executor>
+  static HostNumaPolicy FirstTouch(const Executor &exec) { return FirstTouch(exec.GetNumThreads()); }
+};
+
+namespace detail {
+
+__MATX_INLINE__ size_t HostPageBytes() {
+#ifdef __linux__
+  static const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return page;
+#else
+  return 4096;
+#endif
+}
+
+/**
+ * @brief Zero [0, bytes) of ptr on the host's threads
+ *
+ * The range is split by detail::HostParallelForBlocked, the same partition the host executor
+ * uses, so every page is first touched by the thread that later works on it.
+ */
+__MATX_INLINE__ void HostFirstTouch(void *ptr, size_t bytes, int threads) {
+  auto *p = static_cast<uint8_t *>(ptr);
+  HostParallelForBlocked(threads, static_cast<index_t>(bytes), [&](index_t begin, index_t end) {
+    memset(p + begin, 0, static_cast<size_t>(end - begin));
+  });
+}
+
+#ifdef __linux__
+// Node mask covering every node listed in /sys/devices/system/node/online (e.g. "0-1,4")
+__MATX_INLINE__ std::vector<unsigned long> HostOnlineNumaNodes(size_t words) {
+  std::vector<unsigned long> mask(words, 0);
+  std::ifstream file("/sys/devices/system/node/online");
+  std::string ranges;
+  if (!(file >> ranges)) {
+    mask[0] = 1;
+    return mask;
+  }
+
+  size_t pos = 0;
+  while (pos < ranges.size()) {
+    size_t end = ranges.find(',', pos);
+    if (end == std::string::npos) {
+      end = ranges.size();
+    }
+
+    const std::string range = ranges.substr(pos, end - pos);
+    const size_t dash = range.find('-');
+    const size_t first = std::stoul(range.substr(0, dash));
+    const size_t last = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+    for (size_t n = first; n <= last && n < words * 8 * sizeof(unsigned long); n++) {
+      mask[n / (8 * sizeof(unsigned long))] |= 1UL << (n % (8 * sizeof(unsigned long)));
+    }
+
+    pos = end + 1;
+  }
+
+  return mask;
+}
+#endif
+
+/**
+ * @brief Map page-aligned host memory and apply a NUMA placement to it
+ *
+ * @param bytes Size in bytes, rounded up to whole pages
+ * @param policy Placement
+ * @return Pointer to the memory, or nullptr if it could not be mapped
+ */
+__MATX_INLINE__ void *HostNumaAlloc(size_t bytes, const HostNumaPolicy &policy) {
+  const size_t len = (bytes + HostPageBytes() - 1) / HostPageBytes() * HostPageBytes();
+#ifdef __linux__
+  void *ptr = mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ptr == MAP_FAILED) {
+    return nullptr;
+  }
+
+#ifdef SYS_mbind
+  // Values of MPOL_BIND and MPOL_INTERLEAVE from <linux/mempolicy.h>
+  constexpr int mpol_bind = 2;
+  constexpr int mpol_interleave = 3;
+  constexpr size_t words = 1024 / (8 * sizeof(unsigned long));
+
+  if (policy.placement == HostNumaPlacement::NODE || policy.placement == HostNumaPlacement::INTERLEAVE) {
+    std::vector<unsigned long> mask(words, 0);
+    int mode = mpol_bind;
+    if (policy.placement == HostNumaPlacement::NODE) {
+      const auto node = static_cast<size_t>(policy.node);
+      MATX_ASSERT_STR(policy.node >= 0 && node < words * 8 * sizeof(unsigned long), matxInvalidParameter,
+        "NUMA node out of range");
+      mask[node / (8 * sizeof(unsigned long))] = 1UL << (node % (8 * sizeof(unsigned long)));
+    }
+    else {
+      mask = HostOnlineNumaNodes(words);
+      mode = mpol_interleave;
+    }
+
+    // Placement is best-effort, so a kernel or container without NUMA support keeps the mapping
+    [[maybe_unused]] auto ret = syscall(SYS_mbind, ptr, len, mode, mask.data(), words * 8 * sizeof(unsigned long), 0);
+  }
+#endif
+#else
+  void *ptr = std::aligned_alloc(HostPageBytes(), len);
+  if (ptr == nullptr) {
+    return nullptr;
+  }
+#endif
+
+  if (policy.placement == HostNumaPlacement::FIRST_TOUCH) {
+    HostFirstTouch(ptr, len, policy.threads);
+  }
+
+  return ptr;
+}
+
+__MATX_INLINE__ void HostNumaFree(void *ptr, [[maybe_unused]] size_t bytes) {
+#ifdef __linux__
+  munmap(ptr, (bytes + HostPageBytes() - 1) / HostPageBytes() * HostPageBytes());
+#else
+  free(ptr);
+#endif
+}
+
+} // end namespace detail
+
+} // end namespace matx
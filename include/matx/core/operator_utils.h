@@ -124,10 +124,27 @@ namespace matx {
         matxAlloc((void**)ptr, ttl_size, MATX_ASYNC_DEVICE_MEMORY, ex.getStream());
         make_tensor(tensor, *ptr, shape);
       }
-      else {        
-        matxAlloc((void**)ptr, ttl_size, MATX_HOST_MEMORY);
-        make_tensor(tensor, *ptr, shape);        
-      }  
+      else {
+        *ptr = static_cast<typename TensorType::value_type *>(ex.GetTempPool().allocate(static_cast<size_t>(ttl_size)));
+        make_tensor(tensor, *ptr, shape);
+      }
+    }
+
+    // Releases a temporary allocated by AllocateTempTensor. Host temporaries go back to the
+    // executor's pool for the next run.
+    template <typename T, typename Executor>
+    __MATX_HOST__ __MATX_INLINE__ void FreeTempTensor(T *ptr, Executor &&ex) {
+      if (ptr == nullptr) {
+        return;
+      }
+
+      if constexpr (is_host_executor_v<Executor>) {
+        if (ex.GetTempPool().deallocate(ptr)) {
+          return;
+        }
+      }
+
+      matxFree(ptr);
     }
 
     template <typename Op, typename ValidFunc>
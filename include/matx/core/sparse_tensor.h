@@ -112,9 +112,9 @@ public:
       : detail::tensor_impl_t<VAL, DIM, DimDesc,
                               detail::SparseTensorData<VAL, CRD, POS, TF>>(
             shape) {
-    values_ = std::move(vals);
+    SetVal(std::move(vals));
     for (int l = 0; l < LVL; l++) {
-      coordinates_[l] = std::move(crd[l]);
+      SetCrd(l, std::move(crd[l]));
       positions_[l] = std::move(pos[l]);
     }
     SetSparseDataImpl();
@@ -124,13 +124,23 @@ public:
   __MATX_INLINE__ ~sparse_tensor_t() = default;
 
   // Sets value storage.
-  __MATX_INLINE__ void SetVal(StorageV &&val) { values_ = std::move(val); }
+  __MATX_INLINE__ void SetVal(StorageV &&val) {
+    values_ = std::move(val);
+    nse_ = NseCapacity();
+  }
 
   // Sets coordinates storage.
   __MATX_INLINE__ void SetCrd(int l, StorageC &&crd) {
     coordinates_[l] = std::move(crd);
+    crd_size_[l] = crdCapacity(l);
   }
 
+  // Sets the number of stored elements (or coordinates at level l) within
+  // the current storage, which may be larger. This lets a conversion refill
+  // a preallocated tensor without replacing the buffers it references.
+  __MATX_INLINE__ void SetNse(index_t nse) { nse_ = nse; }
+  __MATX_INLINE__ void SetCrdSize(int l, index_t sz) { crd_size_[l] = sz; }
+
   // Sets positions storage.
   __MATX_INLINE__ void SetPos(int l, StorageP &&pos) {
     positions_[l] = std::move(pos);
@@ -162,15 +172,19 @@ public:
   }
 
   // Size getters.
-  index_t Nse() const {
+  index_t Nse() const { return nse_; }
+  index_t crdSize(int l) const { return crd_size_[l]; }
+  index_t posSize(int l) const {
+    return static_cast<index_t>(positions_[l].size() / sizeof(POS));
+  }
+
+  // Capacity getters (elements the storage can hold).
+  index_t NseCapacity() const {
     return static_cast<index_t>(values_.size() / sizeof(VAL));
   }
-  index_t crdSize(int l) const {
+  index_t crdCapacity(int l) const {
     return static_cast<index_t>(coordinates_[l].size() / sizeof(CRD));
   }
-  index_t posSize(int l) const {
-    return static_cast<index_t>(positions_[l].size() / sizeof(POS));
-  }
 
 private:
   // Primary storage of sparse tensor (explicitly stored element values).
@@ -182,6 +196,10 @@ private:
   // where in the original tensor the explicitly stored elements reside.
   StorageC coordinates_[LVL];
   StorageP positions_[LVL];
+
+  // Number of values and coordinates in use, which is at most the capacity.
+  index_t nse_ = 0;
+  index_t crd_size_[LVL] = {};
 };
 
 } // end namespace experimental
@@ -211,6 +211,22 @@ public:
     return false;
   }
 
+  static constexpr bool isBSR() {
+    if constexpr (DIM == 2 && LVL == 4) {
+      using type0 = cuda::std::tuple_element_t<0, LvlSpecs>;
+      using type1 = cuda::std::tuple_element_t<1, LvlSpecs>;
+      using type2 = cuda::std::tuple_element_t<2, LvlSpecs>;
+      using type3 = cuda::std::tuple_element_t<3, LvlSpecs>;
+      return type0::Expr::op == LvlOp::Div && type0::Expr::di == 0 &&
+             type0::Type::isDense() && type1::Expr::op == LvlOp::Div &&
+             type1::Expr::di == 1 && type1::Type::isCompressed() &&
+             type2::Expr::op == LvlOp::Mod && type2::Expr::di == 0 &&
+             type2::Type::isDense() && type3::Expr::op == LvlOp::Mod &&
+             type3::Expr::di == 1 && type3::Type::isDense();
+    }
+    return false;
+  }
+
   static constexpr bool isBatchedDIAIUniform() {
     if constexpr (DIM == 3 && LVL == 3) {
       using type0 = cuda::std::tuple_element_t<0, LvlSpecs>;
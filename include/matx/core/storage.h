@@ -34,6 +34,7 @@
 
 #include "matx/core/type_utils.h"
 #include "matx/core/allocator.h"
+#include "matx/core/arena.h"
 #include "matx/core/error.h"
 
 namespace matx
@@ -81,6 +82,18 @@ namespace matx
       ConfigureShared(ptr, size);  
     }
 
+    /**
+     * @brief Construct a new raw pointer buffer object with space taken from an arena
+     *
+     * The buffer does not own the memory. It is released when the arena is reset.
+     *
+     * @param size Size of allocation
+     * @param arena Arena to allocate from
+     */
+    raw_pointer_buffer(size_t size, Arena &arena) : size_(size), owning_(false) {
+      ConfigureShared(static_cast<T *>(arena.allocate(size)), size);
+    }
+
     /**
      * @brief Default copy constructor
      * 
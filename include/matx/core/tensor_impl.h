@@ -1185,6 +1185,25 @@ MATX_IGNORE_WARNING_POP_GCC
 
         return static_cast<detail::ElementsPerThread>(width);
       }
+      else if constexpr (Cap == detail::OperatorCapability::ACCESSED_MEMORY) {
+        detail::MemoryRange range;
+        if (data_.ldata_ == nullptr || TotalSize() == 0) {
+          return range;
+        }
+
+        // Strides may be negative, so extend either end of the first element by each dimension's span
+        intptr_t lo = 0;
+        intptr_t hi = 0;
+        for (int d = 0; d < Rank(); d++) {
+          const intptr_t span = static_cast<intptr_t>((Size(d) - 1) * Stride(d));
+          (span < 0 ? lo : hi) += span;
+        }
+
+        const auto base = reinterpret_cast<intptr_t>(data_.ldata_);
+        range.begin = static_cast<uintptr_t>(base + lo * static_cast<intptr_t>(sizeof(T)));
+        range.end = static_cast<uintptr_t>(base + (hi + 1) * static_cast<intptr_t>(sizeof(T)));
+        return range;
+      }
       else {
         return capability_attributes<Cap>::default_value;
       }
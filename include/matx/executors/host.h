@@ -31,11 +31,17 @@
 /////////////////////////////////////////////////////////////////////////////////
 
 #pragma once
+#include <algorithm>
+#include <memory>
+#include <mutex>
 #include <type_traits>
+#include <vector>
 #include <cuda/std/array>
 
+#include "matx/core/allocator.h"
 #include "matx/core/error.h"
 #include "matx/core/get_grid_dims.h"
+#include "matx/executors/host_parallel.h"
 #ifdef MATX_EN_OMP
 #include <omp.h>
 #endif
@@ -57,21 +63,46 @@ enum class ThreadsMode {
   ALL,
 };
 
+/**
+ * Planner effort for host FFT plans made by FFTW. Efforts above ESTIMATE time
+ * candidate algorithms when a plan is first created, so that first call is slower
+ * and every transform reusing the plan is faster. DEFAULT uses the global effort
+ * set with matxSetFFTWPlannerEffort().
+ */
+enum class FFTWPlannerEffort {
+  DEFAULT,
+  ESTIMATE,
+  MEASURE,
+  PATIENT,
+  EXHAUSTIVE,
+};
+
 struct HostExecParams {
-  HostExecParams(int threads = 1) : threads_(threads) {}
+  HostExecParams(int threads = 1, FFTWPlannerEffort fftw_effort = FFTWPlannerEffort::DEFAULT,
+                 HostNumaPolicy numa = {}) :
+    threads_(threads), fftw_effort_(fftw_effort), numa_(numa) {}
   HostExecParams(host_cpu_set_t cpu_set) : threads_(1), cpu_set_(cpu_set) {
     MATX_ASSERT_STR(false, matxNotSupported, "CPU affinity not supported yet");
   }
 
   int GetNumThreads() const { return threads_; }
+  FFTWPlannerEffort GetFFTWPlannerEffort() const { return fftw_effort_; }
+  HostNumaPolicy GetNumaPolicy() const { return numa_; }
 
   private:
     int threads_;
+    FFTWPlannerEffort fftw_effort_ = FFTWPlannerEffort::DEFAULT;
+    HostNumaPolicy numa_;
 MATX_IGNORE_WARNING_PUSH_CLANG("-Wunused-private-field")    
     host_cpu_set_t cpu_set_ {0};
 MATX_IGNORE_WARNING_POP_CLANG
 };
 
+namespace detail {
+template <typename Op, typename Func>
+__MATX_INLINE__ void HostForEachIndex(const Op &op, index_t begin, index_t end, Func &&func);
+}
+
 /**
  * @brief Executor for running an operator on a single or multi-threaded host
  *
@@ -95,13 +126,14 @@ class HostExecutor {
 #endif
       }
       params_ = HostExecParams(n_threads);
+      temp_pool_ = MakeTempPool();
 
 #ifdef MATX_EN_OMP
       omp_set_num_threads(params_.GetNumThreads());
 #endif
     }
 
-    HostExecutor(const HostExecParams &params) : params_(params) {
+    HostExecutor(const HostExecParams &params) : params_(params), temp_pool_(MakeTempPool()) {
 #ifdef MATX_EN_OMP
       omp_set_num_threads(params_.GetNumThreads());
 #endif
@@ -150,33 +182,52 @@ class HostExecutor {
         op();
       }
       else {
-        index_t size = TotalSize(op);
-  #ifdef MATX_EN_OMP
-        if (params_.GetNumThreads() > 1) {
-          #pragma omp parallel for num_threads(params_.GetNumThreads())
-          for (index_t i = 0; i < size; i++) {
-            auto idx = GetIdxFromAbs(op, i);
+        // Each thread walks its block one innermost-dimension run at a time, so the
+        // inner loop is a plain counter the compiler can vectorize (e.g. the half <-> float
+        // conversions of expressions on half tensors).
+        detail::HostParallelForBlocked(params_.GetNumThreads(), TotalSize(op), [&](index_t begin, index_t end) {
+          detail::HostForEachIndex(op, begin, end, [&](index_t, const auto &idx) {
             cuda::std::apply([&](auto... args) {
               return op(args...);
             }, idx);
-          }
-        } else
-  #endif
-        {
-          for (index_t i = 0; i < size; i++) {
-            auto idx = GetIdxFromAbs(op, i);
-            cuda::std::apply([&](auto... args) {
-              return op(args...);
-            }, idx);
-          }
-        }
+          });
+        });
       }
     }
 
     int GetNumThreads() const { return params_.GetNumThreads(); }
 
+    /**
+     * @brief FFTW planner effort requested for this executor's FFTs
+     */
+    FFTWPlannerEffort GetFFTWPlannerEffort() const { return params_.GetFFTWPlannerEffort(); }
+
+    /**
+     * @brief Pool that transform operators draw their temporary outputs from
+     *
+     * Copies of an executor share the same pool. Temporaries are pageable host memory placed
+     * by the executor's NUMA policy, and blocks released at the end of a run() are reused by
+     * the next one.
+     */
+    detail::TempBufferPool &GetTempPool() const { return *temp_pool_; }
+
+    /**
+     * @brief Free the temporary buffers cached by this executor that are not in use
+     */
+    void ReleaseTempBuffers() const { temp_pool_->Release(); }
+
     private:
+      std::shared_ptr<detail::TempBufferPool> MakeTempPool() const {
+        auto numa = params_.GetNumaPolicy();
+        if (numa.placement == HostNumaPlacement::FIRST_TOUCH) {
+          numa.threads = params_.GetNumThreads();
+        }
+
+        return std::make_shared<detail::TempBufferPool>(MATX_HOST_MALLOC_MEMORY, numa);
+      }
+
       HostExecParams params_;
+      std::shared_ptr<detail::TempBufferPool> temp_pool_;
       std::chrono::time_point<std::chrono::high_resolution_clock> start_;
       std::chrono::time_point<std::chrono::high_resolution_clock> stop_;
 };
@@ -185,4 +236,161 @@ using SingleThreadedHostExecutor = HostExecutor<ThreadsMode::SINGLE>;
 using SelectThreadsHostExecutor  = HostExecutor<ThreadsMode::SELECT>;
 using AllThreadsHostExecutor     = HostExecutor<ThreadsMode::ALL>;
 
+namespace detail {
+
+/**
+ * @brief Call a function on each index of an operator in [begin, end) of its flattened range
+ *
+ * The index is only decomposed from the absolute position at the start of each run along
+ * the innermost dimension; the rest of the run just steps the last index.
+ *
+ * @tparam Op Operator type
+ * @tparam Func Callable taking (index_t abs, const cuda::std::array<index_t, Op::Rank()> &idx)
+ * @param op Operator whose shape is walked
+ * @param begin First absolute index
+ * @param end One past the last absolute index
+ * @param func Function to call on each index
+ */
+template <typename Op, typename Func>
+__MATX_INLINE__ void HostForEachIndex(const Op &op, index_t begin, index_t end, Func &&func)
+{
+  constexpr int LAST = Op::Rank() - 1;
+  const index_t inner = op.Size(LAST);
+
+  index_t i = begin;
+  while (i < end) {
+    auto idx = GetIdxFromAbs(op, i);
+    const index_t first = idx[LAST];
+    const index_t run = std::min(end - i, inner - first);
+    for (index_t j = 0; j < run; j++) {
+      idx[LAST] = first + j;
+      func(i + j, idx);
+    }
+    i += run;
+  }
+}
+
+/**
+ * @brief Replace counts in data[0, n) with their exclusive prefix sum on the host's threads
+ *
+ * Each thread sums its own contiguous block, the block totals are scanned serially, and
+ * each block is then scanned locally from its starting offset.
+ *
+ * @tparam T Integral type of the counts
+ * @param num_threads Number of threads to use
+ * @param data Counts to scan in place
+ * @param n Number of counts
+ * @return Sum of all counts
+ */
+template <typename T>
+__MATX_INLINE__ T HostParallelExclusiveScan(int num_threads, T *data, index_t n)
+{
+  const index_t blocks = std::max(index_t{1}, std::min(static_cast<index_t>(num_threads), n));
+  std::vector<T> sums(blocks + 1, T{0});
+
+  HostParallelForBlocked(num_threads, blocks, [&](index_t b0, index_t b1) {
+    for (index_t b = b0; b < b1; b++) {
+      T sum{0};
+      for (index_t i = (n * b) / blocks; i < (n * (b + 1)) / blocks; i++) {
+        sum += data[i];
+      }
+      sums[b + 1] = sum;
+    }
+  });
+
+  for (index_t b = 0; b < blocks; b++) {
+    sums[b + 1] += sums[b];
+  }
+
+  HostParallelForBlocked(num_threads, blocks, [&](index_t b0, index_t b1) {
+    for (index_t b = b0; b < b1; b++) {
+      T run = sums[b];
+      for (index_t i = (n * b) / blocks; i < (n * (b + 1)) / blocks; i++) {
+        const T cnt = data[i];
+        data[i] = run;
+        run += cnt;
+      }
+    }
+  });
+
+  return sums[blocks];
+}
+
+// Tags for host math libraries that keep one process-wide thread count
+struct HostLibOpenBLAS {};
+struct HostLibBLIS {};
+
+/**
+ * @brief Process-wide thread count of a host math library, shared by all executors
+ *
+ * OpenBLAS and BLIS keep a single global thread count. Batched calls limit it to one while
+ * their own threads run. If each caller saved and restored the count itself, executors
+ * running on different threads could leave each other's setting wrong. Serial sections of
+ * the same library share one count instead: the first to start saves the setting and
+ * limits it to one, and the last to end restores it. Set() only takes effect outside any
+ * serial section.
+ *
+ * @tparam Lib Library tag
+ */
+template <typename Lib>
+class HostLibThreads {
+  public:
+    using GetFn = int (*)();
+    using SetFn = void (*)(int);
+
+    /**
+     * @brief Holds the library at one thread for its lifetime
+     */
+    class Serial {
+      public:
+        Serial(GetFn get, SetFn set) : set_(set) {
+          auto &state = State();
+          std::lock_guard<std::mutex> lock(state.mtx);
+          if (state.depth++ == 0) {
+            state.saved = get();
+            set(1);
+          }
+        }
+
+        ~Serial() {
+          auto &state = State();
+          std::lock_guard<std::mutex> lock(state.mtx);
+          if (--state.depth == 0) {
+            set_(state.saved);
+          }
+        }
+
+        Serial(const Serial &) = delete;
+        Serial &operator=(const Serial &) = delete;
+
+      private:
+        SetFn set_;
+    };
+
+    /**
+     * @brief Set the library's thread count unless a serial section is running
+     */
+    static void Set(SetFn set, int threads) {
+      auto &state = State();
+      std::lock_guard<std::mutex> lock(state.mtx);
+      if (state.depth == 0) {
+        set(threads);
+      }
+    }
+
+  private:
+    struct StateType {
+      std::mutex mtx;
+      int depth = 0;
+      int saved = 1;
+    };
+
+    static StateType &State() {
+      static StateType state;
+      return state;
+    }
+};
+
+} // end namespace detail
+
 }
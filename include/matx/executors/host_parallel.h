@@ -0,0 +1,81 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <algorithm>
+
+#include "matx/core/defines.h"
+#ifdef MATX_EN_OMP
+#include <omp.h>
+#endif
+
+namespace matx {
+namespace detail {
+
+/**
+ * @brief Run a function over contiguous blocks of [0, n) on the host's threads
+ *
+ * The range is split statically into one contiguous block per thread, and func(begin, end)
+ * is called once per block. Callers that need scratch space allocate it once at the top of
+ * func rather than once per iteration.
+ *
+ * @tparam Func Callable taking (index_t begin, index_t end)
+ * @param num_threads Number of threads to use
+ * @param n Total number of iterations
+ * @param func Function to call on each block
+ */
+template <typename Func>
+__MATX_INLINE__ void HostParallelForBlocked([[maybe_unused]] int num_threads, index_t n, Func &&func)
+{
+  if (n <= 0) {
+    return;
+  }
+
+#ifdef MATX_EN_OMP
+  const index_t blocks = std::min(static_cast<index_t>(num_threads), n);
+  if (blocks > 1) {
+    #pragma omp parallel for num_threads(static_cast<int>(blocks)) schedule(static, 1)
+    for (index_t blk = 0; blk < blocks; blk++) {
+      const index_t begin = (n * blk) / blocks;
+      const index_t end = (n * (blk + 1)) / blocks;
+      func(begin, end);
+    }
+    return;
+  }
+#endif
+
+  func(static_cast<index_t>(0), n);
+}
+
+} // end namespace detail
+} // end namespace matx
@@ -67,18 +67,11 @@ namespace matx {
   #define MATX_EN_CUDSS_SOLVER 0
 #endif
 
+// Host executors fall back to the built-in FFT without NVPL or FFTW and for half types,
+// so every executor and type combination is supported
 template <typename Exec, typename T>
 constexpr bool CheckFFTSupport() {
-  if constexpr (is_host_executor_v<Exec>) {
-    if constexpr (is_complex_half_v<T>) {
-      return false;
-    } else {
-      return MATX_EN_CPU_FFT;
-    }
-  }
-  else {
-    return true;
-  }
+  return true;
 }
 
 template <typename Exec>
@@ -117,8 +110,11 @@ constexpr bool CheckMatMulSupport() {
     if constexpr (std::is_same_v<T, float> ||
                   std::is_same_v<T, double> ||
                   std::is_same_v<T, cuda::std::complex<float>> ||
-                  std::is_same_v<T, cuda::std::complex<double>>) {
-      return MATX_EN_CPU_MATMUL;
+                  std::is_same_v<T, cuda::std::complex<double>> ||
+                  is_matx_half_v<T> || is_complex_half_v<T>) {
+      // Falls back to the built-in GEMM when no BLAS library is configured,
+      // and always uses it for half types
+      return true;
     } else {
       return false;
     }
@@ -140,7 +136,7 @@ constexpr bool CheckSolverSupport() {
 template <typename Exec>
 constexpr bool CheckDssSolverSupport() {
   if constexpr (is_host_executor_v<Exec>) {
-    return false;
+    return true;
   } else {
     return MATX_EN_CUDSS_SOLVER;
   }
@@ -33,6 +33,7 @@
 #pragma once
 
 #include "matx/core/error.h"
+#include <cuda/std/array>
 #include <cuda/std/complex>
 #include <curand_kernel.h>
 #include <type_traits>
@@ -162,6 +163,123 @@ __MATX_INLINE__ __MATX_DEVICE__ void get_random(cuda::std::complex<double> &val,
   }
 };
 
+namespace detail {
+
+/**
+ * @brief Philox4x32-10 counter-based random number generator
+ *
+ * Each (counter, key) pair maps to four independent 32-bit outputs with no state carried
+ * between calls, so any element of a random operator can be generated independently of the
+ * others. Host executors use this generator: results are reproducible regardless of the
+ * number of threads, and the generation loop has no serial dependency.
+ */
+struct Philox4x32_10 {
+  static constexpr uint32_t M0 = 0xD2511F53;
+  static constexpr uint32_t M1 = 0xCD9E8D57;
+  static constexpr uint32_t W0 = 0x9E3779B9;
+  static constexpr uint32_t W1 = 0xBB67AE85;
+  static constexpr int ROUNDS = 10;
+
+  static __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ cuda::std::array<uint32_t, 4> Generate(uint64_t counter, uint64_t key)
+  {
+    cuda::std::array<uint32_t, 4> ctr{static_cast<uint32_t>(counter), static_cast<uint32_t>(counter >> 32), 0, 0};
+    uint32_t k0 = static_cast<uint32_t>(key);
+    uint32_t k1 = static_cast<uint32_t>(key >> 32);
+
+    #pragma unroll
+    for (int r = 0; r < ROUNDS; r++) {
+      const uint64_t p0 = static_cast<uint64_t>(M0) * ctr[0];
+      const uint64_t p1 = static_cast<uint64_t>(M1) * ctr[2];
+      ctr = {static_cast<uint32_t>(p1 >> 32) ^ ctr[1] ^ k0,
+             static_cast<uint32_t>(p1),
+             static_cast<uint32_t>(p0 >> 32) ^ ctr[3] ^ k1,
+             static_cast<uint32_t>(p0)};
+      k0 += W0;
+      k1 += W1;
+    }
+
+    return ctr;
+  }
+};
+
+// Uniform in (0, 1], matching the range of curand_uniform
+__MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ float philox_uniform_float(uint32_t x)
+{
+  return static_cast<float>((x >> 8) + 1) * (1.0f / 16777216.0f);
+}
+
+__MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ double philox_uniform_double(uint32_t hi, uint32_t lo)
+{
+  const uint64_t x = ((static_cast<uint64_t>(hi) << 32) | lo) >> 11;
+  return static_cast<double>(x + 1) * (1.0 / 9007199254740992.0);
+}
+
+// Box-Muller transform of two uniforms in (0, 1] into two standard normals
+template <typename T>
+__MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ void philox_box_muller(T u1, T u2, T &z0, T &z1)
+{
+  constexpr T two_pi = static_cast<T>(6.283185307179586476925286766559);
+  const T r = cuda::std::sqrt(static_cast<T>(-2) * cuda::std::log(u1));
+  z0 = r * cuda::std::cos(two_pi * u2);
+  z1 = r * cuda::std::sin(two_pi * u2);
+}
+
+/**
+ * @brief Get the random number for a single element from the counter-based generator
+ *
+ * @tparam T Type of value
+ * @param val Value to store in
+ * @param counter Element counter
+ * @param seed Random seed used as the generator key
+ * @param dist Distribution
+ */
+template <typename T>
+__MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ void get_random_philox(T &val, uint64_t counter, uint64_t seed, Distribution_t dist)
+{
+  const auto r = Philox4x32_10::Generate(counter, seed);
+
+  if constexpr (std::is_same_v<T, float>) {
+    if (dist == UNIFORM) {
+      val = philox_uniform_float(r[0]);
+    }
+    else {
+      float z1;
+      philox_box_muller(philox_uniform_float(r[0]), philox_uniform_float(r[1]), val, z1);
+    }
+  }
+  else if constexpr (std::is_same_v<T, double>) {
+    if (dist == UNIFORM) {
+      val = philox_uniform_double(r[0], r[1]);
+    }
+    else {
+      double z1;
+      philox_box_muller(philox_uniform_double(r[0], r[1]), philox_uniform_double(r[2], r[3]), val, z1);
+    }
+  }
+  else if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
+    if (dist == UNIFORM) {
+      val = {philox_uniform_float(r[0]), philox_uniform_float(r[1])};
+    }
+    else {
+      float z0, z1;
+      philox_box_muller(philox_uniform_float(r[0]), philox_uniform_float(r[1]), z0, z1);
+      val = {z0, z1};
+    }
+  }
+  else if constexpr (std::is_same_v<T, cuda::std::complex<double>>) {
+    if (dist == UNIFORM) {
+      val = {philox_uniform_double(r[0], r[1]), philox_uniform_double(r[2], r[3])};
+    }
+    else {
+      double z0, z1;
+      philox_box_muller(philox_uniform_double(r[0], r[1]), philox_uniform_double(r[2], r[3]), z0, z1);
+      val = {z0, z1};
+    }
+  }
+}
+
+} // end namespace detail
+
 /**
  * Generates random numbers
  *
@@ -237,6 +355,7 @@ namespace detail {
       index_t total_size_;
       mutable curandStatePhilox4_32_10_t *states_;
       uint64_t seed_;     
+      mutable uint64_t offset_ = 0; // Host counter offset, advanced after each run
       mutable bool init_ = false;
       mutable bool device_;
       
@@ -244,10 +363,6 @@ namespace detail {
         randFloatParams<inner_t> fParams_;
         randIntParams<inner_t>   iParams_;
       };
-      
-      // Used by host operators only
-      mutable curandGenerator_t gen_;
-      //T val;
 
 
     public:
@@ -330,22 +445,7 @@ namespace detail {
           }
         }
 #endif          
-        if constexpr (is_host_executor_v<Executor>) {
-          if (!init_) {
-            [[maybe_unused]] curandStatus_t ret;
-
-            ret = curandCreateGeneratorHost(&gen_, CURAND_RNG_PSEUDO_MT19937);
-            MATX_ASSERT_STR_EXP(ret, CURAND_STATUS_SUCCESS, matxCudaError, "Failed to create random number generator");
-
-            ret = curandSetPseudoRandomGeneratorSeed(gen_, seed_);
-            MATX_ASSERT_STR_EXP(ret, CURAND_STATUS_SUCCESS, matxCudaError, "Error setting random seed");
-
-            // In the future we may allocate a buffer, but for now we generate a single number at a time
-            // matxAlloc((void **)&val, total_size_ * sizeof(T), MATX_HOST_MEMORY, stream);
-            init_   = true;
-            device_ = false;
-          }
-        }
+        // Host executors use a stateless counter-based generator, so there is nothing to set up
       }
 
       template <typename ST, typename Executor>
@@ -354,9 +454,9 @@ namespace detail {
         if constexpr (is_cuda_executor_v<Executor>) {
           matxFree(states_);
         }
-        else if constexpr (is_host_executor_v<Executor>) {
-          curandDestroyGenerator(gen_);
-          //matxFree(val);
+        else {
+          // Move past the counters used by this run so the next run draws new numbers
+          offset_ += static_cast<uint64_t>(total_size_);
         }
       }
 
@@ -416,75 +516,38 @@ namespace detail {
         }
 
 #else
-        if constexpr (
-                     std::is_same_v<T, float>  ||
-                     std::is_same_v<T, double> || 
-                     std::is_same_v<T, cuda::std::complex<float>> ||
-                     std::is_same_v<T, cuda::std::complex<double>>
-                     ) 
-        {        
-          
-          if (fParams_.dist_ == UNIFORM) {
-            if constexpr (std::is_same_v<T, float>) {
-              curandGenerateUniform(gen_, &val.data[0], static_cast<int>(EPT));
-            }
-            else if constexpr (std::is_same_v<T, double>) {
-              curandGenerateUniformDouble(gen_, &val.data[0], static_cast<int>(EPT));
-            }
-            else if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
-              curandGenerateUniform(gen_, reinterpret_cast<float*>(&val.data[0]), static_cast<int>(EPT) * 2);
-            }
-            else if constexpr (std::is_same_v<T, cuda::std::complex<double>>) {
-              curandGenerateUniformDouble(gen_, reinterpret_cast<double*>(&val.data[0]), static_cast<int>(EPT) * 2);
-            }
-
-            #pragma unroll
-            for (int i = 0; i < static_cast<int>(EPT); ++i) {
-              val.data[i] = fParams_.alpha_ * val.data[i] + fParams_.beta_;
-            }
-          }
-          else if (fParams_.dist_ == NORMAL) {
-            if constexpr (std::is_same_v<T, float>) {
-              curandGenerateNormal(gen_, &val.data[0], static_cast<int>(EPT), fParams_.beta_, fParams_.alpha_);
-            }
-            else if constexpr (std::is_same_v<T, double>) {
-              curandGenerateNormalDouble(gen_, &val.data[0], static_cast<int>(EPT), fParams_.beta_, fParams_.alpha_);
-            }
-            else if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
-              curandGenerateNormal(gen_, reinterpret_cast<float*>(&val.data[0]), static_cast<int>(EPT) * 2, fParams_.beta_, fParams_.alpha_);
-            }
-            else if constexpr (std::is_same_v<T, cuda::std::complex<double>>) {
-              curandGenerateNormalDouble(gen_, reinterpret_cast<double*>(&val.data[0]), static_cast<int>(EPT) * 2, fParams_.beta_, fParams_.alpha_);
-            }
+        // Each element maps to its own counter, so elements can be generated in any order and
+        // on any thread while giving the same result. The run offset gives each run of the
+        // operator its own block of counters.
+        const index_t base = static_cast<int>(EPT) * GetValC<0, Is...>(cuda::std::make_tuple(indices...));
 
-            #pragma unroll
-            for (int i = 0; i < static_cast<int>(EPT); ++i) {
-              val.data[i] = fParams_.alpha_ * val.data[i] + fParams_.beta_;
-            }
-          }
-          else {
-            #pragma unroll
-            for (int i = 0; i < static_cast<int>(EPT); ++i) {
-              val.data[i] = 0;
-            }
+        #pragma unroll
+        for (int i = 0; i < static_cast<int>(EPT); ++i) {
+          const uint64_t counter = offset_ + static_cast<uint64_t>(base + i);
+          if constexpr (
+                       std::is_same_v<T, float>  ||
+                       std::is_same_v<T, double> || 
+                       std::is_same_v<T, cuda::std::complex<float>> ||
+                       std::is_same_v<T, cuda::std::complex<double>>
+                       ) 
+          {
+            detail::get_random_philox(val.data[i], counter, seed_, fParams_.dist_);
+            val.data[i] = fParams_.alpha_ * val.data[i] + fParams_.beta_;
           }
-        }
-        else if constexpr(
-                         std::is_same_v<T, uint32_t> || 
-                         std::is_same_v<T,  int32_t> ||
-                         std::is_same_v<T, uint64_t> ||
-                         std::is_same_v<T,  int64_t>   
-                         )
-        {
-          #pragma unroll
-          for (int i = 0; i < static_cast<int>(EPT); ++i) {
+          else if constexpr(
+                           std::is_same_v<T, uint32_t> || 
+                           std::is_same_v<T,  int32_t> ||
+                           std::is_same_v<T, uint64_t> ||
+                           std::is_same_v<T,  int64_t>   
+                           )
+          {
             float fScale;
-            curandGenerateUniform(gen_, &fScale, 1);
-                    
+            detail::get_random_philox(fScale, counter, seed_, UNIFORM);
+
             // Scale to the provided min and max range
             double fMax = static_cast<double>(iParams_.max_);
             double fMin = static_cast<double>(iParams_.min_);
-            val.data[i] = static_cast<T>(fScale * (fMax - fMin) + fMin);                                
+            val.data[i] = static_cast<T>(fScale * (fMax - fMin) + fMin);
           }
         }
 #endif
@@ -160,7 +160,7 @@ namespace matx
             y_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
           }
 
-          matxFree(ptr); 
+          detail::FreeTempTensor(ptr, std::forward<Executor>(ex)); 
         }            
     };
   }
@@ -119,7 +119,7 @@ namespace detail {
           a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }
 
-        matxFree(ptr);
+        detail::FreeTempTensor(ptr, std::forward<Executor>(ex));
       }      
 
       constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
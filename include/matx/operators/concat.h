@@ -178,10 +178,7 @@ namespace matx
           return ElementsPerThread::ONE;
         } else {
           auto self_has_cap = capability_attributes<Cap>::default_value;
-          return self_has_cap;
-          // static_assert(sizeof...(Ts) > 1, ...); ensures ops_ is not empty.
-          // auto all_ops_cap = get_combined_ops_capability<Cap>(cuda::std::make_index_sequence<sizeof...(Ts)>{});
-          // return combine_capabilities<Cap>(self_has_cap, all_ops_cap);
+          return combine_capabilities<Cap>(self_has_cap, get_combined_ops_capability<Cap>(ops_));
         }
       }
 
@@ -262,6 +259,17 @@ namespace matx
       cuda::std::tuple<typename detail::base_type_t<Ts> ...> ops_;
       index_t size_;
       int axis_;
+
+      template <OperatorCapability Cap, size_t I = 0>
+      __MATX_INLINE__ __MATX_HOST__ auto get_combined_ops_capability(const cuda::std::tuple<typename detail::base_type_t<Ts>...>& ops) const {
+        if constexpr (I == sizeof...(Ts)) {
+          return capability_attributes<Cap>::default_value;
+        } else {
+          auto current_cap = detail::get_operator_capability<Cap>(cuda::std::get<I>(ops));
+          auto rest_cap = get_combined_ops_capability<Cap, I + 1>(ops);
+          return combine_capabilities<Cap>(current_cap, rest_cap);
+        }
+      }
     }; // end class ConcatOp
   } // end namespace detail
 
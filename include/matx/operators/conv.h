@@ -212,7 +212,7 @@ namespace matx
             b_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
           } 
 
-          matxFree(ptr);
+          detail::FreeTempTensor(ptr, std::forward<Executor>(ex));
         }  
     };
   }
@@ -422,7 +422,7 @@ namespace detail {
           b_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         } 
 
-        matxFree(ptr);
+        detail::FreeTempTensor(ptr, std::forward<Executor>(ex));
       }       
     };
   }
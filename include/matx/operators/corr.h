@@ -199,7 +199,7 @@ namespace matx
             b_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
           } 
 
-          matxFree(ptr);
+          detail::FreeTempTensor(ptr, std::forward<Executor>(ex));
         }          
     };
   }
@@ -127,7 +127,7 @@ namespace matx
             a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
           }
 
-          matxFree(ptr);
+          detail::FreeTempTensor(ptr, std::forward<Executor>(ex));
         }          
     };
   }
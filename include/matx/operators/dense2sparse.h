@@ -36,6 +36,7 @@
 #include "matx/core/type_utils.h"
 #include "matx/operators/base_operator.h"
 #include "matx/transforms/convert/dense2sparse_cusparse.h"
+#include "matx/transforms/convert/dense2sparse_host.h"
 
 namespace matx {
 namespace detail {
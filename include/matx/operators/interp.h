@@ -180,11 +180,56 @@ namespace matx {
     };
 
 
+    // Solves a batch of tridiagonal systems on the host with the Thomas algorithm. The
+    // diagonals and right-hand side are stored contiguously with a stride of n per batch,
+    // matching the layout cuSPARSE's gtsv2StridedBatch uses on the device. d and b are
+    // overwritten, and the solution is returned in b.
+    template <typename T>
+    __MATX_INLINE__ void InterpSplineTridiagonalSolveHost(const T *dl, T *d, const T *du, T *b,
+                                                          index_t n, index_t batch_count,
+                                                          [[maybe_unused]] int num_threads)
+    {
+      const auto solve_batch = [&](index_t batch) {
+        const T *bdl = dl + batch * n;
+        T *bd = d + batch * n;
+        const T *bdu = du + batch * n;
+        T *bb = b + batch * n;
+
+        // Forward elimination
+        for (index_t i = 1; i < n; i++) {
+          const T w = bdl[i] / bd[i - 1];
+          bd[i] -= w * bdu[i - 1];
+          bb[i] -= w * bb[i - 1];
+        }
+
+        // Back substitution
+        bb[n - 1] /= bd[n - 1];
+        for (index_t i = n - 2; i >= 0; i--) {
+          bb[i] = (bb[i] - bdu[i] * bb[i + 1]) / bd[i];
+        }
+      };
+
+#ifdef MATX_EN_OMP
+      if (num_threads > 1 && batch_count > 1) {
+        #pragma omp parallel for num_threads(num_threads)
+        for (index_t batch = 0; batch < batch_count; batch++) {
+          solve_batch(batch);
+        }
+      } else
+#endif
+      {
+        for (index_t batch = 0; batch < batch_count; batch++) {
+          solve_batch(batch);
+        }
+      }
+    }
+
+
 // NOTE: We force a size of ONE on the vector regardless of the size passed in. This is ok since this is
 // the only path it can take at runtime, but it will get compiler errors without that until this function
 // is updated for vectors
-  template <typename OpX, typename OpV, typename OpXQ>
-  class Interp1Op : public BaseOp<Interp1Op<OpX, OpV, OpXQ>> {
+  template <InterpMethod METHOD, typename OpX, typename OpV, typename OpXQ>
+  class Interp1Op : public BaseOp<Interp1Op<METHOD, OpX, OpV, OpXQ>> {
     public:
       using matxop = bool;
       using domain_type = typename OpX::value_type;
@@ -194,7 +239,6 @@ namespace matx {
       typename detail::base_type_t<OpX> x_;    // Sample points
       typename detail::base_type_t<OpV> v_;    // Values at sample points
       typename detail::base_type_t<OpXQ> xq_;  // Query points
-      InterpMethod method_;                    // Interpolation method
 
       mutable detail::tensor_impl_t<value_type, OpV::Rank()> m_; // Derivatives at sample points (spline only)
       mutable value_type *ptr_m_ = nullptr;
@@ -204,6 +248,33 @@ namespace matx {
       constexpr static int AXIS_X = OpX::Rank() - 1;
       constexpr static int AXIS_V = OpV::Rank() - 1;
 
+      // Precomputed interval of every query point (host only, sorted queries only). See
+      // encode_interval() for the encoding.
+      mutable detail::tensor_impl_t<index_t, RANK> pos_;
+      mutable index_t *ptr_pos_ = nullptr;
+
+      // The interval returned by searchsorted() is encoded in a single index:
+      //   -1      x_query < x(0)
+      //   2k      x_query == x(k)
+      //   2k + 1  x(k) < x_query < x(k+1), or x_query > x(n-1) when k == n-1
+      static __MATX_INLINE__ __MATX_HOST__ index_t encode_interval(index_t k, bool exact) {
+        return exact ? 2 * k : 2 * k + 1;
+      }
+
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ auto decode_interval(const cuda::std::array<index_t, RANK> idx, index_t code) const
+      {
+        cuda::std::array idx_low{idx};
+        cuda::std::array idx_high{idx};
+        if (code < 0) {
+          idx_low[AXIS] = x_.Size(AXIS_X);
+          idx_high[AXIS] = 0;
+        } else {
+          idx_low[AXIS] = code >> 1;
+          idx_high[AXIS] = idx_low[AXIS] + (code & 1);
+        }
+        return cuda::std::make_tuple(idx_low, idx_high);
+      }
+
       template <ElementsPerThread EPT, typename... Is>
       __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ auto searchsorted(const cuda::std::array<index_t, RANK> idx, const domain_type x_query) const
       {
@@ -256,6 +327,82 @@ namespace matx {
         return cuda::std::make_tuple(idx_low, idx_high);
       }
 
+      // Merge-walk lookup for sorted query points on the host. Each row of query points is
+      // walked alongside the sample points, so the lookup is O(n + m) per row instead of
+      // O(m log n). Returns false without touching pos_ if any row of xq is unsorted.
+      __MATX_INLINE__ bool is_sorted_host() const
+      {
+        const index_t nq = xq_.Size(AXIS);
+        const index_t rows = nq > 0 ? TotalSize(xq_) / nq : 0;
+        for (index_t r = 0; r < rows; r++) {
+          auto idx = GetIdxFromAbs(xq_, r * nq);
+          domain_type prev = get_value<ElementsPerThread::ONE>(xq_, idx);
+          for (index_t j = 1; j < nq; j++) {
+            idx[AXIS] = j;
+            const domain_type cur = get_value<ElementsPerThread::ONE>(xq_, idx);
+            if (cur < prev) {
+              return false;
+            }
+            prev = cur;
+          }
+        }
+        return true;
+      }
+
+      __MATX_INLINE__ void mergewalk_host([[maybe_unused]] int num_threads) const
+      {
+        const index_t n = x_.Size(AXIS_X);
+        const index_t nq = xq_.Size(AXIS);
+        const index_t rows = nq > 0 ? TotalSize(xq_) / nq : 0;
+
+        const auto walk_row = [&](index_t r) {
+          auto idx = GetIdxFromAbs(xq_, r * nq);
+          cuda::std::array idx_x{idx};
+          idx_x[AXIS] = 0;
+          const domain_type x_first = get_value<ElementsPerThread::ONE>(x_, idx_x);
+          domain_type x_cur = x_first;
+          domain_type x_next = x_first;
+          if (n > 1) {
+            idx_x[AXIS] = 1;
+            x_next = get_value<ElementsPerThread::ONE>(x_, idx_x);
+          }
+          index_t k = 0;
+
+          for (index_t j = 0; j < nq; j++) {
+            idx[AXIS] = j;
+            const domain_type x_query = get_value<ElementsPerThread::ONE>(xq_, idx);
+            if (x_query < x_first) {
+              pos_(idx) = -1;
+              continue;
+            }
+
+            while (k + 1 < n && x_next <= x_query) {
+              k++;
+              x_cur = x_next;
+              if (k + 1 < n) {
+                idx_x[AXIS] = k + 1;
+                x_next = get_value<ElementsPerThread::ONE>(x_, idx_x);
+              }
+            }
+            pos_(idx) = encode_interval(k, x_cur == x_query);
+          }
+        };
+
+#ifdef MATX_EN_OMP
+        if (num_threads > 1 && rows > 1) {
+          #pragma omp parallel for num_threads(num_threads)
+          for (index_t r = 0; r < rows; r++) {
+            walk_row(r);
+          }
+        } else
+#endif
+        {
+          for (index_t r = 0; r < rows; r++) {
+            walk_row(r);
+          }
+        }
+      }
+
       // Linear interpolation implementation
       template <ElementsPerThread EPT>
       __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__
@@ -365,36 +512,102 @@ namespace matx {
         return v;
       }
 
-      // Dispatch to appropriate interpolation method based on enum
+      // Dispatch to the interpolation method selected at compile time
       template <ElementsPerThread EPT>      
       __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__
       value_type interpolate(const domain_type x_query, cuda::std::array<index_t, RANK> idx_low, cuda::std::array<index_t, RANK> idx_high) const {
-        switch (method_) {
-          case InterpMethod::LINEAR:
-            return interpolate_linear<EPT>(x_query, idx_low, idx_high);
-          case InterpMethod::NEAREST:
-            return interpolate_nearest<EPT>(x_query, idx_low, idx_high);
-          case InterpMethod::NEXT:
-            return interpolate_next<EPT>(x_query, idx_low, idx_high);
-          case InterpMethod::PREV:
-            return interpolate_prev<EPT>(x_query, idx_low, idx_high);
-          case InterpMethod::SPLINE:
-            return interpolate_spline<EPT>(x_query, idx_low, idx_high);
-          default:
-            // Default to linear interpolation
-            return interpolate_linear<EPT>(x_query, idx_low, idx_high);
+        if constexpr (METHOD == InterpMethod::NEAREST) {
+          return interpolate_nearest<EPT>(x_query, idx_low, idx_high);
+        } else if constexpr (METHOD == InterpMethod::NEXT) {
+          return interpolate_next<EPT>(x_query, idx_low, idx_high);
+        } else if constexpr (METHOD == InterpMethod::PREV) {
+          return interpolate_prev<EPT>(x_query, idx_low, idx_high);
+        } else if constexpr (METHOD == InterpMethod::SPLINE) {
+          return interpolate_spline<EPT>(x_query, idx_low, idx_high);
+        } else {
+          return interpolate_linear<EPT>(x_query, idx_low, idx_high);
         }
       }
 
+      template <typename Executor>
+      __MATX_INLINE__ void spline_solve_cuda(Executor &&ex, value_type *ptr_dl_, value_type *ptr_d_, value_type *ptr_du_,
+                                             int n, int batch_count) const {
+        // Solve tridiagonal system using cuSPARSE
+        cudaStream_t stream = ex.getStream();
+        cusparseHandle_t handle = nullptr;
+        [[maybe_unused]] cusparseStatus_t cusparse_status = cusparseCreate(&handle);
+        MATX_ASSERT(cusparse_status == CUSPARSE_STATUS_SUCCESS, matxCudaError);
+        cusparse_status = cusparseSetStream(handle, stream);
+        MATX_ASSERT(cusparse_status == CUSPARSE_STATUS_SUCCESS, matxCudaError);
+
+        size_t workspace_size = 0;
+        void* workspace = nullptr;
+        if constexpr (std::is_same_v<value_type, float>) {
+          cusparse_status = cusparseSgtsv2StridedBatch_bufferSizeExt(
+            handle,             // cuSPARSE handle
+            n,                  // n
+            ptr_dl_,            // sub-diagonal
+            ptr_d_,             // main-diagonal
+            ptr_du_,            // super-diagonal
+            ptr_m_,             // right-hand side and solution
+            batch_count,        // batch_count
+            n,                  // batch_stride
+            &workspace_size);   // workspace size
+        } else if constexpr (std::is_same_v<value_type, double>) {
+          cusparse_status = cusparseDgtsv2StridedBatch_bufferSizeExt(
+            handle,             // cuSPARSE handle
+            n,                  // n
+            ptr_dl_,            // sub-diagonal
+            ptr_d_,             // main-diagonal
+            ptr_du_,            // super-diagonal
+            ptr_m_,             // right-hand side and solution
+            batch_count,        // batch_count
+            n,                  // batch_stride
+            &workspace_size);   // workspace size
+        }
+        MATX_ASSERT(cusparse_status == CUSPARSE_STATUS_SUCCESS, matxCudaError);
+        [[maybe_unused]] cudaError_t err = cudaMallocAsync(&workspace, workspace_size, stream);
+        MATX_ASSERT(err == cudaSuccess, matxCudaError);
+
+        if constexpr (std::is_same_v<value_type, float>) {
+          cusparse_status = cusparseSgtsv2StridedBatch(
+            handle,       // cuSPARSE handle
+            n,            // Size of the system
+            ptr_dl_,      // Sub-diagonal
+            ptr_d_,       // Main diagonal
+            ptr_du_,      // Super-diagonal
+            ptr_m_,       // Right-hand side and solution
+            batch_count,  // batch_count
+            n,            // batch_stride
+            workspace);   // Workspace buffer
+        } else if constexpr (std::is_same_v<value_type, double>) {
+          cusparse_status = cusparseDgtsv2StridedBatch(
+            handle,       // cuSPARSE handle
+            n,            // Size of the system
+            ptr_dl_,      // Sub-diagonal
+            ptr_d_,       // Main diagonal
+            ptr_du_,      // Super-diagonal
+            ptr_m_,       // Right-hand side and solution
+            batch_count,  // batch_count
+            n,            // batch_stride
+            workspace);   // Workspace buffer
+        }
+        MATX_ASSERT(cusparse_status == CUSPARSE_STATUS_SUCCESS, matxCudaError);
+        // cleanup
+        err = cudaFreeAsync(workspace, stream);
+        MATX_ASSERT(err == cudaSuccess, matxCudaError);
+        cusparse_status = cusparseDestroy(handle);
+        MATX_ASSERT(cusparse_status == CUSPARSE_STATUS_SUCCESS, matxCudaError);
+      }
+
 
     public:
       __MATX_INLINE__ std::string str() const { return "interp1()"; }
 
-      __MATX_INLINE__ Interp1Op(const OpX &x, const OpV &v, const OpXQ &xq, InterpMethod method = InterpMethod::LINEAR) :
+      __MATX_INLINE__ Interp1Op(const OpX &x, const OpV &v, const OpXQ &xq) :
         x_(x),
         v_(v),
-        xq_(xq),
-        method_(method)
+        xq_(xq)
       {
         if (x_.Size(x_.Rank() - 1) != v_.Size(v_.Rank() - 1)) {
           MATX_THROW(matxInvalidSize, "interp1: sample points and values must have the same size in the last dimension");
@@ -424,11 +637,18 @@ namespace matx {
 
       template <typename ShapeType, typename Executor>
       __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) const {
+        if constexpr (is_matx_op<OpX>()) {
+          x_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+        if constexpr (is_matx_op<OpV>()) {
+          v_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+        if constexpr (is_matx_op<OpXQ>()) {
+          xq_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
 
         // Allocate temporary storage for spline coefficients
-        if (method_ == InterpMethod::SPLINE) {
-          static_assert(is_cuda_executor_v<Executor>, "cubic spline interpolation only supports the CUDA executor currently");
-
+        if constexpr (METHOD == InterpMethod::SPLINE) {
           index_t _batch_count = 1;
           for (int i = 0; i < v_.Rank() - 1; i++) {
             _batch_count *= v_.Size(i);
@@ -456,84 +676,46 @@ namespace matx {
           // Fill tridiagonal system via custom operator
           InterpSplineTridiagonalFillOp(dl_tensor,d_tensor, du_tensor, m_, x_, v_).run(std::forward<Executor>(ex));
 
-          // Solve tridiagonal system using cuSPARSE
-          cudaStream_t stream = ex.getStream();
-          cusparseHandle_t handle = nullptr;
-          [[maybe_unused]] cusparseStatus_t cusparse_status = cusparseCreate(&handle);
-          MATX_ASSERT(cusparse_status == CUSPARSE_STATUS_SUCCESS, matxCudaError);
-          cusparse_status = cusparseSetStream(handle, stream);
-          MATX_ASSERT(cusparse_status == CUSPARSE_STATUS_SUCCESS, matxCudaError);
-
-          size_t workspace_size = 0;
-          void* workspace = nullptr;
-          if constexpr (std::is_same_v<value_type, float>) {
-            cusparse_status = cusparseSgtsv2StridedBatch_bufferSizeExt(
-              handle,             // cuSPARSE handle
-              n,                  // n
-              ptr_dl_,            // sub-diagonal
-              ptr_d_,             // main-diagonal
-              ptr_du_,            // super-diagonal
-              ptr_m_,             // right-hand side and solution
-              batch_count,        // batch_count
-              n,                  // batch_stride
-              &workspace_size);   // workspace size
-          } else if constexpr (std::is_same_v<value_type, double>) {
-            cusparse_status = cusparseDgtsv2StridedBatch_bufferSizeExt(
-              handle,             // cuSPARSE handle
-              n,                  // n
-              ptr_dl_,            // sub-diagonal
-              ptr_d_,             // main-diagonal
-              ptr_du_,            // super-diagonal
-              ptr_m_,             // right-hand side and solution
-              batch_count,        // batch_count
-              n,                  // batch_stride
-              &workspace_size);   // workspace size
-          }
-          MATX_ASSERT(cusparse_status == CUSPARSE_STATUS_SUCCESS, matxCudaError);
-          [[maybe_unused]] cudaError_t err = cudaMallocAsync(&workspace, workspace_size, stream);
-          MATX_ASSERT(err == cudaSuccess, matxCudaError);
-
-          if constexpr (std::is_same_v<value_type, float>) {
-            cusparse_status = cusparseSgtsv2StridedBatch(
-              handle,       // cuSPARSE handle
-              n,            // Size of the system
-              ptr_dl_,      // Sub-diagonal
-              ptr_d_,       // Main diagonal
-              ptr_du_,      // Super-diagonal
-              ptr_m_,       // Right-hand side and solution
-              batch_count,  // batch_count
-              n,            // batch_stride
-              workspace);   // Workspace buffer
-          } else if constexpr (std::is_same_v<value_type, double>) {
-            cusparse_status = cusparseDgtsv2StridedBatch(
-              handle,       // cuSPARSE handle
-              n,            // Size of the system
-              ptr_dl_,      // Sub-diagonal
-              ptr_d_,       // Main diagonal
-              ptr_du_,      // Super-diagonal
-              ptr_m_,       // Right-hand side and solution
-              batch_count,  // batch_count
-              n,            // batch_stride
-              workspace);   // Workspace buffer
+          if constexpr (is_cuda_executor_v<Executor>) {
+            spline_solve_cuda(std::forward<Executor>(ex), ptr_dl_, ptr_d_, ptr_du_, n, batch_count);
+          } else {
+            InterpSplineTridiagonalSolveHost(ptr_dl_, ptr_d_, ptr_du_, ptr_m_, _n, _batch_count, ex.GetNumThreads());
           }
-          MATX_ASSERT(cusparse_status == CUSPARSE_STATUS_SUCCESS, matxCudaError);
-          // cleanup
-          err = cudaFreeAsync(workspace, stream);
-          MATX_ASSERT(err == cudaSuccess, matxCudaError);
-          cusparse_status = cusparseDestroy(handle);
-          MATX_ASSERT(cusparse_status == CUSPARSE_STATUS_SUCCESS, matxCudaError);
-          matxFree(ptr_d_);
-          matxFree(ptr_dl_);
-          matxFree(ptr_du_);
+
+          detail::FreeTempTensor(ptr_d_, std::forward<Executor>(ex));
+          detail::FreeTempTensor(ptr_dl_, std::forward<Executor>(ex));
+          detail::FreeTempTensor(ptr_du_, std::forward<Executor>(ex));
         }
 
+        // Sorted query points on the host are located with a single merge-walk per row instead
+        // of a binary search per query
+        if constexpr (is_host_executor_v<Executor>) {
+          if (is_sorted_host()) {
+            detail::AllocateTempTensor(pos_, std::forward<Executor>(ex), xq_.Shape(), &ptr_pos_);
+            mergewalk_host(ex.GetNumThreads());
+          }
+        }
       }
 
       template <typename ShapeType, typename Executor>
       __MATX_INLINE__ void PostRun([[maybe_unused]] ShapeType &&shape,
                                   [[maybe_unused]] Executor &&ex) const noexcept {
-        if (method_ == InterpMethod::SPLINE) {
-          matxFree(ptr_m_);
+        if constexpr (is_matx_op<OpX>()) {
+          x_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+        if constexpr (is_matx_op<OpV>()) {
+          v_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+        if constexpr (is_matx_op<OpXQ>()) {
+          xq_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+
+        if constexpr (METHOD == InterpMethod::SPLINE) {
+          detail::FreeTempTensor(ptr_m_, std::forward<Executor>(ex));
+        }
+        if (ptr_pos_ != nullptr) {
+          detail::FreeTempTensor(ptr_pos_, std::forward<Executor>(ex));
+          ptr_pos_ = nullptr;
         }
       }
 
@@ -545,8 +727,12 @@ namespace matx {
         if constexpr (EPT == ElementsPerThread::ONE) {
           cuda::std::array idx{indices...};
           auto x_query = xq_(indices...);
-          auto [idx_low, idx_high] = searchsorted<EPT>(idx, x_query);
+          if (ptr_pos_ != nullptr) {
+            auto [idx_low, idx_high] = decode_interval(idx, pos_(indices...));
+            return interpolate<EPT>(x_query, idx_low, idx_high);
+          }
 
+          auto [idx_low, idx_high] = searchsorted<EPT>(idx, x_query);
           return interpolate<EPT>(x_query, idx_low, idx_high);
         } else {
           return Vector<value_type, static_cast<index_t>(EPT)>{};
@@ -560,7 +746,7 @@ namespace matx {
           return ElementsPerThread::ONE;
         } else {
           auto self_has_cap = detail::capability_attributes<Cap>::default_value;
-          // Note: m_ is a temporary internal tensor, not an input operator passed to constructor
+          // Note: m_ and pos_ are temporary internal tensors, not input operators passed to constructor
           return combine_capabilities<Cap>(self_has_cap, 
                                            detail::get_operator_capability<Cap>(x_),
                                            detail::get_operator_capability<Cap>(v_),
@@ -569,6 +755,77 @@ namespace matx {
       }
 
     };
+
+  // Selects the interpolation method at runtime for the deprecated interp1 overloads by
+  // forwarding to the Interp1Op instantiated for that method
+  template <typename OpX, typename OpV, typename OpXQ>
+  class Interp1MethodOp : public BaseOp<Interp1MethodOp<OpX, OpV, OpXQ>> {
+    public:
+      using matxop = bool;
+      using value_type = typename OpV::value_type;
+
+    private:
+      InterpMethod method_;
+      Interp1Op<InterpMethod::LINEAR, OpX, OpV, OpXQ> linear_;
+      Interp1Op<InterpMethod::NEAREST, OpX, OpV, OpXQ> nearest_;
+      Interp1Op<InterpMethod::NEXT, OpX, OpV, OpXQ> next_;
+      Interp1Op<InterpMethod::PREV, OpX, OpV, OpXQ> prev_;
+      Interp1Op<InterpMethod::SPLINE, OpX, OpV, OpXQ> spline_;
+
+      template <typename Func>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) dispatch(Func &&func) const {
+        switch (method_) {
+          case InterpMethod::NEAREST: return func(nearest_);
+          case InterpMethod::NEXT:    return func(next_);
+          case InterpMethod::PREV:    return func(prev_);
+          case InterpMethod::SPLINE:  return func(spline_);
+          default:                    return func(linear_);
+        }
+      }
+
+    public:
+      __MATX_INLINE__ std::string str() const { return "interp1()"; }
+
+      __MATX_INLINE__ Interp1MethodOp(const OpX &x, const OpV &v, const OpXQ &xq, InterpMethod method) :
+        method_(method), linear_(x, v, xq), nearest_(x, v, xq), next_(x, v, xq), prev_(x, v, xq), spline_(x, v, xq) {}
+
+      static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+      {
+        return OpXQ::Rank();
+      }
+
+      constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size(int dim) const
+      {
+        return linear_.Size(dim);
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PreRun(ShapeType &&shape, Executor &&ex) const {
+        dispatch([&](const auto &op) { op.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex)); });
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PostRun(ShapeType &&shape, Executor &&ex) const noexcept {
+        dispatch([&](const auto &op) { op.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex)); });
+      }
+
+      template <ElementsPerThread EPT, typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+      {
+        return dispatch([&](const auto &op) { return op.template operator()<EPT>(indices...); });
+      }
+
+      template <typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const
+      {
+        return this->operator()<detail::ElementsPerThread::ONE>(indices...);
+      }
+
+      template <OperatorCapability Cap>
+      __MATX_INLINE__ __MATX_HOST__ auto get_capability() const {
+        return linear_.template get_capability<Cap>();
+      }
+    };
   } // namespace detail
 
 
@@ -578,6 +835,11 @@ namespace matx {
  * Interpolation is performed along the last dimension. All other dimensions must be of
  * compatible size.
  *
+ * On host executors, query points that are sorted along the last dimension are located with a
+ * merge-walk over the sample points rather than a binary search per query.
+ *
+ * @tparam METHOD
+ *   Interpolation method (LINEAR, NEAREST, NEXT, PREV, SPLINE)
  * @tparam OpX
  *   Type of sample points
  * @tparam OpV
@@ -590,16 +852,14 @@ namespace matx {
  *   Sample values. Must have compatible dimensions with x.
  * @param xq
  *   Query points where to interpolate. All dimensions except the last must be of compatible size with x and v (e.g. x and v can be vectors, and xq can be a matrix).
- * @param method
- *   Interpolation method (LINEAR, NEAREST, NEXT, PREV, SPLINE)
  * @returns Operator that interpolates values at query points, with the same dimensions as xq.
  */
-template <typename OpX, typename OpV, typename OpXQ>
-auto interp1(const OpX &x, const OpV &v, const OpXQ &xq, InterpMethod method = InterpMethod::LINEAR) {
+template <InterpMethod METHOD = InterpMethod::LINEAR, typename OpX, typename OpV, typename OpXQ>
+auto interp1(const OpX &x, const OpV &v, const OpXQ &xq) {
   static_assert(OpX::Rank() >= 1, "interp: sample points must be at least 1D");
   static_assert(OpV::Rank() >= OpX::Rank(), "interp: sample values must have at least the same rank as sample points");
   static_assert(OpXQ::Rank() >= OpV::Rank(), "interp: query points must have at least the same rank as sample values");
-  return detail::Interp1Op(x, v, xq, method);
+  return detail::Interp1Op<METHOD, OpX, OpV, OpXQ>(x, v, xq);
 }
 
 
@@ -608,6 +868,8 @@ auto interp1(const OpX &x, const OpV &v, const OpXQ &xq, InterpMethod method = I
  *
  * Interpolation is performed along the specified dimension. All other dimensions must be of compatible size.
  *
+ * @tparam METHOD
+ *   Interpolation method (LINEAR, NEAREST, NEXT, PREV, SPLINE)
  * @tparam OpX
  *   Type of sample points
  * @tparam OpV
@@ -622,16 +884,74 @@ auto interp1(const OpX &x, const OpV &v, const OpXQ &xq, InterpMethod method = I
  *   Query points where to interpolate. All dimensions except the specified dimension must be of compatible size with x and v (e.g. x and v can be vectors, and xq can be a matrix).
  * @param axis
  *   Dimension (of xq) along which to interpolate.
+ * @returns Operator that interpolates values at query points, with the same dimensions as xq.
+ */
+template <InterpMethod METHOD = InterpMethod::LINEAR, typename OpX, typename OpV, typename OpXQ>
+auto interp1(const OpX &x, const OpV &v, const OpXQ &xq, const int (&axis)[1]) {
+  static_assert(OpX::Rank() >= 1, "interp: sample points must be at least 1D");
+  static_assert(OpV::Rank() >= OpX::Rank(), "interp: sample values must have at least the same rank as sample points");
+  static_assert(OpXQ::Rank() >= OpV::Rank(), "interp: query points must have at least the same rank as sample values");
+
+
+  auto x_perm = detail::getPermuteDims<OpX::Rank()>({axis[0] + OpX::Rank() - OpXQ::Rank()});
+  auto v_perm = detail::getPermuteDims<OpV::Rank()>({axis[0] + OpV::Rank() - OpXQ::Rank()});
+  auto xq_perm = detail::getPermuteDims<OpXQ::Rank()>({axis[0]});
+
+  auto px = permute(x, x_perm);
+  auto pv = permute(v, v_perm);
+  auto pxq = permute(xq, xq_perm);
+  auto inv_perm = detail::invPermute<OpXQ::Rank()>(xq_perm);
+
+  return permute(detail::Interp1Op<METHOD, decltype(px), decltype(pv), decltype(pxq)>(px, pv, pxq), inv_perm);
+}
+
+/**
+ * 1D interpolation of samples at query points with the method chosen at runtime.
+ *
+ * @deprecated Pass the method as a template parameter instead, e.g. interp1<InterpMethod::SPLINE>(x, v, xq)
+ *
+ * @param x
+ *   Sample points. Last dimension must be sorted in ascending order.
+ * @param v
+ *   Sample values. Must have compatible dimensions with x.
+ * @param xq
+ *   Query points where to interpolate.
  * @param method
  *   Interpolation method (LINEAR, NEAREST, NEXT, PREV, SPLINE)
  * @returns Operator that interpolates values at query points, with the same dimensions as xq.
  */
 template <typename OpX, typename OpV, typename OpXQ>
-auto interp1(const OpX &x, const OpV &v, const OpXQ &xq, const int (&axis)[1],InterpMethod method = InterpMethod::LINEAR) {
+[[deprecated("Use interp1<InterpMethod>(x, v, xq) instead of passing the method as an argument")]]
+auto interp1(const OpX &x, const OpV &v, const OpXQ &xq, InterpMethod method) {
   static_assert(OpX::Rank() >= 1, "interp: sample points must be at least 1D");
   static_assert(OpV::Rank() >= OpX::Rank(), "interp: sample values must have at least the same rank as sample points");
   static_assert(OpXQ::Rank() >= OpV::Rank(), "interp: query points must have at least the same rank as sample values");
+  return detail::Interp1MethodOp<OpX, OpV, OpXQ>(x, v, xq, method);
+}
 
+/**
+ * 1D interpolation of samples at query points along a dimension with the method chosen at runtime.
+ *
+ * @deprecated Pass the method as a template parameter instead, e.g. interp1<InterpMethod::SPLINE>(x, v, xq, {axis})
+ *
+ * @param x
+ *   Sample points. Last dimension must be sorted in ascending order.
+ * @param v
+ *   Sample values. Must have compatible dimensions with x.
+ * @param xq
+ *   Query points where to interpolate.
+ * @param axis
+ *   Dimension (of xq) along which to interpolate.
+ * @param method
+ *   Interpolation method (LINEAR, NEAREST, NEXT, PREV, SPLINE)
+ * @returns Operator that interpolates values at query points, with the same dimensions as xq.
+ */
+template <typename OpX, typename OpV, typename OpXQ>
+[[deprecated("Use interp1<InterpMethod>(x, v, xq, axis) instead of passing the method as an argument")]]
+auto interp1(const OpX &x, const OpV &v, const OpXQ &xq, const int (&axis)[1], InterpMethod method) {
+  static_assert(OpX::Rank() >= 1, "interp: sample points must be at least 1D");
+  static_assert(OpV::Rank() >= OpX::Rank(), "interp: sample values must have at least the same rank as sample points");
+  static_assert(OpXQ::Rank() >= OpV::Rank(), "interp: query points must have at least the same rank as sample values");
 
   auto x_perm = detail::getPermuteDims<OpX::Rank()>({axis[0] + OpX::Rank() - OpXQ::Rank()});
   auto v_perm = detail::getPermuteDims<OpV::Rank()>({axis[0] + OpV::Rank() - OpXQ::Rank()});
@@ -642,6 +962,6 @@ auto interp1(const OpX &x, const OpV &v, const OpXQ &xq, const int (&axis)[1],In
   auto pxq = permute(xq, xq_perm);
   auto inv_perm = detail::invPermute<OpXQ::Rank()>(xq_perm);
 
-  return permute(detail::Interp1Op(px, pv, pxq, method), inv_perm);
+  return permute(detail::Interp1MethodOp<decltype(px), decltype(pv), decltype(pxq)>(px, pv, pxq, method), inv_perm);
 }
 } // namespace matx
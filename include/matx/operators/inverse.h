@@ -89,8 +89,12 @@ namespace detail {
 
       template <typename Out, typename Executor>
       void Exec(Out &&out, Executor &&ex) const {
-        static_assert(is_cuda_executor_v<Executor>, "inv() only supports the CUDA executor currently");
-        inv_impl(cuda::std::get<0>(out), a_, ex.getStream());
+        if constexpr (is_cuda_executor_v<Executor>) {
+          inv_impl(cuda::std::get<0>(out), a_, ex.getStream());
+        }
+        else {
+          inv_impl(cuda::std::get<0>(out), a_, ex);
+        }
       }
 
       template <typename ShapeType, typename Executor>
@@ -118,15 +122,17 @@ namespace detail {
           a_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
         }  
 
-        matxFree(ptr);
+        detail::FreeTempTensor(ptr, std::forward<Executor>(ex));
       }
   };
 }
 
 /**
- * Performs a matrix inverse on a square matrix. The inverse API currently uses
+ * Performs a matrix inverse on a square matrix. On the GPU the inverse API uses
  * cuBLAS as a backend with the `cublas<t>matinvBatched()` family of functions
- * for `N <= 32` and `getri/getrf` functions otherwise.
+ * for `N <= 32` and `getri/getrf` functions otherwise. On the host it uses a
+ * built-in LU factorization, with batches of matrices up to 16x16 processed
+ * several at a time by vectorized small-matrix kernels.
  * 
  * If rank > 2, operations are batched.
  * 
@@ -37,9 +37,10 @@
 #include "matx/operators/base_operator.h"
 #include "matx/transforms/matmul/matmul_cuda.h"
 #include "matx/transforms/matmul/matmul_cusparse.h"
-#ifdef MATX_EN_CPU_MATMUL
-  #include "matx/transforms/matmul/matmul_cblas.h"
-#endif
+#include "matx/transforms/matmul/matmul_sparse_host.h"
+#include "matx/transforms/matmul/spgemm_cusparse.h"
+#include "matx/transforms/matmul/spgemm_host.h"
+#include "matx/transforms/matmul/matmul_cblas.h"
 
 namespace matx
 {
@@ -64,6 +65,7 @@ namespace matx
         using value_type = typename OpA::value_type;
         using matx_transform_op = bool;
         using matmul_xform_op = bool;
+        using tosparse_xform_op = bool;
 
         __MATX_INLINE__ std::string str() const { 
             return "matmul(" + get_type_str(a_) + "," + get_type_str(b_) + ")";
@@ -127,9 +129,18 @@ namespace matx
 
         template <typename Out, typename Executor>
         void Exec(Out &&out, Executor &&ex) const {
-          // Perform SpMM or otherwise GEMM.
-          static_assert(!is_sparse_tensor_v<OpB>, "sparse rhs not implemented");
-          if constexpr (is_sparse_tensor_v<OpA>) {
+          // Perform SpGEMM, SpMM or otherwise GEMM.
+          MATX_STATIC_ASSERT_STR(!is_sparse_tensor_v<OpB> || is_sparse_tensor_v<OpA>, matxNotSupported,
+                                 "sparse rhs requires a sparse lhs");
+          MATX_STATIC_ASSERT_STR(!is_sparse_tensor_v<remove_cvref_t<Out>> || (is_sparse_tensor_v<OpA> && is_sparse_tensor_v<OpB>),
+                                 matxNotSupported, "sparse output requires sparse inputs");
+          MATX_STATIC_ASSERT_STR(!is_sparse_tensor_v<OpB> || is_sparse_tensor_v<remove_cvref_t<Out>>, matxNotSupported,
+                                 "SpGEMM requires a sparse output");
+          if constexpr (is_sparse_tensor_v<remove_cvref_t<Out>>) {
+            // Direct sparse assignment (viz. (Ccsr = matmul(Acsr, Bcsr)).exec();)
+            sparse_spgemm_impl(out, a_, b_, ex, alpha_, beta_);
+          }
+          else if constexpr (is_sparse_tensor_v<OpA>) {
             if constexpr (!std::is_same_v<PermDims, no_permute_t>) {
               sparse_matmul_impl(permute(cuda::std::get<0>(out), perm_), a_, b_, ex, alpha_, beta_);
             }
@@ -178,7 +189,7 @@ namespace matx
             b_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
           }
 
-          matxFree(ptr);         
+          detail::FreeTempTensor(ptr, std::forward<Executor>(ex));         
         }
     };
   }
@@ -37,6 +37,7 @@
 #include "matx/operators/base_operator.h"
 #include "matx/transforms/matvec.h"
 #include "matx/transforms/matmul/matvec_cusparse.h"
+#include "matx/transforms/matmul/matmul_sparse_host.h"
 
 namespace matx
 {
@@ -147,7 +148,7 @@ namespace matx
             b_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
           } 
 
-          matxFree(ptr);
+          detail::FreeTempTensor(ptr, std::forward<Executor>(ex));
         }           
     };
   }
@@ -142,7 +142,7 @@ namespace matx
             op_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
           }
 
-          matxFree(ptr);
+          detail::FreeTempTensor(ptr, std::forward<Executor>(ex));
         }
     };
   } // end namespace detail
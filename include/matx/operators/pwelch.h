@@ -149,7 +149,7 @@ namespace matx
             w_.PostRun(Shape(w_), std::forward<Executor>(ex));
           }
 
-          matxFree(ptr);
+          detail::FreeTempTensor(ptr, std::forward<Executor>(ex));
         }
 
       private:
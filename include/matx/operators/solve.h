@@ -36,6 +36,7 @@
 #include "matx/core/type_utils.h"
 #include "matx/operators/base_operator.h"
 #include "matx/transforms/solve/solve_cusparse.h"
+#include "matx/transforms/solve/solve_sparse_host.h"
 #ifdef MATX_EN_CUDSS
 #include "matx/transforms/solve/solve_cudss.h"
 #endif
@@ -110,6 +111,8 @@ public:
         sparse_dia_solve_impl(cuda::std::get<0>(out), a_, b_, ex);
       } else if constexpr (OpA::Format::isBatchedDIAIUniform()) {
         sparse_batched_dia_solve_impl(cuda::std::get<0>(out), a_, b_, ex);
+      } else if constexpr (is_host_executor_v<Executor>) {
+        sparse_solve_impl(cuda::std::get<0>(out), a_, b_, ex);
       } else {
 #ifdef MATX_EN_CUDSS
         sparse_solve_impl(cuda::std::get<0>(out), a_, b_, ex);
@@ -151,7 +154,7 @@ public:
     if constexpr (is_matx_op<OpB>()) {
       b_.PostRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
     }
-    matxFree(ptr);
+    detail::FreeTempTensor(ptr, std::forward<Executor>(ex));
   }
 };
 
@@ -164,7 +167,9 @@ public:
  * row (another way to think about this is that X and B are
  * presented using column-major storage). Currently, this
  * operation is only implemented for solving a linear system
- * with a very **sparse** matrix A in CSR or DIA format.
+ * with a very **sparse** matrix A in CSR or DIA format. On the
+ * host, CSR systems are solved with a built-in sparse LU whose
+ * factorization is cached across solves with the same matrix.
  *
  * @tparam OpA
  *    Data type of A tensor (sparse)
@@ -36,6 +36,7 @@
 #include "matx/core/type_utils.h"
 #include "matx/operators/base_operator.h"
 #include "matx/transforms/convert/sparse2dense_cusparse.h"
+#include "matx/transforms/convert/sparse2dense_host.h"
 
 namespace matx {
 namespace detail {
@@ -134,7 +135,7 @@ public:
                                [[maybe_unused]] Executor &&ex) const noexcept {
     static_assert(is_sparse_tensor_v<OpA>,
                   "Cannot use sparse2dense on dense input");
-    matxFree(ptr);
+    detail::FreeTempTensor(ptr, std::forward<Executor>(ex));
   }
 };
 
@@ -36,6 +36,7 @@
 #include "matx/core/type_utils.h"
 #include "matx/operators/base_operator.h"
 #include "matx/transforms/svd/svd_cuda.h"
+#include "matx/transforms/svd/svd_host.h"
 #ifdef MATX_EN_CPU_SOLVER
   #include "matx/transforms/svd/svd_lapack.h"
 #endif
@@ -185,7 +186,6 @@ namespace detail {
 
       template <typename Out, typename Executor>
       void Exec(Out &&out, Executor &&ex) {
-        static_assert(is_cuda_executor_v<Executor>, "svdpi() only supports the CUDA executor currently");
         static_assert(cuda::std::tuple_size_v<remove_cvref_t<Out>> == 4, "Must use mtie with 3 outputs on svdpi(). ie: (mtie(U, S, VT) = svdpi(A))");
 
         svdpi_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), cuda::std::get<2>(out), a_, x_, iterations_, ex, k_);
@@ -214,7 +214,8 @@ namespace detail {
 
 /**
  * Perform a SVD decomposition using the power iteration.  This version of
- * SVD works well on small n/m with large batch.
+ * SVD works well on small n/m with large batch. On host executors the batches
+ * are distributed across the executor's threads.
  *
  * @tparam AType
  *   Tensor or operator type for output of A input tensors.
@@ -275,7 +276,6 @@ namespace detail {
 
       template <typename Out, typename Executor>
       void Exec(Out &&out, Executor &&ex) {
-        static_assert(is_cuda_executor_v<Executor>, "svdbpi() only supports the CUDA executor currently");
         static_assert(cuda::std::tuple_size_v<remove_cvref_t<Out>> == 4, "Must use mtie with 3 outputs on svdbpi(). ie: (mtie(U, S, VT) = svdbpi(A))");
 
         svdbpi_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), cuda::std::get<2>(out), a_, max_iters_, tol_, ex);
@@ -306,7 +306,9 @@ namespace detail {
 
 /**
  * Perform a SVD decomposition using the block power iteration.  This version of
- * SVD works well on small n/m with large batch.
+ * SVD works well on small n/m with large batch. On host executors the batches
+ * are distributed across the executor's threads, and a host LAPACK library must
+ * be configured for the QR steps.
  *
  * @tparam AType
  *   Tensor or operator type for output of A input tensors.
@@ -323,4 +325,102 @@ __MATX_INLINE__ auto svdbpi(const AType &A, int max_iters=10, float tol=0.0f) {
   return detail::SVDBPIOp(A, max_iters, tol);
 }
 
+
+
+namespace detail {
+  template<typename OpA>
+  class SVDRandOp : public BaseOp<SVDRandOp<OpA>>
+  {
+    private:
+      typename detail::base_type_t<OpA> a_;
+      index_t k_;
+      index_t oversample_;
+      int iters_;
+      uint64_t seed_;
+
+    public:
+      using matxop = bool;
+      using value_type = typename OpA::value_type;
+      using matx_transform_op = bool;
+      using svd_xform_op = bool;
+
+      __MATX_INLINE__ std::string str() const { return "svd_rand(" + get_type_str(a_) + ")"; }
+      __MATX_INLINE__ SVDRandOp(const OpA &a, index_t k, index_t oversample, int iters, uint64_t seed) :
+        a_(a), k_(k), oversample_(oversample), iters_(iters), seed_(seed)
+      { }
+
+      // This should never be called
+      template <typename... Is>
+      __MATX_INLINE__ __MATX_DEVICE__ __MATX_HOST__ decltype(auto) operator()(Is... indices) const = delete;
+
+      template <OperatorCapability Cap>
+      __MATX_INLINE__ __MATX_HOST__ auto get_capability() const {
+        if constexpr (Cap == OperatorCapability::ELEMENTS_PER_THREAD) {
+          return ElementsPerThread::ONE;
+        }
+        else {
+          auto self_has_cap = capability_attributes<Cap>::default_value;
+          return combine_capabilities<Cap>(self_has_cap, detail::get_operator_capability<Cap>(a_));
+        }
+      }
+
+      template <typename Out, typename Executor>
+      void Exec(Out &&out, Executor &&ex) {
+        static_assert(is_host_executor_v<Executor>, "svd_rand() only supports host executors currently");
+        static_assert(cuda::std::tuple_size_v<remove_cvref_t<Out>> == 4, "Must use mtie with 3 outputs on svd_rand(). ie: (mtie(U, S, VT) = svd_rand(A, k))");
+
+        svd_rand_impl(cuda::std::get<0>(out), cuda::std::get<1>(out), cuda::std::get<2>(out), a_, k_, oversample_, iters_, seed_, ex);
+      }
+
+      static __MATX_INLINE__ constexpr __MATX_HOST__ __MATX_DEVICE__ int32_t Rank()
+      {
+        return matxNoRank;
+      }
+
+      template <typename ShapeType, typename Executor>
+      __MATX_INLINE__ void PreRun([[maybe_unused]] ShapeType &&shape, [[maybe_unused]] Executor &&ex) noexcept
+      {
+        if constexpr (is_matx_op<OpA>()) {
+          a_.PreRun(std::forward<ShapeType>(shape), std::forward<Executor>(ex));
+        }
+      }
+
+      constexpr __MATX_INLINE__ __MATX_HOST__ __MATX_DEVICE__ index_t Size([[maybe_unused]] int dim) const
+      {
+        return 0;
+      }
+
+  };
+}
+
+/**
+ * Perform a truncated SVD using a randomized range finder. This version of SVD
+ * works well when only the top k singular triplets of a large matrix are needed.
+ *
+ * The range of A is sampled with a Gaussian test matrix of `k + oversample` columns,
+ * refined with `iters` subspace iterations, and the SVD of the small projected matrix
+ * gives the leading singular values and vectors. Only host executors are currently
+ * supported, and they must be configured with a host LAPACK library. Batches are
+ * distributed across the executor's threads.
+ *
+ * @tparam AType
+ *   Tensor or operator type for output of A input tensors.
+ *
+ * @param A
+ *   Input tensor or operator for tensor A input with size `batches x m x n`
+ * @param k
+ *   Number of singular values to find. U must be `batches x m x k`, S `batches x k`,
+ *   and VT `batches x k x n`.
+ * @param oversample
+ *   Number of extra columns to sample beyond k. Larger values improve accuracy.
+ * @param iters
+ *   Number of subspace iterations. Increase when the singular values decay slowly.
+ * @param seed
+ *   Seed for the random test matrix
+ */
+template<typename AType>
+__MATX_INLINE__ auto svd_rand(const AType &A, index_t k, index_t oversample=10, int iters=2, uint64_t seed=0) {
+  return detail::SVDRandOp(A, k, oversample, iters, seed);
+}
+
 }
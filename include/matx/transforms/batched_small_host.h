@@ -0,0 +1,781 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+#include "matx/core/error.h"
+#include "matx/core/type_utils.h"
+#include "matx/executors/host.h"
+
+namespace matx {
+
+namespace detail {
+
+/**
+ * Batched small-matrix kernels for the host.
+ *
+ * A per-matrix BLAS or LAPACK call on a 4x4 matrix spends far longer in
+ * argument checking and dispatch than in arithmetic. These kernels instead
+ * pack a group of W matrices into a batch-interleaved (SoA) buffer where
+ * element (r, c) of every matrix in the group is contiguous, so the innermost
+ * loop of every kernel runs across matrices and vectorizes without shuffles.
+ * Complex types are split into a real and an imaginary plane.
+ *
+ * The matrix dimension is a template parameter for sizes up to
+ * HOST_SMALL_MAX_DIM so the loops over it unroll completely. A dimension of 0
+ * selects a runtime-sized variant of the same kernel.
+ */
+static constexpr index_t HOST_SMALL_MAX_DIM = 16;
+
+/** Minimum number of batches before the small-matrix kernels replace BLAS/LAPACK */
+static constexpr index_t HOST_SMALL_MIN_BATCHES = 4;
+
+template <typename T>
+struct HostSmallTraits {
+  using scalar_type = typename inner_op_type_t<T>::type;
+  static constexpr bool cplx = is_complex_v<T>;
+  /** Planes per element: real, and imaginary for complex types */
+  static constexpr index_t P = cplx ? 2 : 1;
+  /** Matrices per group: one 64-byte vector of each plane per element */
+  static constexpr index_t W = 64 / static_cast<index_t>(sizeof(scalar_type));
+};
+
+template <typename T>
+constexpr bool HostSmallSupported()
+{
+  return std::is_same_v<T, float> || std::is_same_v<T, double> ||
+         std::is_same_v<T, cuda::std::complex<float>> ||
+         std::is_same_v<T, cuda::std::complex<double>>;
+}
+
+/**
+ * @brief Check whether a batch of matrices with largest dimension dim should use the small-matrix kernels
+ */
+__MATX_INLINE__ bool HostSmallEligible(index_t dim, index_t batches)
+{
+  return dim <= HOST_SMALL_MAX_DIM && batches >= HOST_SMALL_MIN_BATCHES;
+}
+
+/** Element strides of a matrix in memory, and whether it is read/written conjugated */
+struct HostSmallLayout {
+  index_t row;
+  index_t col;
+  bool conj = false;
+};
+
+/**
+ * @brief Call func with std::integral_constant<int, n>, or <int, 0> when n is above HOST_SMALL_MAX_DIM
+ */
+template <typename Func>
+__MATX_INLINE__ void HostSmallDimDispatch(index_t n, Func &&func)
+{
+  switch (n) {
+    case 1: func(std::integral_constant<int, 1>{}); break;
+    case 2: func(std::integral_constant<int, 2>{}); break;
+    case 3: func(std::integral_constant<int, 3>{}); break;
+    case 4: func(std::integral_constant<int, 4>{}); break;
+    case 5: func(std::integral_constant<int, 5>{}); break;
+    case 6: func(std::integral_constant<int, 6>{}); break;
+    case 7: func(std::integral_constant<int, 7>{}); break;
+    case 8: func(std::integral_constant<int, 8>{}); break;
+    case 9: func(std::integral_constant<int, 9>{}); break;
+    case 10: func(std::integral_constant<int, 10>{}); break;
+    case 11: func(std::integral_constant<int, 11>{}); break;
+    case 12: func(std::integral_constant<int, 12>{}); break;
+    case 13: func(std::integral_constant<int, 13>{}); break;
+    case 14: func(std::integral_constant<int, 14>{}); break;
+    case 15: func(std::integral_constant<int, 15>{}); break;
+    case 16: func(std::integral_constant<int, 16>{}); break;
+    default: func(std::integral_constant<int, 0>{}); break;
+  }
+}
+
+/** Offset of element (r, c) of a cols-wide SoA matrix */
+template <typename T, index_t W>
+__MATX_INLINE__ index_t HostSmallOffset(index_t r, index_t c, index_t cols)
+{
+  return (r * cols + c) * HostSmallTraits<T>::P * W;
+}
+
+/**
+ * @brief Copy lanes [0, count) of a group of matrices into a SoA buffer
+ *
+ * Lanes past count are filled with pad times the identity so that padded
+ * lanes of a factorization stay well conditioned.
+ */
+template <typename T, index_t W>
+__MATX_INLINE__ void HostSmallPack(typename HostSmallTraits<T>::scalar_type *buf,
+                                   const T *const *ptrs, index_t count,
+                                   index_t rows, index_t cols,
+                                   const HostSmallLayout &layout, T pad)
+{
+  for (index_t l = 0; l < W; l++) {
+    for (index_t r = 0; r < rows; r++) {
+      for (index_t c = 0; c < cols; c++) {
+        const T v = l < count ? ptrs[l][r * layout.row + c * layout.col]
+                              : (r == c ? pad : T(0));
+        auto *e = buf + HostSmallOffset<T, W>(r, c, cols) + l;
+        if constexpr (HostSmallTraits<T>::cplx) {
+          e[0] = v.real();
+          e[W] = layout.conj ? -v.imag() : v.imag();
+        } else {
+          e[0] = v;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Copy lanes [0, count) of a SoA buffer out to a group of matrices
+ *
+ * When lower is set only the lower triangle (including the diagonal) is written.
+ */
+template <typename T, index_t W>
+__MATX_INLINE__ void HostSmallUnpack(const typename HostSmallTraits<T>::scalar_type *buf,
+                                     T *const *ptrs, index_t count,
+                                     index_t rows, index_t cols,
+                                     const HostSmallLayout &layout, bool lower = false)
+{
+  for (index_t l = 0; l < count; l++) {
+    for (index_t r = 0; r < rows; r++) {
+      for (index_t c = 0; c < (lower ? r + 1 : cols); c++) {
+        const auto *e = buf + HostSmallOffset<T, W>(r, c, cols) + l;
+        if constexpr (HostSmallTraits<T>::cplx) {
+          ptrs[l][r * layout.row + c * layout.col] = T(e[0], layout.conj ? -e[W] : e[W]);
+        } else {
+          ptrs[l][r * layout.row + c * layout.col] = e[0];
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief C = alpha * A * B + beta * C on a group of m x K and K x n SoA matrices
+ */
+template <typename T, int K, index_t W>
+__MATX_INLINE__ void HostSmallGemmKernel(index_t m, index_t n, [[maybe_unused]] index_t k_rt,
+                                         typename HostSmallTraits<T>::scalar_type alpha,
+                                         typename HostSmallTraits<T>::scalar_type beta,
+                                         const typename HostSmallTraits<T>::scalar_type *a,
+                                         const typename HostSmallTraits<T>::scalar_type *b,
+                                         typename HostSmallTraits<T>::scalar_type *c)
+{
+  using S = typename HostSmallTraits<T>::scalar_type;
+  const index_t k = K > 0 ? K : k_rt;
+
+  // Each lane keeps its accumulators in registers across the whole k loop
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      const S *ae = a + HostSmallOffset<T, W>(i, 0, k);
+      const S *be = b + HostSmallOffset<T, W>(0, j, n);
+      S *ce = c + HostSmallOffset<T, W>(i, j, n);
+      #pragma omp simd
+      for (index_t l = 0; l < W; l++) {
+        S re = 0;
+        [[maybe_unused]] S im = 0;
+        for (index_t p = 0; p < k; p++) {
+          const S *ap = ae + HostSmallOffset<T, W>(0, p, k);
+          const S *bp = be + HostSmallOffset<T, W>(p, 0, n);
+          if constexpr (HostSmallTraits<T>::cplx) {
+            re += ap[l] * bp[l] - ap[W + l] * bp[W + l];
+            im += ap[l] * bp[W + l] + ap[W + l] * bp[l];
+          } else {
+            re += ap[l] * bp[l];
+          }
+        }
+
+        ce[l] = alpha * re + (beta == S(0) ? S(0) : beta * ce[l]);
+        if constexpr (HostSmallTraits<T>::cplx) {
+          ce[W + l] = alpha * im + (beta == S(0) ? S(0) : beta * ce[W + l]);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief In-place Cholesky factorization A = L * L^H of a group of N x N SoA matrices
+ *
+ * Only the lower triangle is read and written. info[l] is set to the 1-based
+ * column of the first non-positive pivot of lane l, as in LAPACK potrf, and is
+ * left untouched for lanes that factor successfully.
+ */
+template <typename T, int N, index_t W>
+__MATX_INLINE__ void HostSmallCholKernel(typename HostSmallTraits<T>::scalar_type *a,
+                                         index_t *info, [[maybe_unused]] index_t n_rt)
+{
+  using S = typename HostSmallTraits<T>::scalar_type;
+  const index_t n = N > 0 ? N : n_rt;
+
+  for (index_t j = 0; j < n; j++) {
+    S *ajj = a + HostSmallOffset<T, W>(j, j, n);
+    alignas(64) S d[W];
+    alignas(64) S rcp[W];
+
+    #pragma omp simd
+    for (index_t l = 0; l < W; l++) {
+      d[l] = ajj[l];
+    }
+    for (index_t k = 0; k < j; k++) {
+      const S *ljk = a + HostSmallOffset<T, W>(j, k, n);
+      #pragma omp simd
+      for (index_t l = 0; l < W; l++) {
+        d[l] -= ljk[l] * ljk[l];
+        if constexpr (HostSmallTraits<T>::cplx) {
+          d[l] -= ljk[W + l] * ljk[W + l];
+        }
+      }
+    }
+
+    #pragma omp simd
+    for (index_t l = 0; l < W; l++) {
+      const bool ok = d[l] > S(0);
+      info[l] = (info[l] == 0 && !ok) ? j + 1 : info[l];
+      const S s = ok ? std::sqrt(d[l]) : S(1);
+      ajj[l] = s;
+      if constexpr (HostSmallTraits<T>::cplx) {
+        ajj[W + l] = S(0);
+      }
+      rcp[l] = S(1) / s;
+    }
+
+    for (index_t i = j + 1; i < n; i++) {
+      S *aij = a + HostSmallOffset<T, W>(i, j, n);
+      for (index_t k = 0; k < j; k++) {
+        const S *lik = a + HostSmallOffset<T, W>(i, k, n);
+        const S *ljk = a + HostSmallOffset<T, W>(j, k, n);
+        // a(i, j) -= L(i, k) * conj(L(j, k))
+        #pragma omp simd
+        for (index_t l = 0; l < W; l++) {
+          if constexpr (HostSmallTraits<T>::cplx) {
+            aij[l] -= lik[l] * ljk[l] + lik[W + l] * ljk[W + l];
+            aij[W + l] -= lik[W + l] * ljk[l] - lik[l] * ljk[W + l];
+          } else {
+            aij[l] -= lik[l] * ljk[l];
+          }
+        }
+      }
+
+      #pragma omp simd
+      for (index_t l = 0; l < W; l++) {
+        aij[l] *= rcp[l];
+        if constexpr (HostSmallTraits<T>::cplx) {
+          aij[W + l] *= rcp[l];
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief In-place LU factorization P * A = L * U with partial pivoting of a group of N x N SoA matrices
+ *
+ * L (unit diagonal) and U overwrite A as in LAPACK getrf. piv[j * W + l] is
+ * the 0-based row that row j of lane l was swapped with at step j, and
+ * perm[r * W + l] the row of A that ends up in row r. Pivots are chosen by
+ * largest |re| + |im| like LAPACK's i?amax. info[l] is set to the 1-based
+ * index of the first zero pivot of lane l.
+ */
+template <typename T, int N, index_t W>
+__MATX_INLINE__ void HostSmallLuKernel(typename HostSmallTraits<T>::scalar_type *a,
+                                       index_t *piv, index_t *perm, index_t *info,
+                                       [[maybe_unused]] index_t n_rt)
+{
+  using S = typename HostSmallTraits<T>::scalar_type;
+  constexpr index_t P = HostSmallTraits<T>::P;
+  const index_t n = N > 0 ? N : n_rt;
+
+  const auto abs1 = [](const S *e, index_t l) {
+    if constexpr (HostSmallTraits<T>::cplx) {
+      return std::abs(e[l]) + std::abs(e[W + l]);
+    } else {
+      return std::abs(e[l]);
+    }
+  };
+
+  for (index_t r = 0; r < n; r++) {
+    #pragma omp simd
+    for (index_t l = 0; l < W; l++) {
+      perm[r * W + l] = r;
+    }
+  }
+
+  for (index_t j = 0; j < n; j++) {
+    S *ajj = a + HostSmallOffset<T, W>(j, j, n);
+    alignas(64) S best[W];
+    alignas(64) index_t p[W];
+
+    #pragma omp simd
+    for (index_t l = 0; l < W; l++) {
+      best[l] = abs1(ajj, l);
+      p[l] = j;
+    }
+    for (index_t r = j + 1; r < n; r++) {
+      const S *arj = a + HostSmallOffset<T, W>(r, j, n);
+      #pragma omp simd
+      for (index_t l = 0; l < W; l++) {
+        const S v = abs1(arj, l);
+        p[l] = v > best[l] ? r : p[l];
+        best[l] = v > best[l] ? v : best[l];
+      }
+    }
+
+    // Each lane swaps row j with its own pivot row. Rows that no lane picked
+    // are skipped, and the rest are swapped with a per-lane select.
+    for (index_t r = j + 1; r < n; r++) {
+      bool any = false;
+      for (index_t l = 0; l < W; l++) {
+        any = any || p[l] == r;
+      }
+      if (!any) {
+        continue;
+      }
+
+      for (index_t c = 0; c < n; c++) {
+        S *ej = a + HostSmallOffset<T, W>(j, c, n);
+        S *er = a + HostSmallOffset<T, W>(r, c, n);
+        #pragma omp simd
+        for (index_t q = 0; q < P * W; q++) {
+          const bool sw = p[q % W] == r;
+          const S tj = ej[q];
+          const S tr = er[q];
+          ej[q] = sw ? tr : tj;
+          er[q] = sw ? tj : tr;
+        }
+      }
+
+      #pragma omp simd
+      for (index_t l = 0; l < W; l++) {
+        const bool sw = p[l] == r;
+        const index_t tj = perm[j * W + l];
+        const index_t tr = perm[r * W + l];
+        perm[j * W + l] = sw ? tr : tj;
+        perm[r * W + l] = sw ? tj : tr;
+      }
+    }
+
+    alignas(64) S rre[W];
+    alignas(64) S rim[W];
+    #pragma omp simd
+    for (index_t l = 0; l < W; l++) {
+      piv[j * W + l] = p[l];
+      if constexpr (HostSmallTraits<T>::cplx) {
+        const bool zero = ajj[l] == S(0) && ajj[W + l] == S(0);
+        info[l] = (info[l] == 0 && zero) ? j + 1 : info[l];
+        const S den = zero ? S(1) : ajj[l] * ajj[l] + ajj[W + l] * ajj[W + l];
+        rre[l] = zero ? S(1) : ajj[l] / den;
+        rim[l] = zero ? S(0) : -ajj[W + l] / den;
+      } else {
+        const bool zero = ajj[l] == S(0);
+        info[l] = (info[l] == 0 && zero) ? j + 1 : info[l];
+        rre[l] = zero ? S(1) : S(1) / ajj[l];
+      }
+    }
+
+    for (index_t i = j + 1; i < n; i++) {
+      S *aij = a + HostSmallOffset<T, W>(i, j, n);
+      #pragma omp simd
+      for (index_t l = 0; l < W; l++) {
+        if constexpr (HostSmallTraits<T>::cplx) {
+          const S re = aij[l] * rre[l] - aij[W + l] * rim[l];
+          const S im = aij[l] * rim[l] + aij[W + l] * rre[l];
+          aij[l] = re;
+          aij[W + l] = im;
+        } else {
+          aij[l] *= rre[l];
+        }
+      }
+
+      for (index_t c = j + 1; c < n; c++) {
+        S *aic = a + HostSmallOffset<T, W>(i, c, n);
+        const S *ajc = a + HostSmallOffset<T, W>(j, c, n);
+        #pragma omp simd
+        for (index_t l = 0; l < W; l++) {
+          if constexpr (HostSmallTraits<T>::cplx) {
+            aic[l] -= aij[l] * ajc[l] - aij[W + l] * ajc[W + l];
+            aic[W + l] -= aij[l] * ajc[W + l] + aij[W + l] * ajc[l];
+          } else {
+            aic[l] -= aij[l] * ajc[l];
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Solve L * U * X = B in place on a group of SoA systems factored by HostSmallLuKernel
+ *
+ * b holds the N x nrhs right-hand sides with the rows already permuted by the
+ * factorization's row permutation, and is overwritten with X.
+ */
+template <typename T, int N, index_t W>
+__MATX_INLINE__ void HostSmallLuSolveKernel(const typename HostSmallTraits<T>::scalar_type *lu,
+                                            typename HostSmallTraits<T>::scalar_type *b,
+                                            index_t nrhs, [[maybe_unused]] index_t n_rt)
+{
+  using S = typename HostSmallTraits<T>::scalar_type;
+  const index_t n = N > 0 ? N : n_rt;
+
+  // b(i, :) -= f(i, k) * b(k, :), used by both the forward and backward substitution
+  const auto update = [&](index_t i, index_t k) {
+    const S *f = lu + HostSmallOffset<T, W>(i, k, n);
+    for (index_t c = 0; c < nrhs; c++) {
+      S *bi = b + HostSmallOffset<T, W>(i, c, nrhs);
+      const S *bk = b + HostSmallOffset<T, W>(k, c, nrhs);
+      #pragma omp simd
+      for (index_t l = 0; l < W; l++) {
+        if constexpr (HostSmallTraits<T>::cplx) {
+          bi[l] -= f[l] * bk[l] - f[W + l] * bk[W + l];
+          bi[W + l] -= f[l] * bk[W + l] + f[W + l] * bk[l];
+        } else {
+          bi[l] -= f[l] * bk[l];
+        }
+      }
+    }
+  };
+
+  for (index_t i = 1; i < n; i++) {
+    for (index_t k = 0; k < i; k++) {
+      update(i, k);
+    }
+  }
+
+  for (index_t i = n - 1; i >= 0; i--) {
+    for (index_t k = i + 1; k < n; k++) {
+      update(i, k);
+    }
+
+    const S *u = lu + HostSmallOffset<T, W>(i, i, n);
+    alignas(64) S rre[W];
+    alignas(64) S rim[W];
+    #pragma omp simd
+    for (index_t l = 0; l < W; l++) {
+      if constexpr (HostSmallTraits<T>::cplx) {
+        const S den = u[l] * u[l] + u[W + l] * u[W + l];
+        rre[l] = u[l] / den;
+        rim[l] = -u[W + l] / den;
+      } else {
+        rre[l] = S(1) / u[l];
+      }
+    }
+
+    for (index_t c = 0; c < nrhs; c++) {
+      S *bi = b + HostSmallOffset<T, W>(i, c, nrhs);
+      #pragma omp simd
+      for (index_t l = 0; l < W; l++) {
+        if constexpr (HostSmallTraits<T>::cplx) {
+          const S re = bi[l] * rre[l] - bi[W + l] * rim[l];
+          const S im = bi[l] * rim[l] + bi[W + l] * rre[l];
+          bi[l] = re;
+          bi[W + l] = im;
+        } else {
+          bi[l] *= rre[l];
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Run func over groups of up to W consecutive batches on the host's threads
+ *
+ * The groups are split into one contiguous range per thread and
+ * func(first_group, last_group) is called once per range, so scratch buffers
+ * are allocated once per thread. func returns the info of the first failing
+ * batch in its range or 0, and the first nonzero info in batch order is
+ * returned.
+ */
+template <index_t W, typename Func>
+__MATX_INLINE__ index_t HostSmallGroupFor(int num_threads, index_t batches, Func &&func)
+{
+  const index_t groups = (batches + W - 1) / W;
+  const index_t blocks = std::max(index_t{1}, std::min(static_cast<index_t>(num_threads), groups));
+  std::vector<index_t> block_info(static_cast<size_t>(blocks), 0);
+
+  HostParallelForBlocked(static_cast<int>(blocks), blocks, [&](index_t b0, index_t b1) {
+    for (index_t blk = b0; blk < b1; blk++) {
+      block_info[static_cast<size_t>(blk)] = func((groups * blk) / blocks, (groups * (blk + 1)) / blocks);
+    }
+  });
+
+  for (const auto info : block_info) {
+    if (info != 0) {
+      return info;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief Batched C = alpha * A * B + beta * C for m x k and k x n matrices no larger than HOST_SMALL_MAX_DIM
+ *
+ * @param ptrs Callable returning a tuple of the (A, B, C) pointers of a batch
+ */
+template <typename T, typename PtrFunc>
+__MATX_INLINE__ void HostSmallGemmBatched(index_t m, index_t n, index_t k, float alpha, float beta,
+                                          const HostSmallLayout &la, const HostSmallLayout &lb,
+                                          const HostSmallLayout &lc, index_t batches,
+                                          PtrFunc &&ptrs, int num_threads)
+{
+  using S = typename HostSmallTraits<T>::scalar_type;
+  constexpr index_t W = HostSmallTraits<T>::W;
+  constexpr index_t E = HostSmallTraits<T>::P * W;
+
+  HostSmallDimDispatch(k, [&](auto kc) {
+    constexpr int K = decltype(kc)::value;
+    HostSmallGroupFor<W>(num_threads, batches, [&](index_t g0, index_t g1) {
+      std::vector<S> abuf(static_cast<size_t>(m * k * E));
+      std::vector<S> bbuf(static_cast<size_t>(k * n * E));
+      std::vector<S> cbuf(static_cast<size_t>(m * n * E));
+      const T *ap[W];
+      const T *bp[W];
+      T *cp[W];
+
+      for (index_t g = g0; g < g1; g++) {
+        const index_t first = g * W;
+        const index_t count = std::min(W, batches - first);
+        for (index_t l = 0; l < count; l++) {
+          const auto p = ptrs(first + l);
+          ap[l] = cuda::std::get<0>(p);
+          bp[l] = cuda::std::get<1>(p);
+          cp[l] = cuda::std::get<2>(p);
+        }
+
+        HostSmallPack<T, W>(abuf.data(), ap, count, m, k, la, T(0));
+        HostSmallPack<T, W>(bbuf.data(), bp, count, k, n, lb, T(0));
+        if (beta != 0) {
+          HostSmallPack<T, W>(cbuf.data(), cp, count, m, n, lc, T(0));
+        }
+        HostSmallGemmKernel<T, K, W>(m, n, k, static_cast<S>(alpha), static_cast<S>(beta),
+                                     abuf.data(), bbuf.data(), cbuf.data());
+        HostSmallUnpack<T, W>(cbuf.data(), cp, count, m, n, lc);
+      }
+      return index_t{0};
+    });
+  });
+}
+
+/**
+ * @brief Batched in-place Cholesky factorization of n x n matrices no larger than HOST_SMALL_MAX_DIM
+ *
+ * The layout describes where the lower triangle of each matrix lives; only it
+ * is read and written.
+ *
+ * @param ptrs Callable returning the pointer of a batch
+ * @return LAPACK potrf-style info of the first failing batch, or 0
+ */
+template <typename T, typename PtrFunc>
+__MATX_INLINE__ index_t HostSmallCholBatched(index_t n, const HostSmallLayout &layout,
+                                             index_t batches, PtrFunc &&ptrs, int num_threads)
+{
+  using S = typename HostSmallTraits<T>::scalar_type;
+  constexpr index_t W = HostSmallTraits<T>::W;
+  constexpr index_t E = HostSmallTraits<T>::P * W;
+  index_t info = 0;
+
+  HostSmallDimDispatch(n, [&](auto nc) {
+    constexpr int N = decltype(nc)::value;
+    info = HostSmallGroupFor<W>(num_threads, batches, [&](index_t g0, index_t g1) {
+      std::vector<S> abuf(static_cast<size_t>(n * n * E));
+      T *ap[W];
+      index_t first_info = 0;
+
+      for (index_t g = g0; g < g1; g++) {
+        const index_t first = g * W;
+        const index_t count = std::min(W, batches - first);
+        index_t linfo[W] = {};
+        for (index_t l = 0; l < count; l++) {
+          ap[l] = ptrs(first + l);
+        }
+
+        HostSmallPack<T, W>(abuf.data(), ap, count, n, n, layout, T(1));
+        HostSmallCholKernel<T, N, W>(abuf.data(), linfo, n);
+        HostSmallUnpack<T, W>(abuf.data(), ap, count, n, n, layout, true);
+
+        for (index_t l = 0; l < count && first_info == 0; l++) {
+          first_info = linfo[l];
+        }
+      }
+      return first_info;
+    });
+  });
+
+  return info;
+}
+
+/**
+ * @brief Batched in-place LU factorization of n x n matrices no larger than HOST_SMALL_MAX_DIM
+ *
+ * The output matches LAPACK getrf, including 1-based pivot indices.
+ *
+ * @param ptrs Callable returning the matrix pointer of a batch
+ * @param piv_ptrs Callable returning the pivot vector pointer of a batch
+ * @return LAPACK getrf-style info of the first failing batch, or 0
+ */
+template <typename T, typename PtrFunc, typename PivFunc>
+__MATX_INLINE__ index_t HostSmallLuBatched(index_t n, const HostSmallLayout &layout,
+                                           index_t batches, PtrFunc &&ptrs, PivFunc &&piv_ptrs,
+                                           int num_threads)
+{
+  using S = typename HostSmallTraits<T>::scalar_type;
+  constexpr index_t W = HostSmallTraits<T>::W;
+  constexpr index_t E = HostSmallTraits<T>::P * W;
+  index_t info = 0;
+
+  HostSmallDimDispatch(n, [&](auto nc) {
+    constexpr int N = decltype(nc)::value;
+    info = HostSmallGroupFor<W>(num_threads, batches, [&](index_t g0, index_t g1) {
+      std::vector<S> abuf(static_cast<size_t>(n * n * E));
+      std::vector<index_t> piv(static_cast<size_t>(n * W));
+      std::vector<index_t> perm(static_cast<size_t>(n * W));
+      T *ap[W];
+      index_t first_info = 0;
+
+      for (index_t g = g0; g < g1; g++) {
+        const index_t first = g * W;
+        const index_t count = std::min(W, batches - first);
+        index_t linfo[W] = {};
+        for (index_t l = 0; l < count; l++) {
+          ap[l] = ptrs(first + l);
+        }
+
+        HostSmallPack<T, W>(abuf.data(), ap, count, n, n, layout, T(1));
+        HostSmallLuKernel<T, N, W>(abuf.data(), piv.data(), perm.data(), linfo, n);
+        HostSmallUnpack<T, W>(abuf.data(), ap, count, n, n, layout);
+
+        for (index_t l = 0; l < count; l++) {
+          auto *pp = piv_ptrs(first + l);
+          for (index_t j = 0; j < n; j++) {
+            pp[j] = static_cast<remove_cvref_t<decltype(*pp)>>(piv[static_cast<size_t>(j * W + l)] + 1);
+          }
+          if (first_info == 0) {
+            first_info = linfo[l];
+          }
+        }
+      }
+      return first_info;
+    });
+  });
+
+  return info;
+}
+
+/**
+ * @brief Batched matrix inverse through an LU factorization and solve
+ *
+ * Matrices up to HOST_SMALL_MAX_DIM use the unrolled, batch-interleaved
+ * kernels. Larger matrices use the runtime-sized kernels one matrix at a time.
+ *
+ * @param in_ptrs Callable returning the input matrix pointer of a batch
+ * @param out_ptrs Callable returning the output matrix pointer of a batch
+ * @return 1-based index of the first zero pivot of the first singular batch, or 0
+ */
+template <typename T, typename InFunc, typename OutFunc>
+__MATX_INLINE__ index_t HostSmallInvBatched(index_t n, const HostSmallLayout &lin,
+                                            const HostSmallLayout &lout, index_t batches,
+                                            InFunc &&in_ptrs, OutFunc &&out_ptrs, int num_threads)
+{
+  using S = typename HostSmallTraits<T>::scalar_type;
+  index_t info = 0;
+
+  const auto run = [&](auto wc, auto nc) {
+    constexpr index_t W = decltype(wc)::value;
+    constexpr int N = decltype(nc)::value;
+    constexpr index_t E = HostSmallTraits<T>::P * W;
+
+    info = HostSmallGroupFor<W>(num_threads, batches, [&](index_t g0, index_t g1) {
+      std::vector<S> abuf(static_cast<size_t>(n * n * E));
+      std::vector<S> xbuf(static_cast<size_t>(n * n * E));
+      std::vector<index_t> piv(static_cast<size_t>(n * W));
+      std::vector<index_t> perm(static_cast<size_t>(n * W));
+      const T *ap[W];
+      T *xp[W];
+      index_t first_info = 0;
+
+      for (index_t g = g0; g < g1; g++) {
+        const index_t first = g * W;
+        const index_t count = std::min(W, batches - first);
+        index_t linfo[W] = {};
+        for (index_t l = 0; l < count; l++) {
+          ap[l] = in_ptrs(first + l);
+          xp[l] = out_ptrs(first + l);
+        }
+
+        HostSmallPack<T, W>(abuf.data(), ap, count, n, n, lin, T(1));
+        HostSmallLuKernel<T, N, W>(abuf.data(), piv.data(), perm.data(), linfo, n);
+
+        // A^-1 solves L * U * X = P, where row r of P is the unit vector e(perm[r])
+        for (index_t r = 0; r < n; r++) {
+          for (index_t c = 0; c < n; c++) {
+            S *x = xbuf.data() + HostSmallOffset<T, W>(r, c, n);
+            #pragma omp simd
+            for (index_t l = 0; l < W; l++) {
+              x[l] = perm[static_cast<size_t>(r * W + l)] == c ? S(1) : S(0);
+              if constexpr (HostSmallTraits<T>::cplx) {
+                x[W + l] = S(0);
+              }
+            }
+          }
+        }
+        HostSmallLuSolveKernel<T, N, W>(abuf.data(), xbuf.data(), n, n);
+        HostSmallUnpack<T, W>(xbuf.data(), xp, count, n, n, lout);
+
+        for (index_t l = 0; l < count && first_info == 0; l++) {
+          first_info = linfo[l];
+        }
+      }
+      return first_info;
+    });
+  };
+
+  if (n <= HOST_SMALL_MAX_DIM) {
+    HostSmallDimDispatch(n, [&](auto nc) {
+      run(std::integral_constant<index_t, HostSmallTraits<T>::W>{}, nc);
+    });
+  } else {
+    run(std::integral_constant<index_t, 1>{}, std::integral_constant<int, 0>{});
+  }
+
+  return info;
+}
+
+} // end namespace detail
+
+} // end namespace matx
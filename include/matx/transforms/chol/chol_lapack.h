@@ -39,6 +39,7 @@
 #include "matx/executors/host.h"
 #include "matx/executors/support.h"
 #include "matx/transforms/solver_common.h"
+#include "matx/transforms/batched_small_host.h"
 
 #include <cstdio>
 #include <numeric>
@@ -137,20 +138,35 @@ public:
       (out = a).run(exec);
     }
 
+    const index_t batches = static_cast<index_t>(this->batch_a_ptrs.size());
     lapack_int_t info;
+    if (HostSmallEligible(params.n, batches)) {
+      // The kernels factor the lower triangle of a row-major matrix. A
+      // column-major lower triangle is that with the strides swapped, and a
+      // column-major upper triangle is its conjugate transpose.
+      const index_t n = params.n;
+      const HostSmallLayout layout = (uplo == 'L') ? HostSmallLayout{1, n, false}
+                                                   : HostSmallLayout{n, 1, true};
+      info = static_cast<lapack_int_t>(HostSmallCholBatched<T1>(n, layout, batches,
+        [&](index_t i) { return reinterpret_cast<T1*>(this->batch_a_ptrs[static_cast<size_t>(i)]); },
+        exec.GetNumThreads()));
+    } else {
+      info = HostLapackBatchFor(exec.GetNumThreads(), this->batch_a_ptrs.size(),
+        [&](size_t i, int) {
+          lapack_int_t binfo;
+          potrf_dispatch(&uplo, &params.n,
+                         reinterpret_cast<T1*>(this->batch_a_ptrs[i]),
+                         &params.n, &binfo);
+          return binfo;
+        });
+    }
 
-    for (size_t i = 0; i < this->batch_a_ptrs.size(); i++) {
-      potrf_dispatch(&uplo, &params.n,
-                     reinterpret_cast<T1*>(this->batch_a_ptrs[i]),
-                     &params.n, &info);
-
-      if (info < 0) {
-        MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
-          ("Parameter " + std::to_string(-info) + " had an illegal value in LAPACK potrf").c_str());
-      } else {
-        MATX_ASSERT_STR_EXP(info, 0, matxSolverError, 
-          (std::to_string(info) + "-th leading minor is not positive definite in LAPACK potrf").c_str());
-      }
+    if (info < 0) {
+      MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
+        ("Parameter " + std::to_string(-info) + " had an illegal value in LAPACK potrf").c_str());
+    } else {
+      MATX_ASSERT_STR_EXP(info, 0, matxSolverError, 
+        (std::to_string(info) + "-th leading minor is not positive definite in LAPACK potrf").c_str());
     }
   }
 
@@ -0,0 +1,197 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <vector>
+
+#include "matx/core/sparse_tensor.h"
+#include "matx/core/tensor.h"
+#include "matx/executors/host.h"
+#include "matx/transforms/convert/dense2sparse_cusparse.h"
+
+namespace matx {
+
+namespace detail {
+
+/**
+ * Sizes the values and the coordinates of the compressed levels of a host
+ * COO/CSR/CSC output for nse stored elements. Storage the output already
+ * holds is kept when it is large enough, and only its logical size changes,
+ * so repeated conversions into a preallocated sparse tensor do not allocate
+ * and the buffers it was made from stay referenced. Otherwise new memory is
+ * taken from the given space, as the cuSPARSE conversions do.
+ */
+template <typename OutputTensorType>
+__MATX_INLINE__ static void resizeHostSparseOutput(OutputTensorType &o, index_t nse,
+                                                   matxMemorySpace_t space) {
+  using VAL = typename OutputTensorType::val_type;
+  using CRD = typename OutputTensorType::crd_type;
+
+  if (o.Data() != nullptr && o.NseCapacity() >= nse) {
+    o.SetNse(nse);
+  } else {
+    o.SetVal(makeDefaultNonOwningStorage<VAL>(static_cast<size_t>(nse), space, 0));
+  }
+
+  const int first = OutputTensorType::Format::isCOO() ? 0 : 1;
+  for (int l = first; l < 2; l++) {
+    if (o.CRDData(l) != nullptr && o.crdCapacity(l) >= nse) {
+      o.SetCrdSize(l, nse);
+    } else {
+      o.SetCrd(l, makeDefaultNonOwningStorage<CRD>(static_cast<size_t>(nse), space, 0));
+    }
+  }
+
+  o.SetSparseDataImpl();
+}
+
+__MATX_INLINE__ static void checkHostSparseSpace(const void *ptr) {
+  [[maybe_unused]] const matxMemorySpace_t space = GetPointerKind(ptr);
+  MATX_ASSERT_STR(space != MATX_DEVICE_MEMORY && space != MATX_ASYNC_DEVICE_MEMORY,
+                  matxInvalidParameter,
+                  "Host sparse conversion requires host-accessible sparse storage");
+}
+
+template <typename Op>
+__MATX_INLINE__ auto getD2SHostSupportedTensor(const Op &in) {
+  // Any strided view can be read directly on the host
+  const auto func = [&]() { return true; };
+  return GetSupportedTensor(in, func, MATX_HOST_MALLOC_MEMORY);
+}
+
+} // end namespace detail
+
+/**
+ * Dense to sparse conversion on the host. Nonzeros are counted per row (or
+ * column for CSC) in parallel, the counts are scanned into positions, and the
+ * nonzeros are then scattered into place in parallel.
+ */
+template <typename OutputTensorType, typename InputTensorType, ThreadsMode MODE>
+void dense2sparse_impl(OutputTensorType &o, const InputTensorType &A,
+                       const HostExecutor<MODE> &exec) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+
+  // Transform into supported form.
+  auto a = detail::getD2SHostSupportedTensor(A);
+  if (!is_matx_transform_op<InputTensorType>() && !a.isSameView(A)) {
+    (a = A).run(exec);
+  }
+
+  using atype = decltype(a);
+  using otype = OutputTensorType;
+
+  using TA = typename atype::value_type;
+  using TO = typename otype::value_type;
+
+  using VAL = typename otype::val_type;
+  using POS = typename otype::pos_type;
+  using CRD = typename otype::crd_type;
+
+  static constexpr int RANKA = atype::Rank();
+  static constexpr int RANKO = otype::Rank();
+
+  // Restrictions.
+  static_assert(RANKA == RANKO, "tensors must have same rank");
+  static_assert(RANKA == 2, "tensors must have rank-2");
+  static_assert(std::is_same_v<TA, TO>, "tensors must have the same data type");
+  static_assert(otype::Format::isCOO() || otype::Format::isCSR() ||
+                    otype::Format::isCSC(),
+                "Dense2Sparse currently only supports COO/CSR/CSC");
+
+  const int threads = exec.GetNumThreads();
+  const index_t m = a.Size(0);
+  const index_t n = a.Size(1);
+  const index_t s0 = a.Stride(0);
+  const index_t s1 = a.Stride(1);
+  const TA *ad = a.Data();
+  const TA zero{0};
+
+  // The major dimension is compressed: rows for COO/CSR, columns for CSC.
+  constexpr bool by_col = otype::Format::isCSC();
+  const index_t major = by_col ? n : m;
+  const index_t minor = by_col ? m : n;
+  const index_t smaj = by_col ? s1 : s0;
+  const index_t smin = by_col ? s0 : s1;
+
+  std::vector<POS> pos(major + 1);
+  detail::HostParallelForBlocked(threads, major, [&](index_t i0, index_t i1) {
+    for (index_t i = i0; i < i1; i++) {
+      POS cnt = 0;
+      for (index_t j = 0; j < minor; j++) {
+        cnt += ad[i * smaj + j * smin] != zero;
+      }
+      pos[i] = cnt;
+    }
+  });
+  const index_t nnz = static_cast<index_t>(
+      detail::HostParallelExclusiveScan(threads, pos.data(), major));
+  pos[major] = static_cast<POS>(nnz);
+
+  // Pre-allocate sparse tensor output.
+  const int lvl = otype::Format::isCOO() ? 0 : 1;
+  detail::checkHostSparseSpace(o.POSData(lvl));
+  const matxMemorySpace_t space = GetPointerKind(o.POSData(lvl));
+  detail::resizeHostSparseOutput(o, nnz, space);
+
+  VAL *val = o.Data();
+  CRD *crd = o.CRDData(1);
+  CRD *rows = otype::Format::isCOO() ? o.CRDData(0) : nullptr;
+  detail::HostParallelForBlocked(threads, major, [&](index_t i0, index_t i1) {
+    for (index_t i = i0; i < i1; i++) {
+      index_t e = static_cast<index_t>(pos[i]);
+      for (index_t j = 0; j < minor; j++) {
+        const TA v = ad[i * smaj + j * smin];
+        if (v != zero) {
+          val[e] = v;
+          crd[e] = static_cast<CRD>(j);
+          if (rows != nullptr) {
+            rows[e] = static_cast<CRD>(i);
+          }
+          e++;
+        }
+      }
+    }
+  });
+
+  if constexpr (otype::Format::isCOO()) {
+    // The top level of COO holds positions {0, nse}
+    POS *top = o.POSData(0);
+    top[0] = 0;
+    top[1] = static_cast<POS>(nnz);
+  } else {
+    std::copy(pos.begin(), pos.end(), o.POSData(1));
+  }
+}
+
+} // end namespace matx
@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "matx/core/sparse_tensor.h"
+#include "matx/core/tensor.h"
+#include "matx/executors/host.h"
+#include "matx/transforms/convert/dense2sparse_host.h"
+
+namespace matx {
+
+namespace detail {
+
+template <typename Op>
+__MATX_INLINE__ auto getS2DHostSupportedTensor(const Op &in) {
+  // Any strided view can be written directly on the host
+  const auto func = [&]() { return true; };
+  return GetSupportedTensor(in, func, MATX_HOST_MALLOC_MEMORY);
+}
+
+} // end namespace detail
+
+/**
+ * Sparse to dense conversion on the host. The output is zeroed and the
+ * nonzeros are scattered into it in parallel, with each thread owning a
+ * range of rows (COO/CSR/DIA) or columns (CSC).
+ */
+template <typename OutputTensorType, typename InputTensorType, ThreadsMode MODE>
+void sparse2dense_impl(OutputTensorType &O, const InputTensorType &a,
+                       const HostExecutor<MODE> &exec) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+
+  // Transform into supported form.
+  auto o = detail::getS2DHostSupportedTensor(O);
+
+  using atype = InputTensorType;
+  using otype = decltype(o);
+
+  using TA = typename atype::value_type;
+  using TO = typename otype::value_type;
+
+  static constexpr int RANKA = atype::Rank();
+  static constexpr int RANKO = otype::Rank();
+
+  // Restrictions.
+  static_assert(RANKA == RANKO, "tensors must have same rank");
+  static_assert(RANKA == 2, "tensors must have rank-2");
+  static_assert(std::is_same_v<TA, TO>, "tensors must have the same data type");
+  static_assert(atype::Format::isCOO() || atype::Format::isCSR() ||
+                    atype::Format::isCSC() || atype::Format::isDIAI() ||
+                    atype::Format::isDIAJ(),
+                "Sparse2Dense currently only supports COO/CSR/CSC/DIA");
+  detail::checkHostSparseSpace(a.Data());
+
+  const int threads = exec.GetNumThreads();
+  const index_t m = o.Size(0);
+  const index_t n = o.Size(1);
+  const index_t s0 = o.Stride(0);
+  const index_t s1 = o.Stride(1);
+  TO *od = o.Data();
+  const TA *val = a.Data();
+
+  detail::HostParallelForBlocked(threads, m, [&](index_t i0, index_t i1) {
+    for (index_t i = i0; i < i1; i++) {
+      for (index_t j = 0; j < n; j++) {
+        od[i * s0 + j * s1] = TO{0};
+      }
+    }
+  });
+
+  if constexpr (atype::Format::isCSR() || atype::Format::isCSC()) {
+    constexpr bool by_col = atype::Format::isCSC();
+    const index_t major = by_col ? n : m;
+    const index_t smaj = by_col ? s1 : s0;
+    const index_t smin = by_col ? s0 : s1;
+    const auto *pos = a.POSData(1);
+    const auto *crd = a.CRDData(1);
+    detail::HostParallelForBlocked(threads, major, [&](index_t i0, index_t i1) {
+      for (index_t i = i0; i < i1; i++) {
+        for (auto e = pos[i]; e < pos[i + 1]; e++) {
+          od[i * smaj + static_cast<index_t>(crd[e]) * smin] = val[e];
+        }
+      }
+    });
+  } else if constexpr (atype::Format::isCOO()) {
+    // COO coordinates are unique, so entries can be scattered in any order
+    const auto *rows = a.CRDData(0);
+    const auto *cols = a.CRDData(1);
+    detail::HostParallelForBlocked(threads, a.Nse(), [&](index_t e0, index_t e1) {
+      for (index_t e = e0; e < e1; e++) {
+        od[static_cast<index_t>(rows[e]) * s0 + static_cast<index_t>(cols[e]) * s1] = val[e];
+      }
+    });
+  } else {
+    const auto *diags = a.CRDData(0);
+    const index_t numD = a.crdSize(0);
+    detail::HostParallelForBlocked(threads, m, [&](index_t i0, index_t i1) {
+      for (index_t i = i0; i < i1; i++) {
+        for (index_t d = 0; d < numD; d++) {
+          const index_t j = i + static_cast<index_t>(diags[d]); // signed
+          if (0 <= j && j < n) {
+            od[i * s0 + j * s1] = atype::Format::isDIAI() ? val[d * m + i] : val[d * n + j];
+          }
+        }
+      }
+    });
+  }
+
+  // Copy transformed output back.
+  if (!o.isSameView(O)) {
+    (O = o).run(exec);
+  }
+}
+
+} // end namespace matx
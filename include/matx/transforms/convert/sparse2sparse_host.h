@@ -0,0 +1,299 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "matx/core/sparse_tensor.h"
+#include "matx/core/tensor.h"
+#include "matx/executors/host.h"
+#include "matx/transforms/convert/dense2sparse_host.h"
+
+namespace matx {
+
+namespace detail {
+
+/**
+ * Compress nse (major, minor, value) entries into positions over the major
+ * dimension, with minor coordinates sorted within each major index and
+ * duplicate coordinates summed.
+ *
+ * Entries are first bucketed by major index with a stable parallel counting
+ * sort: each block of entries builds its own histogram, so blocks scatter
+ * without contention. Segments that are not already sorted by minor index
+ * are then sorted, duplicates are counted, and the final compacted entries
+ * are written straight into the output buffers returned by alloc(nnz).
+ */
+template <typename POS, typename CRD, typename VAL, typename MajFn,
+          typename MinFn, typename ValFn, typename AllocFn>
+__MATX_INLINE__ void
+SparseHostCompress(index_t nse, index_t major, MajFn &&maj_at, MinFn &&min_at,
+                   ValFn &&val_at, POS *pos_out, AllocFn &&alloc,
+                   int threads) {
+  // Bound the histogram memory by the number of entries
+  const index_t blocks = std::clamp(nse / std::max(major, index_t{1}),
+                                    index_t{1}, static_cast<index_t>(threads));
+  std::vector<index_t> hist(blocks * major, 0);
+  std::vector<index_t> seg(major + 1, 0);
+
+  HostParallelForBlocked(threads, blocks, [&](index_t b0, index_t b1) {
+    for (index_t b = b0; b < b1; b++) {
+      index_t *h = hist.data() + b * major;
+      for (index_t e = (nse * b) / blocks; e < (nse * (b + 1)) / blocks; e++) {
+        h[maj_at(e)]++;
+      }
+    }
+  });
+
+  HostParallelForBlocked(threads, major, [&](index_t j0, index_t j1) {
+    for (index_t j = j0; j < j1; j++) {
+      index_t sum = 0;
+      for (index_t b = 0; b < blocks; b++) {
+        sum += hist[b * major + j];
+      }
+      seg[j] = sum;
+    }
+  });
+  HostParallelExclusiveScan(threads, seg.data(), major);
+  seg[major] = nse;
+
+  // Turn the histograms into per-block write offsets
+  HostParallelForBlocked(threads, major, [&](index_t j0, index_t j1) {
+    for (index_t j = j0; j < j1; j++) {
+      index_t off = seg[j];
+      for (index_t b = 0; b < blocks; b++) {
+        const index_t cnt = hist[b * major + j];
+        hist[b * major + j] = off;
+        off += cnt;
+      }
+    }
+  });
+
+  std::vector<CRD> crd(nse);
+  std::vector<VAL> val(nse);
+  HostParallelForBlocked(threads, blocks, [&](index_t b0, index_t b1) {
+    for (index_t b = b0; b < b1; b++) {
+      index_t *h = hist.data() + b * major;
+      for (index_t e = (nse * b) / blocks; e < (nse * (b + 1)) / blocks; e++) {
+        const index_t dst = h[maj_at(e)]++;
+        crd[dst] = static_cast<CRD>(min_at(e));
+        val[dst] = val_at(e);
+      }
+    }
+  });
+
+  // Sort each segment by minor index and count the unique coordinates
+  std::vector<POS> uniq(major + 1, 0);
+  HostParallelForBlocked(threads, major, [&](index_t j0, index_t j1) {
+    std::vector<index_t> perm;
+    std::vector<CRD> tcrd;
+    std::vector<VAL> tval;
+    for (index_t j = j0; j < j1; j++) {
+      const index_t s = seg[j];
+      const index_t len = seg[j + 1] - s;
+      if (!std::is_sorted(crd.begin() + s, crd.begin() + s + len)) {
+        perm.resize(len);
+        std::iota(perm.begin(), perm.end(), index_t{0});
+        std::stable_sort(perm.begin(), perm.end(), [&](index_t x, index_t y) {
+          return crd[s + x] < crd[s + y];
+        });
+        tcrd.resize(len);
+        tval.resize(len);
+        for (index_t x = 0; x < len; x++) {
+          tcrd[x] = crd[s + perm[x]];
+          tval[x] = val[s + perm[x]];
+        }
+        std::copy(tcrd.begin(), tcrd.end(), crd.begin() + s);
+        std::copy(tval.begin(), tval.end(), val.begin() + s);
+      }
+      POS cnt = 0;
+      for (index_t x = 0; x < len; x++) {
+        cnt += (x == 0 || crd[s + x] != crd[s + x - 1]);
+      }
+      uniq[j] = cnt;
+    }
+  });
+  const index_t nnz = static_cast<index_t>(
+      HostParallelExclusiveScan(threads, uniq.data(), major));
+  uniq[major] = static_cast<POS>(nnz);
+
+  auto [crd_out, val_out] = alloc(nnz);
+  HostParallelForBlocked(threads, major, [&](index_t j0, index_t j1) {
+    for (index_t j = j0; j < j1; j++) {
+      index_t d = static_cast<index_t>(uniq[j]) - 1;
+      for (index_t x = seg[j]; x < seg[j + 1]; x++) {
+        if (x == seg[j] || crd[x] != crd[x - 1]) {
+          d++;
+          crd_out[d] = crd[x];
+          val_out[d] = val[x];
+        } else {
+          val_out[d] += val[x];
+        }
+      }
+    }
+  });
+
+  std::copy(uniq.begin(), uniq.end(), pos_out);
+}
+
+// Expand compressed positions into one major coordinate per entry
+template <typename POS>
+__MATX_INLINE__ std::vector<index_t>
+SparseHostExpandPositions(const POS *pos, index_t major, int threads) {
+  std::vector<index_t> idx(static_cast<index_t>(pos[major]));
+  HostParallelForBlocked(threads, major, [&](index_t j0, index_t j1) {
+    for (index_t j = j0; j < j1; j++) {
+      for (index_t e = static_cast<index_t>(pos[j]); e < static_cast<index_t>(pos[j + 1]); e++) {
+        idx[e] = j;
+      }
+    }
+  });
+  return idx;
+}
+
+} // end namespace detail
+
+/**
+ * Sparse to sparse conversion on the host between COO, CSR and CSC. CSR and
+ * CSC conversions are a parallel transpose. COO input may be unsorted and
+ * may contain duplicates: it is sorted in parallel, and duplicates are summed.
+ */
+template <typename OutputTensorType, typename InputTensorType, ThreadsMode MODE>
+void sparse2sparse_impl(OutputTensorType &o, const InputTensorType &a,
+                        const HostExecutor<MODE> &exec) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+
+  using atype = InputTensorType;
+  using otype = OutputTensorType;
+
+  using TA = typename atype::value_type;
+  using TO = typename otype::value_type;
+
+  using VAL = typename otype::val_type;
+  using POS = typename otype::pos_type;
+  using CRD = typename otype::crd_type;
+
+  static constexpr int RANKA = atype::Rank();
+  static constexpr int RANKO = otype::Rank();
+
+  // Restrictions.
+  static_assert(RANKA == 2 && RANKO == 2, "tensors must have rank-2");
+  static_assert(std::is_same_v<TA, TO>, "tensors must have the same data type");
+  static_assert(atype::Format::isCOO() || atype::Format::isCSR() ||
+                    atype::Format::isCSC(),
+                "Sparse2Sparse currently only supports COO/CSR/CSC input");
+  static_assert(otype::Format::isCOO() || otype::Format::isCSR() ||
+                    otype::Format::isCSC(),
+                "Sparse2Sparse currently only supports COO/CSR/CSC output");
+  detail::checkHostSparseSpace(a.Data());
+
+  const int threads = exec.GetNumThreads();
+  const index_t m = a.Size(0);
+  const index_t n = a.Size(1);
+  const index_t nse = a.Nse();
+  const TA *aval = a.Data();
+
+  // Row and column coordinate of every input entry. Compressed inputs get
+  // their major coordinate expanded; the other one is read in place.
+  std::vector<index_t> expanded;
+  if constexpr (atype::Format::isCSR()) {
+    expanded = detail::SparseHostExpandPositions(a.POSData(1), m, threads);
+  } else if constexpr (atype::Format::isCSC()) {
+    expanded = detail::SparseHostExpandPositions(a.POSData(1), n, threads);
+  }
+  const auto row_at = [&](index_t e) -> index_t {
+    if constexpr (atype::Format::isCOO()) {
+      return static_cast<index_t>(a.CRDData(0)[e]);
+    } else if constexpr (atype::Format::isCSR()) {
+      return expanded[e];
+    } else {
+      return static_cast<index_t>(a.CRDData(1)[e]);
+    }
+  };
+  const auto col_at = [&](index_t e) -> index_t {
+    if constexpr (atype::Format::isCOO() || atype::Format::isCSR()) {
+      return static_cast<index_t>(a.CRDData(1)[e]);
+    } else {
+      return expanded[e];
+    }
+  };
+  const auto val_at = [&](index_t e) -> VAL { return aval[e]; };
+
+  constexpr bool by_col = otype::Format::isCSC();
+  const index_t major = by_col ? n : m;
+  const int lvl = otype::Format::isCOO() ? 0 : 1;
+  detail::checkHostSparseSpace(o.POSData(lvl));
+  const matxMemorySpace_t space = GetPointerKind(o.POSData(lvl));
+
+  // COO output compresses into a temporary row position array, which is
+  // expanded into row coordinates afterwards.
+  std::vector<POS> coo_pos;
+  POS *pos_out = o.POSData(1);
+  if constexpr (otype::Format::isCOO()) {
+    coo_pos.resize(m + 1);
+    pos_out = coo_pos.data();
+  }
+
+  const auto alloc = [&](index_t nnz) {
+    detail::resizeHostSparseOutput(o, nnz, space);
+    return std::make_pair(o.CRDData(1), o.Data());
+  };
+
+  if constexpr (by_col) {
+    detail::SparseHostCompress<POS, CRD, VAL>(nse, major, col_at, row_at, val_at,
+                                              pos_out, alloc, threads);
+  } else {
+    detail::SparseHostCompress<POS, CRD, VAL>(nse, major, row_at, col_at, val_at,
+                                              pos_out, alloc, threads);
+  }
+
+  if constexpr (otype::Format::isCOO()) {
+    CRD *rows = o.CRDData(0);
+    detail::HostParallelForBlocked(threads, m, [&](index_t i0, index_t i1) {
+      for (index_t i = i0; i < i1; i++) {
+        for (index_t e = static_cast<index_t>(coo_pos[i]); e < static_cast<index_t>(coo_pos[i + 1]); e++) {
+          rows[e] = static_cast<CRD>(i);
+        }
+      }
+    });
+    POS *top = o.POSData(0);
+    top[0] = 0;
+    top[1] = coo_pos[m];
+  }
+}
+
+} // end namespace matx
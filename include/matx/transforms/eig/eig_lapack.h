@@ -196,18 +196,23 @@ public:
       (out = a).run(exec);
     }
 
-    lapack_int_t info;
-    for (size_t i = 0; i < this->batch_a_ptrs.size(); i++) {
-      syevd_dispatch(&jobz, &uplo, &params.n,
-                      reinterpret_cast<T1*>(this->batch_a_ptrs[i]),
-                      &params.n, reinterpret_cast<T2*>(this->batch_w_ptrs[i]),
-                      reinterpret_cast<T1*>(this->work), &this->lwork,
-                      reinterpret_cast<T2*>(this->rwork), &this->lrwork,
-                      reinterpret_cast<lapack_int_t*>(this->iwork), &this->liwork, &info);
-
-      MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
-          (std::to_string(info) + " off-diagonal elements of an intermediate tridiagonal form did not converge to zero in LAPACK syevd").c_str());
-    }
+    const size_t batches = this->batch_a_ptrs.size();
+    this->AllocateWorkspaceSlots(HostLapackBatchSlots(exec.GetNumThreads(), batches));
+
+    const lapack_int_t info = HostLapackBatchFor(exec.GetNumThreads(), batches,
+      [&](size_t i, int slot) {
+        lapack_int_t binfo;
+        syevd_dispatch(&jobz, &uplo, &params.n,
+                        reinterpret_cast<T1*>(this->batch_a_ptrs[i]),
+                        &params.n, reinterpret_cast<T2*>(this->batch_w_ptrs[i]),
+                        this->WorkSlot(slot), &this->lwork,
+                        this->RworkSlot(slot), &this->lrwork,
+                        this->IworkSlot(slot), &this->liwork, &binfo);
+        return binfo;
+      });
+
+    MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
+        (std::to_string(info) + " off-diagonal elements of an intermediate tridiagonal form did not converge to zero in LAPACK syevd").c_str());
   }
 
   /**
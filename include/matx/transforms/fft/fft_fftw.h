@@ -39,6 +39,7 @@
 #include "matx/core/tensor.h"
 #include "matx/executors/host.h"
 #include "matx/transforms/fft/fft_common.h"
+#include "matx/transforms/fft/fft_host.h"
 #include "matx/transforms/copy.h"
 #include "matx/executors/support.h"
 #ifdef MATX_EN_NVPL
@@ -51,14 +52,23 @@
 #include <omp.h>
 #endif
 #include <cstdio>
+#include <fstream>
 #include <functional>
+#include <mutex>
 #include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
 #include <cuda/atomic>
 
 namespace matx {
 
 namespace detail {
 
+// Most batch dimensions an FFTW guru plan describes directly. Batch dimensions that
+// step through memory as one are merged first, so this only limits odd layouts.
+static constexpr int MAX_FFT_GURU_BATCH_RANK = 8;
+
 /**
  * Parameters needed to execute an FFT/IFFT in FFTW
  */
@@ -72,12 +82,44 @@ struct FftFFTWParams_t {
   int istride, ostride;
   int idist, odist;
   FFTType transform_type; // Known from input/output type, but still useful
+  MatXDataType_t input_type;
+  MatXDataType_t output_type;
   int fft_rank;
   bool is_fp32;
   bool in_place;
   detail::FFTDirection dir;
+  FFTWPlannerEffort effort = FFTWPlannerEffort::ESTIMATE;
+
+  // Guru layout, used instead of the plan_many parameters above when guru is set.
+  // Strides are in elements of the input and output types.
+  bool guru = false;
+  int howmany_rank = 0;
+  index_t dim_is[MAX_FFT_RANK] = {0};
+  index_t dim_os[MAX_FFT_RANK] = {0};
+  index_t howmany_n[MAX_FFT_GURU_BATCH_RANK] = {0};
+  index_t howmany_is[MAX_FFT_GURU_BATCH_RANK] = {0};
+  index_t howmany_os[MAX_FFT_GURU_BATCH_RANK] = {0};
+
+  // FFTW alignment of the arrays the plan was made for. A plan may only run on arrays
+  // with the same alignment.
+  int in_align = 0;
+  int out_align = 0;
 };
 
+/**
+ * Planner effort used by executors that don't set their own
+ */
+inline cuda::std::atomic<FFTWPlannerEffort> fftw_planner_effort{FFTWPlannerEffort::ESTIMATE};
+
+/**
+ * Planner effort for FFTs run on exec: its own effort if set, and otherwise the global one
+ */
+template <ThreadsMode MODE>
+__MATX_INLINE__ FFTWPlannerEffort GetFFTWPlannerEffort(const HostExecutor<MODE> &exec) {
+  const auto effort = exec.GetFFTWPlannerEffort();
+  return effort == FFTWPlannerEffort::DEFAULT ? fftw_planner_effort.load() : effort;
+}
+
   template <typename OutTensorType, typename InTensorType>
   static FftFFTWParams_t GetFFTParams(OutTensorType &o,
                           const InTensorType &i, int fft_rank,
@@ -93,6 +135,8 @@ struct FftFFTWParams_t {
     params.orank = o.Rank();
 
     params.transform_type = DeduceFFTTransformType<OutTensorType, InTensorType>();
+    params.input_type = TypeToInt<T2>();
+    params.output_type = TypeToInt<T1>();
     params.fft_rank =  fft_rank;
     params.dir = dir;
 
@@ -161,7 +205,7 @@ struct FftFFTWParams_t {
     if (params.fft_rank == 1) {
       if (params.transform_type == FFTType::C2R ||
           params.transform_type == FFTType::Z2D) {
-        if (is_cuda_complex_v<T1> || !is_cuda_complex_v<T2>) {
+        if (is_complex_v<T1> || !is_complex_v<T2>) {
           MATX_THROW(matxInvalidType, "FFT types inconsistent with C2R/Z2D transform");
         }
         if (params.n[0] != o.Size(OutTensorType::Rank()-1) ||
@@ -171,7 +215,7 @@ struct FftFFTWParams_t {
       }
       else if (params.transform_type == FFTType::R2C ||
               params.transform_type == FFTType::D2Z) {
-        if (is_cuda_complex_v<T2> || !is_cuda_complex_v<T1>) {
+        if (is_complex_v<T2> || !is_complex_v<T1>) {
           MATX_THROW(matxInvalidType, "FFT types inconsistent with R2C/D2Z transform");
         }
         if (params.n[0] != i.Size(InTensorType::Rank()-1) ||
@@ -194,14 +238,14 @@ struct FftFFTWParams_t {
           params.transform_type == FFTType::Z2D) {
         MATX_ASSERT((o.Size(RANK-2) * (o.Size(RANK-1) / 2 + 1)) == i.Size(RANK-1) * i.Size(RANK-2),
                     matxInvalidSize);
-        MATX_ASSERT(!is_cuda_complex_v<T1> && is_cuda_complex_v<T2>,
+        MATX_ASSERT(!is_complex_v<T1> && is_complex_v<T2>,
                     matxInvalidType);
       }
       else if (params.transform_type == FFTType::R2C ||
               params.transform_type == FFTType::D2Z) {
         MATX_ASSERT(o.Size(RANK-1) * o.Size(RANK-2) == (i.Size(RANK-2) * (i.Size(RANK-1) / 2 + 1)),
                     matxInvalidSize);
-        MATX_ASSERT(!is_cuda_complex_v<T2> && is_cuda_complex_v<T1>,
+        MATX_ASSERT(!is_complex_v<T2> && is_complex_v<T1>,
                     matxInvalidType);
       }
       else {
@@ -221,6 +265,60 @@ struct FftFFTWParams_t {
     return params;
   }
 
+/**
+ * Whether FFTW can run these tensor types on any strided layout through its guru
+ * interface. The built-in host FFT and NVPL need packed batches instead.
+ */
+template <typename OutTensorType, typename InTensorType>
+constexpr bool FFTWGuruSupported() {
+#ifdef MATX_EN_X86_FFTW
+  using out_inner_type = typename inner_op_type_t<typename OutTensorType::value_type>::type;
+  return !is_half_v<out_inner_type> && !is_matx_half_v<out_inner_type> &&
+         OutTensorType::Rank() - 1 <= MAX_FFT_GURU_BATCH_RANK;
+#else
+  return false;
+#endif
+}
+
+/**
+ * Describe the tensors' real strides to a guru plan. The last fft_rank dimensions are
+ * transformed and every other dimension is a batch dimension.
+ */
+template <typename OutTensorType, typename InTensorType>
+__MATX_INLINE__ void SetFFTWGuruLayout(FftFFTWParams_t &params, const OutTensorType &o,
+                                       const InTensorType &i)
+{
+  constexpr int RANK = OutTensorType::Rank();
+  const int batch_rank = RANK - params.fft_rank;
+
+  params.guru = true;
+  for (int d = 0; d < params.fft_rank; d++) {
+    params.dim_is[d] = i.Stride(batch_rank + d);
+    params.dim_os[d] = o.Stride(batch_rank + d);
+  }
+
+  // Neighbouring batch dimensions that step through memory as one become one dimension
+  params.howmany_rank = 0;
+  for (int r = 0; r < batch_rank; r++) {
+    const index_t n = o.Size(r);
+    const int h = params.howmany_rank;
+    if (n == 1) {
+      continue;
+    }
+
+    if (h > 0 && params.howmany_is[h - 1] == i.Stride(r) * n &&
+                 params.howmany_os[h - 1] == o.Stride(r) * n) {
+      params.howmany_n[h - 1] *= n;
+    }
+    else {
+      params.howmany_n[h] = n;
+      params.howmany_rank++;
+    }
+    params.howmany_is[params.howmany_rank - 1] = i.Stride(r);
+    params.howmany_os[params.howmany_rank - 1] = o.Stride(r);
+  }
+}
+
 /**
  * Crude hash on FFT to get a reasonably good delta for collisions. This
  * doesn't need to be perfect, but fast enough to not slow down lookups, and
@@ -251,7 +349,31 @@ struct FftFFTWParamsKeyEq {
            l.istride == t.istride && l.ostride == t.ostride &&
            l.idist == t.idist && l.odist == t.odist &&
            l.transform_type == t.transform_type &&
-           l.irank == t.irank && l.orank == t.orank ;
+           l.input_type == t.input_type && l.output_type == t.output_type &&
+           l.irank == t.irank && l.orank == t.orank &&
+           l.effort == t.effort && l.guru == t.guru &&
+           l.in_align == t.in_align && l.out_align == t.out_align &&
+           (!l.guru || GuruLayoutEq(l, t));
+  }
+
+private:
+  static bool GuruLayoutEq(const FftFFTWParams_t &l, const FftFFTWParams_t &t) noexcept
+  {
+    if (l.howmany_rank != t.howmany_rank) {
+      return false;
+    }
+    for (int d = 0; d < l.fft_rank; d++) {
+      if (l.dim_is[d] != t.dim_is[d] || l.dim_os[d] != t.dim_os[d]) {
+        return false;
+      }
+    }
+    for (int d = 0; d < l.howmany_rank; d++) {
+      if (l.howmany_n[d] != t.howmany_n[d] || l.howmany_is[d] != t.howmany_is[d] ||
+          l.howmany_os[d] != t.howmany_os[d]) {
+        return false;
+      }
+    }
+    return true;
   }
 };
 
@@ -270,6 +392,11 @@ public:
       int ret = fftwf_init_threads();
       MATX_ASSERT_STR(ret != 0, matxAssertError, "fftwf_init_threads() failed");
       init_fp32_ = true;
+#ifdef MATX_EN_X86_FFTW
+      if (!wisdom_fp32_.empty()) {
+        fftwf_import_wisdom_from_string(wisdom_fp32_.c_str());
+      }
+#endif
     }
   }
 
@@ -278,6 +405,11 @@ public:
       int ret = fftw_init_threads();
       MATX_ASSERT_STR(ret != 0, matxAssertError, "fftw_init_threads() failed");
       init_fp64_ = true;
+#ifdef MATX_EN_X86_FFTW
+      if (!wisdom_fp64_.empty()) {
+        fftw_import_wisdom_from_string(wisdom_fp64_.c_str());
+      }
+#endif
     }
   }
 
@@ -286,12 +418,23 @@ public:
   static void DecrementPlanCount() {
     active_plans_--;
     if (active_plans_ == 0) {
+      // Cleanup also forgets all wisdom, so keep it for the plans made after re-initializing
       if (init_fp32_) {
+#ifdef MATX_EN_X86_FFTW
+          char *wisdom = fftwf_export_wisdom_to_string();
+          wisdom_fp32_ = (wisdom != nullptr) ? wisdom : "";
+          fftwf_free(wisdom);
+#endif
           fftwf_cleanup_threads();
           fftwf_cleanup();
           init_fp32_ = false;
       }
       if (init_fp64_) {
+#ifdef MATX_EN_X86_FFTW
+          char *wisdom = fftw_export_wisdom_to_string();
+          wisdom_fp64_ = (wisdom != nullptr) ? wisdom : "";
+          fftw_free(wisdom);
+#endif
           fftw_cleanup_threads();
           fftw_cleanup();
           init_fp64_ = false;
@@ -299,12 +442,75 @@ public:
     }
   }
 
+  /**
+   * The FFTW planner is not thread-safe, so plan creation, destruction and wisdom
+   * access all hold this lock.
+   */
+  static std::recursive_mutex &PlannerMutex() { return planner_mtx_; }
+
 private:
   static inline cuda::std::atomic<int> active_plans_ = 0;
   static inline cuda::std::atomic<bool> init_fp32_ = false;
   static inline cuda::std::atomic<bool> init_fp64_ = false;
+  static inline std::recursive_mutex planner_mtx_;
+  static inline std::string wisdom_fp32_;
+  static inline std::string wisdom_fp64_;
 };
 
+__MATX_INLINE__ unsigned FFTWPlannerFlags(FFTWPlannerEffort effort) {
+  switch (effort) {
+    case FFTWPlannerEffort::MEASURE:
+      return FFTW_MEASURE;
+    case FFTWPlannerEffort::PATIENT:
+      return FFTW_PATIENT;
+    case FFTWPlannerEffort::EXHAUSTIVE:
+      return FFTW_EXHAUSTIVE;
+    default:
+      return FFTW_ESTIMATE;
+  }
+}
+
+/**
+ * Scratch array the planner can overwrite while measuring. Its start has the same
+ * offset modulo 64 bytes as ref, so the plan keeps the SIMD alignment FFTW assumes
+ * of the arrays it later runs on.
+ */
+__MATX_INLINE__ void *FFTWScratchLike(std::vector<char> &buf, const void *ref, size_t bytes) {
+  constexpr uintptr_t align = 64;
+  buf.resize(bytes + align);
+  const uintptr_t want = reinterpret_cast<uintptr_t>(ref) % align;
+  const uintptr_t have = reinterpret_cast<uintptr_t>(buf.data()) % align;
+  return buf.data() + (want + align - have) % align;
+}
+
+#ifdef MATX_EN_X86_FFTW
+/**
+ * FFTW's alignment class of an array, which a plan's arrays must share
+ */
+template <typename T>
+__MATX_INLINE__ int FFTWAlignmentOf(const T *ptr) {
+  using inner_type = typename inner_op_type_t<T>::type;
+  if constexpr (std::is_same_v<inner_type, float>) {
+    return fftwf_alignment_of(reinterpret_cast<float *>(const_cast<T *>(ptr)));
+  }
+  else {
+    return fftw_alignment_of(reinterpret_cast<double *>(const_cast<T *>(ptr)));
+  }
+}
+#endif
+
+/**
+ * Number of bytes from the first to one past the last element of a tensor
+ */
+template <typename TensorType>
+__MATX_INLINE__ size_t FFTWSpanBytes(const TensorType &t) {
+  index_t span = 1;
+  for (int r = 0; r < TensorType::Rank(); r++) {
+    span += (t.Size(r) - 1) * t.Stride(r);
+  }
+  return static_cast<size_t>(span) * sizeof(typename TensorType::value_type);
+}
+
 /**
  * Class for FFTW plans
  * 
@@ -326,14 +532,38 @@ public:
                 const InTensorType &i, 
                 const FftFFTWParams_t &params, 
                 const HostExecutor<MODE> &exec) : params_(params) {
+    [[maybe_unused]] std::lock_guard<std::recursive_mutex> lock(FFTWPlanManager::PlannerMutex());
+
     auto fft_dir = (params_.dir == detail::FFTDirection::FORWARD) ? FFTW_FORWARD : FFTW_BACKWARD;
+    const unsigned flags = FFTWPlannerFlags(params_.effort);
     auto in_ptr = i.Data();
     auto out_ptr = o.Data();
 
+    // FFTW overwrites its arrays while measuring, so any effort above ESTIMATE plans on
+    // scratch arrays laid out like the real ones. Exec always passes the real arrays.
+    std::vector<char> in_scratch;
+    std::vector<char> out_scratch;
+    if (params_.effort != FFTWPlannerEffort::ESTIMATE) {
+      const size_t in_bytes = FFTWSpanBytes(i);
+      const size_t out_bytes = FFTWSpanBytes(o);
+      if (params_.in_place) {
+        in_ptr = reinterpret_cast<decltype(in_ptr)>(
+            FFTWScratchLike(in_scratch, in_ptr, std::max(in_bytes, out_bytes)));
+        out_ptr = reinterpret_cast<decltype(out_ptr)>(in_ptr);
+      }
+      else {
+        in_ptr = reinterpret_cast<decltype(in_ptr)>(FFTWScratchLike(in_scratch, in_ptr, in_bytes));
+        out_ptr = reinterpret_cast<decltype(out_ptr)>(FFTWScratchLike(out_scratch, out_ptr, out_bytes));
+      }
+    }
+
     if constexpr (is_fp32_) {
       FFTWPlanManager::InitFFTWF();
       fftwf_plan_with_nthreads(exec.GetNumThreads());
-      if constexpr (DeduceFFTTransformType<OutTensorType, InTensorType>() == FFTType::C2C) {
+      if (params_.guru) {
+        plan_ = MakeGuruPlan(in_ptr, out_ptr, fft_dir, flags);
+      }
+      else if constexpr (DeduceFFTTransformType<OutTensorType, InTensorType>() == FFTType::C2C) {
         plan_  = fftwf_plan_many_dft( params_.fft_rank, 
                                     params_.n, 
                                     params_.batch, 
@@ -346,7 +576,7 @@ public:
                                     params_.ostride, 
                                     params_.odist,  
                                     fft_dir, 
-                                    FFTW_ESTIMATE);
+                                    flags);
       }
       else if constexpr (DeduceFFTTransformType<OutTensorType, InTensorType>() == FFTType::C2R) {
         plan_  = fftwf_plan_many_dft_c2r( params_.fft_rank, 
@@ -360,7 +590,7 @@ public:
                                     params_.onembed, 
                                     params_.ostride, 
                                     params_.odist,  
-                                    FFTW_ESTIMATE);
+                                    flags);
       }
       else if constexpr (DeduceFFTTransformType<OutTensorType, InTensorType>() == FFTType::R2C) {        
         plan_  = fftwf_plan_many_dft_r2c( params_.fft_rank, 
@@ -374,13 +604,16 @@ public:
                                     params_.onembed, 
                                     params_.ostride, 
                                     params_.odist,  
-                                    FFTW_ESTIMATE);
+                                    flags);
       }
     }
     else {
       FFTWPlanManager::InitFFTW();
       fftw_plan_with_nthreads(exec.GetNumThreads());
-      if constexpr (DeduceFFTTransformType<OutTensorType, InTensorType>() == FFTType::Z2Z) {
+      if (params_.guru) {
+        plan_ = MakeGuruPlan(in_ptr, out_ptr, fft_dir, flags);
+      }
+      else if constexpr (DeduceFFTTransformType<OutTensorType, InTensorType>() == FFTType::Z2Z) {
         plan_  = fftw_plan_many_dft( params_.fft_rank, 
                                     params_.n, 
                                     params_.batch, 
@@ -393,7 +626,7 @@ public:
                                     params_.ostride, 
                                     params_.odist,  
                                     fft_dir, 
-                                    FFTW_ESTIMATE);
+                                    flags);
       }
       else if constexpr (DeduceFFTTransformType<OutTensorType, InTensorType>() == FFTType::Z2D) {
         plan_  = fftw_plan_many_dft_c2r( params_.fft_rank, 
@@ -407,7 +640,7 @@ public:
                                     params_.onembed, 
                                     params_.ostride, 
                                     params_.odist,  
-                                    FFTW_ESTIMATE);
+                                    flags);
       }
       else if constexpr (DeduceFFTTransformType<OutTensorType, InTensorType>() == FFTType::D2Z) {
         plan_  = fftw_plan_many_dft_r2c( params_.fft_rank, 
@@ -421,7 +654,7 @@ public:
                                     params_.onembed, 
                                     params_.ostride, 
                                     params_.odist,  
-                                    FFTW_ESTIMATE);
+                                    flags);
       } 
     }
     MATX_ASSERT_STR(plan_ != nullptr, matxAssertError, "fftw plan creation failed");
@@ -435,6 +668,7 @@ public:
    * Deallocates the FFT plan and decrements the plan count
    */
   ~matxFFTWPlan_t() {
+    [[maybe_unused]] std::lock_guard<std::recursive_mutex> lock(FFTWPlanManager::PlannerMutex());
     if constexpr (is_fp32_) {
       fftwf_destroy_plan(plan_);
     } else {
@@ -492,16 +726,245 @@ public:
 private:
   static constexpr bool is_fp32_ = is_fp32_inner_type_v<out_value_type>;
 
+  // Plan directly on the tensors' strides and batch dimensions through the guru interface
+  template <typename InPtr, typename OutPtr>
+  plan_type MakeGuruPlan([[maybe_unused]] InPtr in_ptr, [[maybe_unused]] OutPtr out_ptr,
+                         [[maybe_unused]] int fft_dir, [[maybe_unused]] unsigned flags) const {
+#ifdef MATX_EN_X86_FFTW
+    using iodim_type = std::conditional_t<is_fp32_, fftwf_iodim64, fftw_iodim64>;
+    constexpr FFTType type = DeduceFFTTransformType<OutTensorType, InTensorType>();
+    iodim_type dims[MAX_FFT_RANK];
+    iodim_type howmany[MAX_FFT_GURU_BATCH_RANK];
+
+    for (int d = 0; d < params_.fft_rank; d++) {
+      dims[d].n = params_.n[d];
+      dims[d].is = params_.dim_is[d];
+      dims[d].os = params_.dim_os[d];
+    }
+    for (int d = 0; d < params_.howmany_rank; d++) {
+      howmany[d].n = params_.howmany_n[d];
+      howmany[d].is = params_.howmany_is[d];
+      howmany[d].os = params_.howmany_os[d];
+    }
+
+    if constexpr (type == FFTType::C2C) {
+      return fftwf_plan_guru64_dft(params_.fft_rank, dims, params_.howmany_rank, howmany,
+                                   reinterpret_cast<fftwf_complex*>(in_ptr),
+                                   reinterpret_cast<fftwf_complex*>(out_ptr), fft_dir, flags);
+    }
+    else if constexpr (type == FFTType::C2R) {
+      return fftwf_plan_guru64_dft_c2r(params_.fft_rank, dims, params_.howmany_rank, howmany,
+                                       reinterpret_cast<fftwf_complex*>(in_ptr), out_ptr, flags);
+    }
+    else if constexpr (type == FFTType::R2C) {
+      return fftwf_plan_guru64_dft_r2c(params_.fft_rank, dims, params_.howmany_rank, howmany,
+                                       in_ptr, reinterpret_cast<fftwf_complex*>(out_ptr), flags);
+    }
+    else if constexpr (type == FFTType::Z2Z) {
+      return fftw_plan_guru64_dft(params_.fft_rank, dims, params_.howmany_rank, howmany,
+                                  reinterpret_cast<fftw_complex*>(in_ptr),
+                                  reinterpret_cast<fftw_complex*>(out_ptr), fft_dir, flags);
+    }
+    else if constexpr (type == FFTType::Z2D) {
+      return fftw_plan_guru64_dft_c2r(params_.fft_rank, dims, params_.howmany_rank, howmany,
+                                      reinterpret_cast<fftw_complex*>(in_ptr), out_ptr, flags);
+    }
+    else {
+      return fftw_plan_guru64_dft_r2c(params_.fft_rank, dims, params_.howmany_rank, howmany,
+                                      in_ptr, reinterpret_cast<fftw_complex*>(out_ptr), flags);
+    }
+#else
+    return nullptr;
+#endif
+  }
+
   FftFFTWParams_t params_;
   plan_type plan_;
 };
 #endif
 
+/**
+ * Class for native host FFT plans, used when no FFTW library is configured
+ * and for half-precision types, which FFTW does not support
+ *
+ * Holds the precomputed twiddles for each transformed dimension and runs
+ * the layout described by the FFTW-style parameters. Batches are spread
+ * across the executor's threads; when there are fewer batches than threads,
+ * the rows and columns of each 2D transform are split instead. Half-precision
+ * data is computed in single precision: it is widened as each transform is
+ * gathered into the working buffers and narrowed again as it is stored.
+ */
+template<typename OutTensorType, typename InTensorType> class matxHostFFTPlan_t {
+public:
+  using out_value_type = typename OutTensorType::value_type;
+  using in_value_type = typename InTensorType::value_type;
+  using T = promote_half_t<typename inner_op_type_t<out_value_type>::type>;
+
+  matxHostFFTPlan_t(const FftFFTWParams_t &params) : params_(params) {
+    const index_t nl = params_.n[params_.fft_rank - 1];
+    if constexpr (is_r2c_ || is_c2r_) {
+      real_.emplace(nl);
+      buf_size_ = real_->BufferSize();
+      work_size_ = real_->WorkSize();
+    }
+    else {
+      last_.emplace(nl);
+      buf_size_ = nl;
+      work_size_ = last_->WorkSize();
+    }
+
+    if (params_.fft_rank == 2) {
+      first_.emplace(params_.n[0]);
+      buf_size_ = std::max(buf_size_, static_cast<index_t>(params_.n[0]));
+      work_size_ = std::max(work_size_, first_->WorkSize());
+    }
+  }
+
+  /**
+   * @brief Execute the cached host FFT plan
+   *
+   * @param o Output tensor
+   * @param i Input tensor
+   * @param num_threads Number of threads to use
+   */
+  void inline Exec(OutTensorType &o, const InTensorType &i, int num_threads) {
+    const auto *in = i.Data();
+    auto *out = o.Data();
+    const index_t batch = params_.batch;
+
+    if (params_.fft_rank == 1) {
+      HostParallelForBlocked(num_threads, batch, [&](index_t b0, index_t b1) {
+        std::vector<T> re(buf_size_), im(buf_size_), work(work_size_);
+        for (index_t b = b0; b < b1; b++) {
+          TransformLast(in + b * params_.idist, out + b * params_.odist,
+                        re.data(), im.data(), work.data());
+        }
+      });
+    }
+    else {
+      const bool split_batches = batch >= num_threads;
+      HostParallelForBlocked(split_batches ? num_threads : 1, batch, [&](index_t b0, index_t b1) {
+        for (index_t b = b0; b < b1; b++) {
+          Transform2D(in + b * params_.idist, out + b * params_.odist,
+                      split_batches ? 1 : num_threads);
+        }
+      });
+    }
+  }
+
+private:
+  static constexpr FFTType type_ = DeduceFFTTransformType<OutTensorType, InTensorType>();
+  static constexpr bool is_r2c_ = type_ == FFTType::R2C || type_ == FFTType::D2Z;
+  static constexpr bool is_c2r_ = type_ == FFTType::C2R || type_ == FFTType::Z2D;
+
+  bool Forward() const { return params_.dir == FFTDirection::FORWARD; }
+
+  // One transform along the last dimension
+  void TransformLast(const in_value_type *x, out_value_type *y, T *re, T *im, T *work) const {
+    const index_t n = params_.n[params_.fft_rank - 1];
+    if constexpr (is_r2c_) {
+      HostFFTLoadReal(x, params_.istride, n, re, im);
+      real_->Forward(re, im, work);
+      HostFFTStoreComplex(re, im, n / 2 + 1, y, params_.ostride);
+    }
+    else if constexpr (is_c2r_) {
+      HostFFTLoadComplex(x, params_.istride, n / 2 + 1, re, im);
+      real_->Inverse(re, im, work);
+      HostFFTStoreReal(re, im, n, y, params_.ostride);
+    }
+    else {
+      HostFFTLoadComplex(x, params_.istride, n, re, im);
+      last_->Transform(re, im, work, Forward());
+      HostFFTStoreComplex(re, im, n, y, params_.ostride);
+    }
+  }
+
+  // One transform along the first dimension of a 2D transform, in place on
+  // column c of y
+  void TransformFirst(out_value_type *y, index_t ld, T *re, T *im, T *work) const {
+    const index_t n0 = params_.n[0];
+    HostFFTLoadComplex(y, ld, n0, re, im);
+    first_->Transform(re, im, work, Forward());
+    HostFFTStoreComplex(re, im, n0, y, ld);
+  }
+
+  void Transform2D(const in_value_type *x, out_value_type *y, int num_threads) const {
+    const index_t n0 = params_.n[0];
+    const index_t n1 = params_.n[1];
+    const index_t irs = static_cast<index_t>(params_.inembed[1]) * params_.istride;
+    const index_t ors = static_cast<index_t>(params_.onembed[1]) * params_.ostride;
+
+    if constexpr (is_c2r_) {
+      // Columns first into a half-spectrum temporary so the input is left intact
+      const index_t nc = n1 / 2 + 1;
+      std::vector<T> tr(n0 * nc), ti(n0 * nc);
+      HostParallelForBlocked(num_threads, nc, [&](index_t c0, index_t c1) {
+        std::vector<T> re(buf_size_), im(buf_size_), work(work_size_);
+        for (index_t c = c0; c < c1; c++) {
+          HostFFTLoadComplex(x + c * params_.istride, irs, n0, re.data(), im.data());
+          first_->Transform(re.data(), im.data(), work.data(), false);
+          for (index_t r = 0; r < n0; r++) {
+            tr[r * nc + c] = re[r];
+            ti[r * nc + c] = im[r];
+          }
+        }
+      });
+      HostParallelForBlocked(num_threads, n0, [&](index_t r0, index_t r1) {
+        std::vector<T> re(buf_size_), im(buf_size_), work(work_size_);
+        for (index_t r = r0; r < r1; r++) {
+          std::copy(tr.begin() + r * nc, tr.begin() + (r + 1) * nc, re.begin());
+          std::copy(ti.begin() + r * nc, ti.begin() + (r + 1) * nc, im.begin());
+          real_->Inverse(re.data(), im.data(), work.data());
+          HostFFTStoreReal(re.data(), im.data(), n1, y + r * ors, params_.ostride);
+        }
+      });
+    }
+    else {
+      const index_t nc = is_r2c_ ? n1 / 2 + 1 : n1;
+      HostParallelForBlocked(num_threads, n0, [&](index_t r0, index_t r1) {
+        std::vector<T> re(buf_size_), im(buf_size_), work(work_size_);
+        for (index_t r = r0; r < r1; r++) {
+          TransformLast(x + r * irs, y + r * ors, re.data(), im.data(), work.data());
+        }
+      });
+      HostParallelForBlocked(num_threads, nc, [&](index_t c0, index_t c1) {
+        std::vector<T> re(buf_size_), im(buf_size_), work(work_size_);
+        for (index_t c = c0; c < c1; c++) {
+          TransformFirst(y + c * params_.ostride, ors, re.data(), im.data(), work.data());
+        }
+      });
+    }
+  }
+
+  FftFFTWParams_t params_;
+  std::optional<HostFFTPlan1D<T>> last_;
+  std::optional<HostRealFFT1D<T>> real_;
+  std::optional<HostFFTPlan1D<T>> first_;
+  index_t buf_size_ = 0;
+  index_t work_size_ = 0;
+};
+
+  /**
+   * Whether a guru plan can run on a view in place: every stride must be positive
+   */
   template <typename Op>
+  __MATX_INLINE__ bool FFTWGuruStridesSupported(const Op &in) {
+    for (int r = 0; r < Op::Rank(); r++) {
+      if (in.Stride(r) <= 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template <bool GURU = false, typename Op>
   __MATX_INLINE__ auto getFFTW1DSupportedTensor(const Op &in) {
     // This would be better as a templated lambda, but we don't have those in C++17 yet
     const auto support_func = [&]() {
-      if constexpr (is_tensor_view_v<Op>) {
+      if constexpr (is_tensor_view_v<Op> && GURU) {
+        return FFTWGuruStridesSupported(in);
+      }
+      else if constexpr (is_tensor_view_v<Op>) {
         if constexpr (Op::Rank() >= 2) {
           if (in.Stride(Op::Rank() - 2) != in.Stride(Op::Rank() - 1) * in.Size(Op::Rank() - 1)) {
             return false;
@@ -524,11 +987,14 @@ private:
   }
 
 
-  template <typename Op>
+  template <bool GURU = false, typename Op>
   __MATX_INLINE__ auto getFFTW2DSupportedTensor( const Op &in) {
     // This would be better as a templated lambda, but we don't have those in C++17 yet
     const auto support_func = [&]() {
-      if constexpr (is_tensor_view_v<Op>) {
+      if constexpr (is_tensor_view_v<Op> && GURU) {
+        return FFTWGuruStridesSupported(in);
+      }
+      else if constexpr (is_tensor_view_v<Op>) {
         if ( in.Stride(Op::Rank()-2) != in.Stride(Op::Rank()-1) * in.Size(Op::Rank()-1)) {
           return false;
         } else if constexpr ( Op::Rank() > 2) {
@@ -554,19 +1020,191 @@ private:
                                 [[maybe_unused]] const FftFFTWParams_t &params, 
                                 [[maybe_unused]] detail::FFTDirection dir,
                                 [[maybe_unused]] const HostExecutor<MODE> &exec) {
-#if MATX_EN_CPU_FFT                                  
-    using cache_val_type = detail::matxFFTWPlan_t<OutputTensor, InputTensor>;
-    detail::GetCache().LookupAndExec<detail::fft_fftw_cache_t>(
-      detail::GetCacheIdFromType<detail::fft_fftw_cache_t>(),
-      params,
-      [&]() {
-        return std::make_shared<cache_val_type>(o, i, params, exec);
-      },
-      [&](std::shared_ptr<cache_val_type> ctype) {
-        ctype->Exec(o, i);
-      }
-    );
+    using out_inner_type = typename inner_op_type_t<typename OutputTensor::value_type>::type;
+    constexpr bool use_fftw = MATX_EN_CPU_FFT && !is_half_v<out_inner_type> && !is_matx_half_v<out_inner_type>;
+
+    if constexpr (use_fftw) {
+#if MATX_EN_CPU_FFT
+      using cache_val_type = detail::matxFFTWPlan_t<OutputTensor, InputTensor>;
+      // Plans made with different efforts are kept apart so asking for a better plan
+      // doesn't reuse a cached estimate
+      auto plan_params = params;
+      plan_params.effort = GetFFTWPlannerEffort(exec);
+#ifdef MATX_EN_X86_FFTW
+      plan_params.in_align = FFTWAlignmentOf(i.Data());
+      plan_params.out_align = FFTWAlignmentOf(o.Data());
 #endif
+      detail::GetCache().LookupAndExec<detail::fft_fftw_cache_t>(
+        detail::GetCacheIdFromType<detail::fft_fftw_cache_t>(),
+        plan_params,
+        [&]() {
+          return std::make_shared<cache_val_type>(o, i, plan_params, exec);
+        },
+        [&](std::shared_ptr<cache_val_type> ctype) {
+          ctype->Exec(o, i);
+        }
+      );
+#endif
+    }
+    else {
+      using cache_val_type = detail::matxHostFFTPlan_t<OutputTensor, InputTensor>;
+      detail::GetCache().LookupAndExec<detail::fft_fftw_cache_t>(
+        detail::GetCacheIdFromType<detail::fft_fftw_cache_t>(),
+        params,
+        [&]() {
+          return std::make_shared<cache_val_type>(params);
+        },
+        [&](std::shared_ptr<cache_val_type> ctype) {
+          ctype->Exec(o, i, exec.GetNumThreads());
+        }
+      );
+    }
+  }
+
+  // Target size of the input and output staging buffers of one fused block. Small
+  // enough to stay in cache between the prologue, the transform and the epilogue.
+  static constexpr index_t HOST_FFT_FUSED_BLOCK_BYTES = 1 << 19;
+
+  /**
+   * Whether a host FFT on this input evaluates it block by block rather than
+   * materializing it first. That is any elementwise operator; tensors are already in
+   * memory and transforms have been run into a buffer by their PreRun.
+   */
+  template <typename OutputTensor, typename InputOp>
+  constexpr bool HostFFTFusedPrologue() {
+    using in_inner_type = typename inner_op_type_t<typename InputOp::value_type>::type;
+    using out_inner_type = typename inner_op_type_t<typename OutputTensor::value_type>::type;
+    return !is_tensor_view_v<InputOp> && !is_matx_transform_op<InputOp>() &&
+           !is_half_v<in_inner_type> && !is_matx_half_v<in_inner_type> &&
+           !is_half_v<out_inner_type> && !is_matx_half_v<out_inner_type>;
+  }
+
+  /**
+   * Whether an operator may read memory that the output of a host FFT writes. The fused
+   * path stores each block of the output before evaluating the operator for later blocks,
+   * so such an operator (e.g. x = fft(flipud(x))) is materialized first instead.
+   */
+  template <typename OutputTensor, typename InputOp>
+  __MATX_INLINE__ bool HostFFTOutputAliasesInput(const OutputTensor &o, const InputOp &i) {
+    const auto out = get_operator_capability<OperatorCapability::ACCESSED_MEMORY>(o);
+    const auto in = get_operator_capability<OperatorCapability::ACCESSED_MEMORY>(i);
+    return out.Overlaps(in);
+  }
+
+  /**
+   * Normalization factor applied to an FFT's output for the given direction and norm
+   */
+  template <typename s_type>
+  __MATX_INLINE__ s_type HostFFTScale(s_type factor, detail::FFTDirection dir, FFTNorm norm) {
+    constexpr s_type s_one = static_cast<s_type>(1.0);
+    if (norm == FFTNorm::ORTHO) {
+      return s_one / std::sqrt(factor);
+    }
+    if ((dir == detail::FFTDirection::FORWARD && norm == FFTNorm::FORWARD) ||
+        (dir == detail::FFTDirection::BACKWARD && norm == FFTNorm::BACKWARD)) {
+      return s_one / factor;
+    }
+    return s_one;
+  }
+
+  /**
+   * Run a host FFT on an elementwise operator without materializing it
+   *
+   * Blocks of whole transforms are evaluated from the operator into a small packed
+   * buffer (the prologue), transformed into a second small buffer, and stored to the
+   * output with the normalization applied (the epilogue). Neither the operator's full
+   * result nor a separate scaling pass goes through memory, and the output may be any
+   * view. Each stage uses all of the executor's threads.
+   *
+   * @tparam FFT_RANK 1 or 2
+   * @param o Output tensor
+   * @param i Input operator whose last FFT_RANK dimensions are transformed
+   * @param dir Transform direction
+   * @param norm Normalization mode
+   * @param exec Host executor
+   */
+  template <int FFT_RANK, typename OutputTensor, typename InputOp, ThreadsMode MODE>
+  __MATX_INLINE__ void fft_fused_prologue_exec(OutputTensor &o, const InputOp &i,
+          detail::FFTDirection dir, FFTNorm norm, const HostExecutor<MODE> &exec)
+  {
+    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+
+    constexpr int RANK = OutputTensor::Rank();
+    using in_type = typename InputOp::value_type;
+    using out_type = typename OutputTensor::value_type;
+    using s_type = typename detail::value_promote_t<typename inner_op_type_t<in_type>::type>;
+
+    index_t in_unit = 1;
+    index_t out_unit = 1;
+    cuda::std::array<index_t, FFT_RANK + 1> in_shape;
+    cuda::std::array<index_t, FFT_RANK + 1> out_shape;
+    for (int d = 0; d < FFT_RANK; d++) {
+      in_shape[d + 1] = i.Size(RANK - FFT_RANK + d);
+      out_shape[d + 1] = o.Size(RANK - FFT_RANK + d);
+      in_unit *= in_shape[d + 1];
+      out_unit *= out_shape[d + 1];
+    }
+
+    if (in_unit == 0 || out_unit == 0) {
+      return;
+    }
+
+    const index_t batches = TotalSize(o) / out_unit;
+    const int num_threads = exec.GetNumThreads();
+    const index_t unit_bytes = in_unit * static_cast<index_t>(sizeof(in_type)) +
+                               out_unit * static_cast<index_t>(sizeof(out_type));
+    const index_t rows = std::min(batches, std::max(index_t{1}, HOST_FFT_FUSED_BLOCK_BYTES / unit_bytes));
+
+    // The staging buffers come from the executor's pool, so repeated runs don't allocate
+    in_shape[0] = rows;
+    out_shape[0] = rows;
+    tensor_t<in_type, FFT_RANK + 1> in_buf;
+    tensor_t<out_type, FFT_RANK + 1> out_buf;
+    in_type *inp = nullptr;
+    out_type *outp = nullptr;
+    AllocateTempTensor(in_buf, exec, in_shape, &inp);
+    AllocateTempTensor(out_buf, exec, out_shape, &outp);
+
+    for (index_t b0 = 0; b0 < batches; b0 += rows) {
+      const index_t cnt = std::min(rows, batches - b0);
+
+      // Prologue: evaluate the operator for this block's transforms, one run along the
+      // last dimension at a time
+      const index_t base = b0 * in_unit;
+      HostParallelForBlocked(num_threads, cnt * in_unit, [&](index_t e0, index_t e1) {
+        HostForEachIndex(i, base + e0, base + e1, [&](index_t e, const auto &idx) {
+          inp[e - base] = static_cast<in_type>(cuda::std::apply([&](auto... args) {
+            return i(args...);
+          }, idx));
+        });
+      });
+
+      // The last block may be short, which is just a plan with fewer batches
+      in_shape[0] = cnt;
+      out_shape[0] = cnt;
+      auto in_blk = make_tensor<in_type>(inp, in_shape);
+      auto out_blk = make_tensor<out_type>(outp, out_shape);
+      auto params = GetFFTParams(out_blk, in_blk, FFT_RANK, dir);
+      fft_exec(out_blk, in_blk, params, dir, exec);
+
+      const s_type factor = static_cast<s_type>(FFT_RANK == 1 ? params.n[0] : params.n[0] * params.n[1]);
+      const s_type scale = HostFFTScale(factor, dir, norm);
+
+      // Epilogue: scale and store the block to the output
+      const index_t out_base = b0 * out_unit;
+      HostParallelForBlocked(num_threads, cnt * out_unit, [&](index_t e0, index_t e1) {
+        HostForEachIndex(o, out_base + e0, out_base + e1, [&](index_t e, const auto &idx) {
+          const out_type v = (scale == static_cast<s_type>(1.0)) ? outp[e - out_base] :
+                                                                   static_cast<out_type>(outp[e - out_base] * scale);
+          cuda::std::apply([&](auto... args) {
+            o(args...) = v;
+          }, idx);
+        });
+      });
+    }
+
+    FreeTempTensor(inp, exec);
+    FreeTempTensor(outp, exec);
   }
 
   template <typename OutputTensor, typename InputTensor, ThreadsMode MODE>
@@ -580,9 +1218,34 @@ private:
 
     MATX_ASSERT_STR(TotalSize(i) < std::numeric_limits<int>::max(), matxInvalidSize, "Dimensions too large for host FFT currently");
 
-    // converts operators to tensors
-    auto out = getFFTW1DSupportedTensor(o);
-    auto in_t = getFFTW1DSupportedTensor(i); 
+    if constexpr (HostFFTFusedPrologue<OutputTensor, InputTensor>()) {
+      // An operator read at its own length goes through the fused block pipeline. Padded
+      // or truncated transforms are staged below.
+      constexpr FFTType type = DeduceFFTTransformType<OutputTensor, InputTensor>();
+      const index_t nin = i.Size(InputTensor::Rank() - 1);
+      const index_t nout = o.Size(OutputTensor::Rank() - 1);
+      bool as_is;
+      if constexpr (type == FFTType::R2C || type == FFTType::D2Z) {
+        as_is = (fft_size == 0 ? nin % 2 == 0 : fft_size == nin) && nout == nin / 2 + 1;
+      }
+      else if constexpr (type == FFTType::C2R || type == FFTType::Z2D) {
+        as_is = fft_size == 0 && nin == nout / 2 + 1;
+      }
+      else {
+        as_is = (fft_size == 0 || fft_size == nin) && nout == nin;
+      }
+
+      if (as_is && !HostFFTOutputAliasesInput(o, i)) {
+        fft_fused_prologue_exec<1>(o, i, dir, norm, exec);
+        return;
+      }
+    }
+
+    // converts operators to tensors. FFTW's guru interface runs on any strided view, so
+    // only operators and views it can't describe are staged through a packed copy.
+    constexpr bool guru = FFTWGuruSupported<OutputTensor, InputTensor>();
+    auto out = getFFTW1DSupportedTensor<guru>(o);
+    auto in_t = getFFTW1DSupportedTensor<guru>(i);
 
     if(!in_t.isSameView(i)) {
       (in_t = i).run(exec);
@@ -592,6 +1255,9 @@ private:
 
     // Get parameters required by these tensors
     auto params = GetFFTParams(out, in, 1, dir);
+    if constexpr (guru) {
+      SetFFTWGuruLayout(params, out, in);
+    }
 
     fft_exec(out, in, params, dir, exec);
 
@@ -634,9 +1300,17 @@ private:
 
     MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
 
-    // converts operators to tensors
-    auto out = getFFTW2DSupportedTensor(o);
-    auto in = getFFTW2DSupportedTensor(i); 
+    if constexpr (HostFFTFusedPrologue<OutputTensor, InputTensor>()) {
+      if (!HostFFTOutputAliasesInput(o, i)) {
+        fft_fused_prologue_exec<2>(o, i, dir, norm, exec);
+        return;
+      }
+    }
+
+    // converts operators to tensors, keeping any strided view a guru plan can describe
+    constexpr bool guru = FFTWGuruSupported<OutputTensor, InputTensor>();
+    auto out = getFFTW2DSupportedTensor<guru>(o);
+    auto in = getFFTW2DSupportedTensor<guru>(i);
     
     if(!in.isSameView(i)) {
       (in = i).run(exec);
@@ -644,6 +1318,9 @@ private:
 
     // Get parameters required by these tensors
     auto params = GetFFTParams(out, in, 2, dir);
+    if constexpr (guru) {
+      SetFFTWGuruLayout(params, out, in);
+    }
 
     fft_exec(out, in, params, dir, exec);
 
@@ -683,13 +1360,13 @@ private:
     MATX_STATIC_ASSERT_STR(OutputTensor::Rank() == InputTensor::Rank(), matxInvalidDim,
       "Input and output tensor ranks must match");  
     MATX_STATIC_ASSERT_STR( (is_fp32_inner_type_v<typename OutputTensor::value_type> ||
-                            is_fp64_inner_type_v<typename InputTensor::value_type>), matxInvalidType,
-                            "Host FFTs only support single or double precision floats");    
+                            is_fp64_inner_type_v<typename InputTensor::value_type> ||
+                            is_complex_half_v<typename OutputTensor::value_type> ||
+                            is_matx_half_v<typename OutputTensor::value_type>), matxInvalidType,
+                            "Host FFTs only support half, single or double precision floats");    
     
     MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
 
-    MATX_ASSERT_STR(MATX_EN_CPU_FFT, matxInvalidExecutor, "Trying to run a host FFT executor but host FFT support is not configured");
-
     fft1d_dispatch(o, i, fft_size, FFTDirection::FORWARD, norm, exec);
   }
 
@@ -701,13 +1378,13 @@ private:
     MATX_STATIC_ASSERT_STR(OutputTensor::Rank() == InputTensor::Rank(), matxInvalidDim,
       "Input and output tensor ranks must match");  
     MATX_STATIC_ASSERT_STR( (is_fp32_inner_type_v<typename OutputTensor::value_type> ||
-                            is_fp64_inner_type_v<typename InputTensor::value_type>), matxInvalidType,
-                            "Host FFTs only support single or double precision floats");      
+                            is_fp64_inner_type_v<typename InputTensor::value_type> ||
+                            is_complex_half_v<typename OutputTensor::value_type> ||
+                            is_matx_half_v<typename OutputTensor::value_type>), matxInvalidType,
+                            "Host FFTs only support half, single or double precision floats");      
     
     MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
 
-    MATX_ASSERT_STR(MATX_EN_CPU_FFT, matxInvalidExecutor, "Trying to run a host FFT executor but host FFT support is not configured");
-
     fft1d_dispatch(o, i, fft_size, FFTDirection::BACKWARD, norm, exec);
   }
 
@@ -721,13 +1398,13 @@ private:
       "Input and output tensor ranks must match");
     MATX_STATIC_ASSERT_STR(InputTensor::Rank() >= 2, matxInvalidSize, "2D FFT must be rank 2 tensor or higher");      
     MATX_STATIC_ASSERT_STR( (is_fp32_inner_type_v<typename OutputTensor::value_type> ||
-                            is_fp64_inner_type_v<typename InputTensor::value_type>), matxInvalidType,
-                            "Host FFTs only support single or double precision floats");     
+                            is_fp64_inner_type_v<typename InputTensor::value_type> ||
+                            is_complex_half_v<typename OutputTensor::value_type> ||
+                            is_matx_half_v<typename OutputTensor::value_type>), matxInvalidType,
+                            "Host FFTs only support half, single or double precision floats");     
     
     MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
 
-    MATX_ASSERT_STR(MATX_EN_CPU_FFT, matxInvalidExecutor, "Trying to run a host FFT executor but host FFT support is not configured");
-
     fft2d_dispatch(o, i, FFTDirection::FORWARD, norm, exec);
   }
 
@@ -739,18 +1416,169 @@ private:
       "Input and output tensor ranks must match");  
     MATX_STATIC_ASSERT_STR(InputTensor::Rank() >= 2, matxInvalidSize, "2D FFT must be rank 2 tensor or higher");      
     MATX_STATIC_ASSERT_STR( (is_fp32_inner_type_v<typename OutputTensor::value_type> ||
-                            is_fp64_inner_type_v<typename InputTensor::value_type>), matxInvalidType,
-                            "Host FFTs only support single or double precision floats");      
+                            is_fp64_inner_type_v<typename InputTensor::value_type> ||
+                            is_complex_half_v<typename OutputTensor::value_type> ||
+                            is_matx_half_v<typename OutputTensor::value_type>), matxInvalidType,
+                            "Host FFTs only support half, single or double precision floats");      
     
     MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
 
-    MATX_ASSERT_STR(MATX_EN_CPU_FFT, matxInvalidExecutor, "Trying to run a host FFT executor but host FFT support is not configured");
-
     fft2d_dispatch(o, i, FFTDirection::BACKWARD, norm, exec);  
   }
     
 } // end namespace detail
 
+/**
+ * Set the FFTW planner effort used by host executors that don't set their own
+ *
+ * Plans already in the cache keep the effort they were made with; transforms
+ * asking for a different effort get a new plan.
+ *
+ * @param effort Planner effort. DEFAULT restores ESTIMATE.
+ */
+__MATX_INLINE__ void matxSetFFTWPlannerEffort(FFTWPlannerEffort effort) {
+  detail::fftw_planner_effort = (effort == FFTWPlannerEffort::DEFAULT) ? FFTWPlannerEffort::ESTIMATE : effort;
+}
 
+/**
+ * Get the FFTW planner effort used by host executors that don't set their own
+ *
+ * @return Global planner effort
+ */
+__MATX_INLINE__ FFTWPlannerEffort matxGetFFTWPlannerEffort() {
+  return detail::fftw_planner_effort.load();
+}
+
+/**
+ * Write the FFTW wisdom accumulated so far to a file
+ *
+ * Both single and double precision wisdom go into the same file. Loading it with
+ * matxImportFFTWWisdom() at startup lets MEASURE and higher efforts reuse the tuned
+ * plans instead of measuring again.
+ *
+ * @param filename File to write
+ */
+__MATX_INLINE__ void matxExportFFTWWisdom([[maybe_unused]] const std::string &filename) {
+#ifdef MATX_EN_X86_FFTW
+  [[maybe_unused]] std::lock_guard<std::recursive_mutex> lock(detail::FFTWPlanManager::PlannerMutex());
+  detail::FFTWPlanManager::InitFFTW();
+  detail::FFTWPlanManager::InitFFTWF();
+
+  std::ofstream file(filename);
+  MATX_ASSERT_STR(file.good(), matxIOError, "Unable to open FFTW wisdom file for writing");
+
+  char *wisdom = fftw_export_wisdom_to_string();
+  if (wisdom != nullptr) {
+    file << wisdom << "\n";
+    fftw_free(wisdom);
+  }
+
+  wisdom = fftwf_export_wisdom_to_string();
+  if (wisdom != nullptr) {
+    file << wisdom << "\n";
+    fftwf_free(wisdom);
+  }
+
+  MATX_ASSERT_STR(file.good(), matxIOError, "Failed writing FFTW wisdom file");
+#else
+  MATX_THROW(matxNotSupported, "FFTW wisdom requires MatX to be built with FFTW");
+#endif
+}
+
+/**
+ * Load FFTW wisdom from a file written by matxExportFFTWWisdom()
+ *
+ * The wisdom is added to what FFTW already knows. Plans made afterwards with an
+ * effort the wisdom covers are created without measuring.
+ *
+ * @param filename File to read
+ */
+__MATX_INLINE__ void matxImportFFTWWisdom([[maybe_unused]] const std::string &filename) {
+#ifdef MATX_EN_X86_FFTW
+  [[maybe_unused]] std::lock_guard<std::recursive_mutex> lock(detail::FFTWPlanManager::PlannerMutex());
+  detail::FFTWPlanManager::InitFFTW();
+  detail::FFTWPlanManager::InitFFTWF();
+
+  std::ifstream file(filename);
+  MATX_ASSERT_STR(file.good(), matxIOError, "Unable to open FFTW wisdom file for reading");
+  std::stringstream contents;
+  contents << file.rdbuf();
+  const std::string text = contents.str();
+
+  // The file holds one top-level s-expression per precision
+  int depth = 0;
+  size_t start = 0;
+  for (size_t c = 0; c < text.size(); c++) {
+    if (text[c] == '(') {
+      if (depth++ == 0) {
+        start = c;
+      }
+    }
+    else if (text[c] == ')' && depth > 0 && --depth == 0) {
+      const std::string block = text.substr(start, c - start + 1);
+      const int ret = (block.find("fftwf_wisdom") != std::string::npos) ?
+          fftwf_import_wisdom_from_string(block.c_str()) :
+          fftw_import_wisdom_from_string(block.c_str());
+      MATX_ASSERT_STR(ret != 0, matxIOError, "Invalid FFTW wisdom file");
+    }
+  }
+#else
+  MATX_THROW(matxNotSupported, "FFTW wisdom requires MatX to be built with FFTW");
+#endif
+}
+
+/**
+ * Create and cache the host FFT plans for a list of shapes ahead of time
+ *
+ * Runs a forward and an inverse transform on zeroed, densely-packed scratch
+ * tensors of each shape, so the plans that later fft()/ifft() calls (or
+ * fft2()/ifft2() when fft_rank is 2) on packed, out-of-place tensors of those
+ * shapes need are already in the cache. This is most useful before
+ * latency-sensitive work with MEASURE or higher planner efforts, where
+ * planning can take far longer than the transform itself.
+ *
+ * Complex types warm up complex-to-complex plans. Real types warm up the
+ * real-to-complex forward and complex-to-real inverse plans, where each shape
+ * is the shape of the real signal.
+ *
+ * @tparam T Signal type
+ * @tparam RANK Rank of each shape
+ * @tparam MODE Threading policy
+ *
+ * @param shapes Signal shapes to plan
+ * @param exec Host executor the transforms will run on
+ * @param fft_rank 1 for fft()/ifft() plans, 2 for fft2()/ifft2() plans
+ */
+template <typename T, int RANK, ThreadsMode MODE>
+__MATX_INLINE__ void matxFFTWarmup(const std::vector<cuda::std::array<index_t, RANK>> &shapes,
+                                   const HostExecutor<MODE> &exec, int fft_rank = 1) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  MATX_ASSERT_STR(fft_rank == 1 || fft_rank == 2, matxInvalidParameter, "FFT warm-up rank must be 1 or 2");
+  MATX_ASSERT_STR(fft_rank <= RANK, matxInvalidDim, "Shape rank must be at least the FFT rank");
+
+  using complex_type = std::conditional_t<is_complex_v<T>, T, typename scalar_to_complex<T>::ctype>;
+
+  for (const auto &shape : shapes) {
+    auto sig = make_tensor<T>(shape, MATX_HOST_MALLOC_MEMORY);
+    (sig = T{}).run(exec);
+
+    auto spec_shape = shape;
+    if constexpr (!is_complex_v<T>) {
+      spec_shape[RANK - 1] = shape[RANK - 1] / 2 + 1;
+    }
+    auto spec = make_tensor<complex_type>(spec_shape, MATX_HOST_MALLOC_MEMORY);
+
+    if (fft_rank == 1) {
+      detail::fft_impl(spec, sig, 0, FFTNorm::BACKWARD, exec);
+      detail::ifft_impl(sig, spec, 0, FFTNorm::BACKWARD, exec);
+    }
+    else {
+      if constexpr (RANK >= 2) {
+        detail::fft2_impl(spec, sig, FFTNorm::BACKWARD, exec);
+        detail::ifft2_impl(sig, spec, FFTNorm::BACKWARD, exec);
+      }
+    }
+  }
+}
 
 }; // end namespace matx
\ No newline at end of file
@@ -0,0 +1,607 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "matx/core/error.h"
+#include "matx/core/type_utils.h"
+
+namespace matx {
+
+namespace detail {
+
+/**
+ * Largest prime factor handled by the generic O(p^2) butterfly of the native
+ * host FFT. Lengths with a larger prime factor fall back to Bluestein.
+ */
+static constexpr index_t HOST_FFT_MAX_GENERIC_RADIX = 13;
+
+/**
+ * Multiply (xr, xi) by the forward twiddle (wr, wi), or by its conjugate for
+ * an inverse transform.
+ */
+template <bool FWD, typename T>
+__MATX_INLINE__ void HostFFTTwiddle(T xr, T xi, T wr, T wi, T &yr, T &yi) {
+  if constexpr (!FWD) {
+    wi = -wi;
+  }
+  yr = xr * wr - xi * wi;
+  yi = xr * wi + xi * wr;
+}
+
+/**
+ * Radix-R butterfly of one Stockham pass. Reads R inputs ss apart, applies a
+ * size-R DFT, scales output q > 0 by twiddle q - 1 (ts apart), and writes
+ * the outputs ds apart. Data is split into real and imaginary arrays so
+ * consecutive butterflies map onto plain vector lanes.
+ */
+template <int R, bool FWD, typename T>
+__MATX_INLINE__ void HostFFTButterfly(const T *sr, const T *si, index_t ss,
+                                      T *dr, T *di, index_t ds,
+                                      const T *twr, const T *twi, index_t ts) {
+  if constexpr (R == 2) {
+    const T ar = sr[0], ai = si[0];
+    const T br = sr[ss], bi = si[ss];
+    dr[0] = ar + br;
+    di[0] = ai + bi;
+    HostFFTTwiddle<FWD>(ar - br, ai - bi, twr[0], twi[0], dr[ds], di[ds]);
+  }
+  else if constexpr (R == 3) {
+    constexpr T s = static_cast<T>(FWD ? 0.86602540378443864676 : -0.86602540378443864676);
+    const T t1r = sr[ss] + sr[2 * ss], t1i = si[ss] + si[2 * ss];
+    const T t2r = sr[ss] - sr[2 * ss], t2i = si[ss] - si[2 * ss];
+    const T mr = sr[0] - static_cast<T>(0.5) * t1r;
+    const T mi = si[0] - static_cast<T>(0.5) * t1i;
+    // u = -i * s * t2
+    const T ur = s * t2i, ui = -s * t2r;
+    dr[0] = sr[0] + t1r;
+    di[0] = si[0] + t1i;
+    HostFFTTwiddle<FWD>(mr + ur, mi + ui, twr[0], twi[0], dr[ds], di[ds]);
+    HostFFTTwiddle<FWD>(mr - ur, mi - ui, twr[ts], twi[ts], dr[2 * ds], di[2 * ds]);
+  }
+  else if constexpr (R == 4) {
+    const T t0r = sr[0] + sr[2 * ss], t0i = si[0] + si[2 * ss];
+    const T t1r = sr[0] - sr[2 * ss], t1i = si[0] - si[2 * ss];
+    const T t2r = sr[ss] + sr[3 * ss], t2i = si[ss] + si[3 * ss];
+    const T t3r = sr[ss] - sr[3 * ss], t3i = si[ss] - si[3 * ss];
+    // u = -i * t3 forward, i * t3 inverse
+    const T ur = FWD ? t3i : -t3i;
+    const T ui = FWD ? -t3r : t3r;
+    dr[0] = t0r + t2r;
+    di[0] = t0i + t2i;
+    HostFFTTwiddle<FWD>(t1r + ur, t1i + ui, twr[0], twi[0], dr[ds], di[ds]);
+    HostFFTTwiddle<FWD>(t0r - t2r, t0i - t2i, twr[ts], twi[ts], dr[2 * ds], di[2 * ds]);
+    HostFFTTwiddle<FWD>(t1r - ur, t1i - ui, twr[2 * ts], twi[2 * ts], dr[3 * ds], di[3 * ds]);
+  }
+  else if constexpr (R == 5) {
+    constexpr T c1 = static_cast<T>(0.30901699437494742410);
+    constexpr T c2 = static_cast<T>(-0.80901699437494742410);
+    constexpr T s1 = static_cast<T>(FWD ? 0.95105651629515357212 : -0.95105651629515357212);
+    constexpr T s2 = static_cast<T>(FWD ? 0.58778525229247312917 : -0.58778525229247312917);
+    const T t1r = sr[ss] + sr[4 * ss], t1i = si[ss] + si[4 * ss];
+    const T t2r = sr[2 * ss] + sr[3 * ss], t2i = si[2 * ss] + si[3 * ss];
+    const T t3r = sr[ss] - sr[4 * ss], t3i = si[ss] - si[4 * ss];
+    const T t4r = sr[2 * ss] - sr[3 * ss], t4i = si[2 * ss] - si[3 * ss];
+    const T m1r = sr[0] + c1 * t1r + c2 * t2r, m1i = si[0] + c1 * t1i + c2 * t2i;
+    const T m2r = sr[0] + c2 * t1r + c1 * t2r, m2i = si[0] + c2 * t1i + c1 * t2i;
+    // u1 = -i * (s1 * t3 + s2 * t4), u2 = -i * (s2 * t3 - s1 * t4)
+    const T u1r = s1 * t3i + s2 * t4i, u1i = -(s1 * t3r + s2 * t4r);
+    const T u2r = s2 * t3i - s1 * t4i, u2i = -(s2 * t3r - s1 * t4r);
+    dr[0] = sr[0] + t1r + t2r;
+    di[0] = si[0] + t1i + t2i;
+    HostFFTTwiddle<FWD>(m1r + u1r, m1i + u1i, twr[0], twi[0], dr[ds], di[ds]);
+    HostFFTTwiddle<FWD>(m2r + u2r, m2i + u2i, twr[ts], twi[ts], dr[2 * ds], di[2 * ds]);
+    HostFFTTwiddle<FWD>(m2r - u2r, m2i - u2i, twr[2 * ts], twi[2 * ts], dr[3 * ds], di[3 * ds]);
+    HostFFTTwiddle<FWD>(m1r - u1r, m1i - u1i, twr[3 * ts], twi[3 * ts], dr[4 * ds], di[4 * ds]);
+  }
+}
+
+/**
+ * One radix-R Stockham pass over a length l1 * R * ido transform. Input
+ * element (i, j, k) is at i + ido * (j + R * k) and output (i, k, j) at
+ * i + ido * (k + l1 * j), so no bit-reversal is needed. The vectorized loop
+ * runs over i unless i is too short to fill a vector and k is longer.
+ */
+template <int R, bool FWD, typename T>
+__MATX_INLINE__ void HostFFTPass(index_t ido, index_t l1, const T *sr, const T *si,
+                                 T *dr, T *di, const T *twr, const T *twi) {
+  if (ido >= 4 || ido >= l1) {
+    for (index_t k = 0; k < l1; k++) {
+      const index_t s0 = ido * R * k;
+      const index_t d0 = ido * k;
+#pragma omp simd
+      for (index_t i = 0; i < ido; i++) {
+        HostFFTButterfly<R, FWD>(sr + s0 + i, si + s0 + i, ido, dr + d0 + i, di + d0 + i,
+                                 ido * l1, twr + i, twi + i, ido);
+      }
+    }
+  }
+  else {
+    // Block k so each block's inputs stay in cache across the i loop
+    constexpr index_t kb = 64;
+    for (index_t k0 = 0; k0 < l1; k0 += kb) {
+      const index_t k1 = std::min(l1, k0 + kb);
+      for (index_t i = 0; i < ido; i++) {
+#pragma omp simd
+        for (index_t k = k0; k < k1; k++) {
+          HostFFTButterfly<R, FWD>(sr + ido * R * k + i, si + ido * R * k + i, ido,
+                                   dr + ido * k + i, di + ido * k + i, ido * l1,
+                                   twr + i, twi + i, ido);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Stockham pass for a small odd prime radix p using a direct size-p DFT.
+ * rr/ri hold the p forward roots of unity.
+ */
+template <bool FWD, typename T>
+__MATX_INLINE__ void HostFFTPassGeneric(index_t p, index_t ido, index_t l1,
+                                        const T *sr, const T *si, T *dr, T *di,
+                                        const T *twr, const T *twi,
+                                        const T *rr, const T *ri) {
+  for (index_t k = 0; k < l1; k++) {
+    for (index_t i = 0; i < ido; i++) {
+      const T *xr = sr + ido * p * k + i;
+      const T *xi = si + ido * p * k + i;
+      for (index_t q = 0; q < p; q++) {
+        T yr = 0, yi = 0;
+        for (index_t j = 0; j < p; j++) {
+          const index_t m = (j * q) % p;
+          const T wi = FWD ? ri[m] : -ri[m];
+          yr += xr[j * ido] * rr[m] - xi[j * ido] * wi;
+          yi += xr[j * ido] * wi + xi[j * ido] * rr[m];
+        }
+        const index_t d = ido * (k + l1 * q) + i;
+        if (q == 0) {
+          dr[d] = yr;
+          di[d] = yi;
+        }
+        else {
+          HostFFTTwiddle<FWD>(yr, yi, twr[(q - 1) * ido + i], twi[(q - 1) * ido + i], dr[d], di[d]);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Smallest 2^a * 3^b * 5^c that is at least n
+ */
+__MATX_INLINE__ index_t HostFFTGoodSize(index_t n) {
+  index_t best = 1;
+  while (best < n) {
+    best *= 2;
+  }
+  for (index_t p5 = 1; p5 < best; p5 *= 5) {
+    for (index_t p35 = p5; p35 < best; p35 *= 3) {
+      index_t v = p35;
+      while (v < n) {
+        v *= 2;
+      }
+      best = std::min(best, v);
+    }
+  }
+  return best;
+}
+
+/**
+ * Complex-to-complex plan for one transform length of the native host FFT
+ *
+ * Lengths factoring into 2, 3, 4, 5 and small primes run as a sequence of
+ * Stockham passes with all twiddles precomputed at construction. Lengths with
+ * a larger prime factor use Bluestein's algorithm on a 2/3/5-smooth length,
+ * with the chirp and its transform precomputed as well. Data is held as
+ * separate real and imaginary arrays, and the plan itself is read-only after
+ * construction so one plan can be shared across threads.
+ *
+ * @tparam T float or double
+ */
+template <typename T>
+class HostFFTPlan1D {
+public:
+  explicit HostFFTPlan1D(index_t n) : n_(n) {
+    std::vector<index_t> factors;
+    index_t rem = n;
+    for (index_t p : {4, 2, 3, 5}) {
+      while (rem % p == 0) {
+        factors.push_back(p);
+        rem /= p;
+      }
+    }
+    for (index_t p = 7; p * p <= rem; p += 2) {
+      while (rem % p == 0) {
+        factors.push_back(p);
+        rem /= p;
+      }
+    }
+    if (rem > 1) {
+      factors.push_back(rem);
+    }
+
+    if (!factors.empty() && *std::max_element(factors.begin(), factors.end()) > HOST_FFT_MAX_GENERIC_RADIX) {
+      InitBluestein();
+      return;
+    }
+
+    index_t l1 = 1;
+    for (index_t ip : factors) {
+      Stage st;
+      st.radix = ip;
+      st.l1 = l1;
+      st.ido = n_ / (l1 * ip);
+      st.tw_off = static_cast<index_t>(twr_.size());
+      for (index_t q = 1; q < ip; q++) {
+        for (index_t i = 0; i < st.ido; i++) {
+          const double ang = -2.0 * M_PI * static_cast<double>((q * l1 * i) % n_) / static_cast<double>(n_);
+          twr_.push_back(static_cast<T>(std::cos(ang)));
+          twi_.push_back(static_cast<T>(std::sin(ang)));
+        }
+      }
+      st.root_off = static_cast<index_t>(rootr_.size());
+      if (ip > 5) {
+        for (index_t m = 0; m < ip; m++) {
+          const double ang = -2.0 * M_PI * static_cast<double>(m) / static_cast<double>(ip);
+          rootr_.push_back(static_cast<T>(std::cos(ang)));
+          rooti_.push_back(static_cast<T>(std::sin(ang)));
+        }
+      }
+      stages_.push_back(st);
+      l1 *= ip;
+    }
+  }
+
+  index_t Size() const { return n_; }
+
+  /**
+   * Number of T elements of scratch space Transform() needs
+   */
+  index_t WorkSize() const {
+    return bluestein_ ? 2 * sub_->Size() + sub_->WorkSize() : 2 * n_;
+  }
+
+  /**
+   * Transform re/im (n elements each) in place. Inverse transforms are
+   * unnormalized, matching FFTW and cuFFT.
+   */
+  void Transform(T *re, T *im, T *work, bool forward) const {
+    if (forward) {
+      Run<true>(re, im, work);
+    }
+    else {
+      Run<false>(re, im, work);
+    }
+  }
+
+private:
+  struct Stage {
+    index_t radix;
+    index_t l1;
+    index_t ido;
+    index_t tw_off;
+    index_t root_off;
+  };
+
+  void InitBluestein() {
+    bluestein_ = true;
+    const index_t m = HostFFTGoodSize(2 * n_ - 1);
+    sub_ = std::make_unique<HostFFTPlan1D<T>>(m);
+
+    // w_k = exp(-i pi k^2 / n), with k^2 reduced mod 2n to keep the angle exact
+    chirpr_.resize(n_);
+    chirpi_.resize(n_);
+    for (index_t k = 0; k < n_; k++) {
+      const double ang = -M_PI * static_cast<double>((k * k) % (2 * n_)) / static_cast<double>(n_);
+      chirpr_[k] = static_cast<T>(std::cos(ang));
+      chirpi_[k] = static_cast<T>(std::sin(ang));
+    }
+
+    // Transform of the symmetric sequence conj(w_|k|), pre-scaled by 1/m for the
+    // unnormalized inverse transform in Run()
+    kernr_.assign(m, T(0));
+    kerni_.assign(m, T(0));
+    for (index_t k = 0; k < n_; k++) {
+      kernr_[k] = chirpr_[k];
+      kerni_[k] = -chirpi_[k];
+      if (k > 0) {
+        kernr_[m - k] = chirpr_[k];
+        kerni_[m - k] = -chirpi_[k];
+      }
+    }
+    std::vector<T> work(sub_->WorkSize());
+    sub_->Transform(kernr_.data(), kerni_.data(), work.data(), true);
+    const T scale = static_cast<T>(1.0 / static_cast<double>(m));
+    for (index_t k = 0; k < m; k++) {
+      kernr_[k] *= scale;
+      kerni_[k] *= scale;
+    }
+  }
+
+  // The inverse direction uses the conjugate chirp, and since the kernel
+  // sequence is symmetric its transform is simply conjugated as well.
+  template <bool FWD>
+  void RunBluestein(T *re, T *im, T *work) const {
+    const index_t m = sub_->Size();
+    T *ar = work;
+    T *ai = work + m;
+    T *sw = work + 2 * m;
+    for (index_t k = 0; k < n_; k++) {
+      HostFFTTwiddle<FWD>(re[k], im[k], chirpr_[k], chirpi_[k], ar[k], ai[k]);
+    }
+    std::fill(ar + n_, ar + m, T(0));
+    std::fill(ai + n_, ai + m, T(0));
+
+    sub_->Transform(ar, ai, sw, true);
+#pragma omp simd
+    for (index_t k = 0; k < m; k++) {
+      HostFFTTwiddle<FWD>(ar[k], ai[k], kernr_[k], kerni_[k], ar[k], ai[k]);
+    }
+    sub_->Transform(ar, ai, sw, false);
+
+    for (index_t k = 0; k < n_; k++) {
+      HostFFTTwiddle<FWD>(ar[k], ai[k], chirpr_[k], chirpi_[k], re[k], im[k]);
+    }
+  }
+
+  template <bool FWD>
+  void Run(T *re, T *im, T *work) const {
+    if (bluestein_) {
+      RunBluestein<FWD>(re, im, work);
+      return;
+    }
+
+    T *sr = re, *si = im;
+    T *dr = work, *di = work + n_;
+    for (const auto &st : stages_) {
+      const T *twr = twr_.data() + st.tw_off;
+      const T *twi = twi_.data() + st.tw_off;
+      switch (st.radix) {
+        case 2: HostFFTPass<2, FWD>(st.ido, st.l1, sr, si, dr, di, twr, twi); break;
+        case 3: HostFFTPass<3, FWD>(st.ido, st.l1, sr, si, dr, di, twr, twi); break;
+        case 4: HostFFTPass<4, FWD>(st.ido, st.l1, sr, si, dr, di, twr, twi); break;
+        case 5: HostFFTPass<5, FWD>(st.ido, st.l1, sr, si, dr, di, twr, twi); break;
+        default:
+          HostFFTPassGeneric<FWD>(st.radix, st.ido, st.l1, sr, si, dr, di, twr, twi,
+                                  rootr_.data() + st.root_off, rooti_.data() + st.root_off);
+          break;
+      }
+      std::swap(sr, dr);
+      std::swap(si, di);
+    }
+
+    if (sr != re) {
+      std::copy(sr, sr + n_, re);
+      std::copy(si, si + n_, im);
+    }
+  }
+
+  index_t n_;
+  std::vector<Stage> stages_;
+  std::vector<T> twr_, twi_;
+  std::vector<T> rootr_, rooti_;
+
+  bool bluestein_ = false;
+  std::unique_ptr<HostFFTPlan1D<T>> sub_;
+  std::vector<T> chirpr_, chirpi_;
+  std::vector<T> kernr_, kerni_;
+};
+
+/**
+ * Real-input plan for one transform length of the native host FFT
+ *
+ * Even lengths pack the n real samples into n/2 complex values, run a half
+ * length complex transform, and split the result with one extra twiddle pass.
+ * Odd lengths run a full length complex transform on zero imaginary parts.
+ * Buffers hold the packed samples on the real side (see HostFFTLoadReal()) and
+ * the n/2 + 1 non-redundant bins on the complex side.
+ *
+ * @tparam T float or double
+ */
+template <typename T>
+class HostRealFFT1D {
+public:
+  explicit HostRealFFT1D(index_t n) : n_(n), plan_(n % 2 == 0 ? n / 2 : n) {
+    if (n_ % 2 == 0) {
+      const index_t h = n_ / 2;
+      rtwr_.resize(h + 1);
+      rtwi_.resize(h + 1);
+      for (index_t k = 0; k <= h; k++) {
+        const double ang = -2.0 * M_PI * static_cast<double>(k) / static_cast<double>(n_);
+        rtwr_[k] = static_cast<T>(std::cos(ang));
+        rtwi_[k] = static_cast<T>(std::sin(ang));
+      }
+    }
+  }
+
+  index_t Size() const { return n_; }
+
+  /**
+   * Number of elements needed in each of the re/im buffers
+   */
+  index_t BufferSize() const { return n_ % 2 == 0 ? n_ / 2 + 1 : n_; }
+
+  index_t WorkSize() const { return plan_.WorkSize(); }
+
+  /**
+   * Packed real samples in re/im to bins 0..n/2
+   */
+  void Forward(T *re, T *im, T *work) const {
+    plan_.Transform(re, im, work, true);
+    if (n_ % 2 != 0) {
+      return;
+    }
+
+    // X_k = E_k + W^k O_k, with E/O recovered from Z_k and conj(Z_{h-k})
+    const index_t h = n_ / 2;
+    const T z0r = re[0], z0i = im[0];
+    re[0] = z0r + z0i;
+    im[0] = 0;
+    re[h] = z0r - z0i;
+    im[h] = 0;
+    for (index_t k = 1; k <= h / 2; k++) {
+      const index_t kc = h - k;
+      const T ar = re[k], ai = im[k], br = re[kc], bi = im[kc];
+      Split(ar, ai, br, bi, k, re[k], im[k]);
+      if (kc != k) {
+        Split(br, bi, ar, ai, kc, re[kc], im[kc]);
+      }
+    }
+  }
+
+  /**
+   * Bins 0..n/2 in re/im to packed real samples, unnormalized. The imaginary
+   * parts of the DC and Nyquist bins are ignored.
+   */
+  void Inverse(T *re, T *im, T *work) const {
+    im[0] = 0;
+    if (n_ % 2 != 0) {
+      for (index_t k = n_ / 2 + 1; k < n_; k++) {
+        re[k] = re[n_ - k];
+        im[k] = -im[n_ - k];
+      }
+      plan_.Transform(re, im, work, false);
+      return;
+    }
+
+    // Z_k = (X_k + conj(X_{h-k})) + i W^-k (X_k - conj(X_{h-k}))
+    const index_t h = n_ / 2;
+    const T x0 = re[0], xh = re[h];
+    re[0] = x0 + xh;
+    im[0] = x0 - xh;
+    for (index_t k = 1; k <= h / 2; k++) {
+      const index_t kc = h - k;
+      const T ar = re[k], ai = im[k], br = re[kc], bi = im[kc];
+      Merge(ar, ai, br, bi, k, re[k], im[k]);
+      if (kc != k) {
+        Merge(br, bi, ar, ai, kc, re[kc], im[kc]);
+      }
+    }
+    plan_.Transform(re, im, work, false);
+  }
+
+private:
+  void Split(T ar, T ai, T br, T bi, index_t k, T &xr, T &xi) const {
+    // E = (a + conj(b)) / 2, O = -i (a - conj(b)) / 2
+    const T er = static_cast<T>(0.5) * (ar + br);
+    const T ei = static_cast<T>(0.5) * (ai - bi);
+    const T or_ = static_cast<T>(0.5) * (ai + bi);
+    const T oi = static_cast<T>(-0.5) * (ar - br);
+    xr = er + or_ * rtwr_[k] - oi * rtwi_[k];
+    xi = ei + or_ * rtwi_[k] + oi * rtwr_[k];
+  }
+
+  void Merge(T ar, T ai, T br, T bi, index_t k, T &zr, T &zi) const {
+    // d = i W^-k (a - conj(b))
+    const T sr = ar - br, si = ai + bi;
+    const T tr = sr * rtwr_[k] + si * rtwi_[k];
+    const T ti = si * rtwr_[k] - sr * rtwi_[k];
+    zr = (ar + br) - ti;
+    zi = (ai - bi) + tr;
+  }
+
+  index_t n_;
+  HostFFTPlan1D<T> plan_;
+  std::vector<T> rtwr_, rtwi_;
+};
+
+/**
+ * Gather n complex values at the given stride into split re/im arrays
+ */
+template <typename T, typename C>
+__MATX_INLINE__ void HostFFTLoadComplex(const C *x, index_t stride, index_t n, T *re, T *im) {
+#pragma omp simd
+  for (index_t k = 0; k < n; k++) {
+    re[k] = static_cast<T>(x[k * stride].real());
+    im[k] = static_cast<T>(x[k * stride].imag());
+  }
+}
+
+/**
+ * Scatter n complex values from split re/im arrays at the given stride
+ */
+template <typename C, typename T>
+__MATX_INLINE__ void HostFFTStoreComplex(const T *re, const T *im, index_t n, C *y, index_t stride) {
+  for (index_t k = 0; k < n; k++) {
+    y[k * stride] = C(re[k], im[k]);
+  }
+}
+
+/**
+ * Gather n real samples in the packed layout of HostRealFFT1D: even and odd
+ * samples into re/im for even n, or samples with zero imaginary parts for odd n
+ */
+template <typename T, typename R>
+__MATX_INLINE__ void HostFFTLoadReal(const R *x, index_t stride, index_t n, T *re, T *im) {
+  if (n % 2 == 0) {
+#pragma omp simd
+    for (index_t k = 0; k < n / 2; k++) {
+      re[k] = static_cast<T>(x[2 * k * stride]);
+      im[k] = static_cast<T>(x[(2 * k + 1) * stride]);
+    }
+  }
+  else {
+#pragma omp simd
+    for (index_t k = 0; k < n; k++) {
+      re[k] = static_cast<T>(x[k * stride]);
+      im[k] = T(0);
+    }
+  }
+}
+
+/**
+ * Scatter n real samples from the packed layout of HostRealFFT1D
+ */
+template <typename R, typename T>
+__MATX_INLINE__ void HostFFTStoreReal(const T *re, const T *im, index_t n, R *y, index_t stride) {
+  if (n % 2 == 0) {
+    for (index_t k = 0; k < n / 2; k++) {
+      y[2 * k * stride] = static_cast<R>(re[k]);
+      y[(2 * k + 1) * stride] = static_cast<R>(im[k]);
+    }
+  }
+  else {
+    for (index_t k = 0; k < n; k++) {
+      y[k * stride] = static_cast<R>(re[k]);
+    }
+  }
+}
+
+} // end namespace detail
+
+} // end namespace matx
@@ -36,6 +36,8 @@
 #include "matx/core/error.h"
 #include "matx/core/nvtx.h"
 #include "matx/core/tensor.h"
+#include "matx/executors/host.h"
+#include "matx/transforms/batched_small_host.h"
 #include <cstdio>
 #include <numeric>
 
@@ -613,5 +615,69 @@ void inv_impl(TensorTypeAInv &a_inv, const TensorTypeA &a,
   );
 }
 
+/**
+ * @brief Perform a matrix inverse on the host
+ *
+ * Each matrix is inverted with an LU factorization with partial pivoting
+ * followed by a solve against the identity. Batches of matrices up to 16x16 run
+ * on the batch-interleaved small-matrix kernels, which process several matrices
+ * per vector instruction; larger matrices are inverted one at a time. No host
+ * LAPACK library is required.
+ *
+ * @tparam TensorTypeAInv Inverse type
+ * @tparam TensorTypeA Input type
+ * @tparam MODE Threading policy
+ * @param a_inv Inverse tensor
+ * @param a Input tensor
+ * @param exec Host executor
+ */
+template <typename TensorTypeAInv, typename TensorTypeA, ThreadsMode MODE>
+void inv_impl(TensorTypeAInv &a_inv, const TensorTypeA &a,
+              const HostExecutor<MODE> &exec)
+{
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  static_assert(TensorTypeAInv::Rank() == TensorTypeA::Rank(), "Input and output ranks must match");
+  constexpr int RANK = TensorTypeA::Rank();
+  static_assert(RANK >= 2);
+  using T1 = typename TensorTypeAInv::value_type;
+  MATX_STATIC_ASSERT_STR(detail::HostSmallSupported<T1>(), matxInvalidType,
+    "Host inverse only supports float, double and their complex types");
+
+  MATX_ASSERT(a.Size(RANK - 1) == a.Size(RANK - 2), matxInvalidSize);
+  for (int i = 0; i < RANK; i++) {
+    MATX_ASSERT(a.Size(i) == a_inv.Size(i), matxInvalidSize);
+  }
+
+  auto a_new = OpToTensor(a, exec);
+  if (!is_matx_transform_op<TensorTypeA>() && !a_new.isSameView(a)) {
+    (a_new = a).run(exec);
+  }
+
+  const index_t n = a_new.Size(RANK - 1);
+  index_t batches = 1;
+  for (int r = 0; r < RANK - 2; r++) {
+    batches *= a_new.Size(r);
+  }
+
+  const auto batch_ptr = [](auto &t, index_t f) {
+    cuda::std::array<index_t, RANK> idx{0};
+    for (int r = RANK - 3; r >= 0; r--) {
+      idx[r] = f % t.Size(r);
+      f /= t.Size(r);
+    }
+    return cuda::std::apply([&t](auto... param) { return t.GetPointer(param...); }, idx);
+  };
+
+  const index_t info = detail::HostSmallInvBatched<T1>(n,
+      {a_new.Stride(RANK - 2), a_new.Stride(RANK - 1)},
+      {a_inv.Stride(RANK - 2), a_inv.Stride(RANK - 1)}, batches,
+      [&](index_t f) { return static_cast<const T1 *>(batch_ptr(a_new, f)); },
+      [&](index_t f) { return batch_ptr(a_inv, f); },
+      exec.GetNumThreads());
+
+  if (info != 0) {
+    MATX_THROW(matxLUError, "inverse failed");
+  }
+}
 
 } // end namespace matx
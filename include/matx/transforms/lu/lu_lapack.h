@@ -39,6 +39,7 @@
 #include "matx/executors/host.h"
 #include "matx/executors/support.h"
 #include "matx/transforms/solver_common.h"
+#include "matx/transforms/batched_small_host.h"
 
 #include <cstdio>
 #include <numeric>
@@ -145,18 +146,30 @@ public:
       (out = a).run(exec);
     }
 
+    const index_t batches = static_cast<index_t>(this->batch_a_ptrs.size());
     lapack_int_t info;
-    for (size_t i = 0; i < this->batch_a_ptrs.size(); i++) {
-      getrf_dispatch(&params.m, &params.n, reinterpret_cast<T1*>(this->batch_a_ptrs[i]),
-                     &params.m, reinterpret_cast<T2*>(this->batch_piv_ptrs[i]), &info);
-
-      if (info < 0) {
-        MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
-          ("Parameter " + std::to_string(-info) + " had an illegal value in LAPACK getrf").c_str());
-      } else {
-        MATX_ASSERT_STR_EXP(info, 0, matxSolverError, 
-          ("U is singular: U(" + std::to_string(info) + "," + std::to_string(info) + ") = 0 in LAPACK getrf").c_str());
-      }
+    if (params.m == params.n && HostSmallEligible(params.n, batches)) {
+      const index_t n = params.n;
+      info = static_cast<lapack_int_t>(HostSmallLuBatched<T1>(n, HostSmallLayout{1, n}, batches,
+        [&](index_t i) { return reinterpret_cast<T1*>(this->batch_a_ptrs[static_cast<size_t>(i)]); },
+        [&](index_t i) { return reinterpret_cast<T2*>(this->batch_piv_ptrs[static_cast<size_t>(i)]); },
+        exec.GetNumThreads()));
+    } else {
+      info = HostLapackBatchFor(exec.GetNumThreads(), this->batch_a_ptrs.size(),
+        [&](size_t i, int) {
+          lapack_int_t binfo;
+          getrf_dispatch(&params.m, &params.n, reinterpret_cast<T1*>(this->batch_a_ptrs[i]),
+                         &params.m, reinterpret_cast<T2*>(this->batch_piv_ptrs[i]), &binfo);
+          return binfo;
+        });
+    }
+
+    if (info < 0) {
+      MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
+        ("Parameter " + std::to_string(-info) + " had an illegal value in LAPACK getrf").c_str());
+    } else {
+      MATX_ASSERT_STR_EXP(info, 0, matxSolverError, 
+        ("U is singular: U(" + std::to_string(info) + "," + std::to_string(info) + ") = 0 in LAPACK getrf").c_str());
     }
   }
 
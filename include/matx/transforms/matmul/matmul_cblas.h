@@ -39,8 +39,11 @@
 #include "matx/executors/host.h"
 #include "matx/executors/support.h"
 #include "matx/transforms/matmul/matmul_common.h"
+#include "matx/transforms/matmul/matmul_host.h"
+#include "matx/transforms/batched_small_host.h"
 
 #include <cstdio>
+#include <limits>
 #include <numeric>
 
 #ifdef MATX_EN_NVPL
@@ -49,6 +52,7 @@
     #define nvpl_dcomplex_t cuda::std::complex<double>
   #endif
   #include <nvpl_blas_cblas.h>
+  #include <nvpl_blas_service.h>
   using cblas_int_t = nvpl_int_t;
 #elif defined(MATX_EN_OPENBLAS)
   #include <cblas.h>
@@ -76,11 +80,49 @@ constexpr bool CompatibleGemmCBLASTypes() {
     return false;
   }
 
-  // List of accepted types when A/B/C match
+  // List of accepted types when A/B/C match. Half types always run on the
+  // built-in GEMM since CBLAS has no half-precision interface.
   return std::is_same_v<typename OpA::value_type, float> ||
          std::is_same_v<typename OpA::value_type, double> ||
          std::is_same_v<typename OpA::value_type, cuda::std::complex<float>> ||
-         std::is_same_v<typename OpA::value_type, cuda::std::complex<double>>;
+         std::is_same_v<typename OpA::value_type, cuda::std::complex<double>> ||
+         is_matx_half_v<typename OpA::value_type> ||
+         is_complex_half_v<typename OpA::value_type>;
+}
+
+/**
+ * Pointers to the A, B and C matrices of flattened batch f of a batched GEMM.
+ *
+ * The batch dimensions of C (all but the last two) are walked as one flattened
+ * batch index. A or B may be rank 2, in which case it is shared by every batch.
+ */
+template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB>
+__MATX_INLINE__ auto GemmBatchPointers(const TensorTypeC &c, const TensorTypeA &a,
+                                       const TensorTypeB &b, size_t f)
+{
+  static constexpr int RANK = TensorTypeC::Rank();
+  using shape_type = typename TensorTypeA::desc_type::shape_type;
+
+  cuda::std::array<shape_type, RANK> idx{0};
+  for (int r = RANK - 3; r >= 0; r--) {
+    const size_t size = static_cast<size_t>(c.Size(r));
+    idx[r] = static_cast<shape_type>(f % size);
+    f /= size;
+  }
+
+  cuda::std::array<shape_type, TensorTypeA::Rank()> a_idx{0};
+  cuda::std::array<shape_type, TensorTypeB::Rank()> b_idx{0};
+  if constexpr (TensorTypeA::Rank() == RANK) {
+    a_idx = idx;
+  }
+  if constexpr (TensorTypeB::Rank() == RANK) {
+    b_idx = idx;
+  }
+
+  return cuda::std::make_tuple(
+    cuda::std::apply([&a](auto... param) { return a.GetPointer(param...); }, a_idx),
+    cuda::std::apply([&b](auto... param) { return b.GetPointer(param...); }, b_idx),
+    cuda::std::apply([&c](auto... param) { return c.GetPointer(param...); }, idx));
 }
 
 #if MATX_EN_CPU_MATMUL
@@ -105,6 +147,57 @@ struct MatMulCBLASParams_t {
   CBLAS_TRANSPOSE opB;
 };
 
+/**
+ * Run func(begin, end) over n independent BLAS calls on the host's threads.
+ *
+ * With at least one call per thread, each thread runs its own share on a
+ * single-threaded library. Fewer calls than threads go to the library's own
+ * threading.
+ *
+ * @tparam Func Callable taking (index_t begin, index_t end)
+ * @param num_threads Number of threads to use
+ * @param n Number of BLAS calls
+ * @param func Function issuing calls [begin, end)
+ */
+template <typename Func>
+__MATX_INLINE__ void HostBlasParallelFor(int num_threads, index_t n, Func &&func)
+{
+  const bool parallel = num_threads > 1 && n >= static_cast<index_t>(num_threads);
+
+#ifdef MATX_EN_NVPL
+  HostParallelForBlocked(parallel ? num_threads : 1, n, [&](index_t i0, index_t i1) {
+    if (parallel) {
+      nvpl_blas_set_num_threads_local(1);
+    }
+    func(i0, i1);
+    if (parallel) {
+      nvpl_blas_set_num_threads_local(0);
+    }
+  });
+#elif defined(MATX_EN_OPENBLAS) || defined(MATX_EN_BLIS)
+  #ifdef MATX_EN_OPENBLAS
+  using LibThreads = HostLibThreads<HostLibOpenBLAS>;
+  const LibThreads::GetFn get = openblas_get_num_threads;
+  const LibThreads::SetFn set = openblas_set_num_threads;
+  #else
+  using LibThreads = HostLibThreads<HostLibBLIS>;
+  const LibThreads::GetFn get = []() { return static_cast<int>(bli_thread_get_num_threads()); };
+  const LibThreads::SetFn set = [](int threads) { bli_thread_set_num_threads(threads); };
+  #endif
+
+  if (parallel) {
+    LibThreads::Serial serial(get, set);
+    HostParallelForBlocked(num_threads, n, func);
+  }
+  else {
+    LibThreads::Set(set, num_threads);
+    HostParallelForBlocked(1, n, func);
+  }
+#else
+  HostParallelForBlocked(parallel ? num_threads : 1, n, func);
+#endif
+}
+
 template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB>
 static MatMulCBLASParams_t GetGemmParams(TensorTypeC &c,
                                          const TensorTypeA &a,
@@ -239,7 +332,7 @@ __MATX_INLINE__ void matmul_exec(TensorTypeC &c,
                                  MatMulCBLASParams_t &params,
                                  const float alpha,
                                  const float beta,
-                                 [[maybe_unused]] const HostExecutor<MODE> &exec)
+                                 const HostExecutor<MODE> &exec)
 {
   MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
 
@@ -248,9 +341,6 @@ __MATX_INLINE__ void matmul_exec(TensorTypeC &c,
 
   // Prep for batch looping
   using shape_type = typename TensorTypeA::desc_type::shape_type;
-  [[maybe_unused]] cuda::std::array<shape_type, TensorTypeA::Rank()> a_idx{0};
-  [[maybe_unused]] cuda::std::array<shape_type, TensorTypeB::Rank()> b_idx{0};
-  [[maybe_unused]] cuda::std::array<shape_type, TensorTypeC::Rank()> c_idx{0};
   [[maybe_unused]] size_t total_iter = 1;
 
   if constexpr (RANK > 3) {
@@ -274,94 +364,83 @@ __MATX_INLINE__ void matmul_exec(TensorTypeC &c,
     sbeta = beta;
   }
 
-#ifdef MATX_EN_NVPL
-  if constexpr (RANK <= 3) {
-    auto a_ptr = a.Data();
-    auto b_ptr = b.Data();
-    auto c_ptr = c.Data();
+  [[maybe_unused]] const auto batch_pointers = [&](size_t f) {
+    return GemmBatchPointers(c, a, b, f);
+  };
 
+  [[maybe_unused]] const int num_threads = exec.GetNumThreads();
+
+#ifdef MATX_EN_NVPL
+  const auto gemm_batch = [&](auto ap, auto bp, auto cp, cblas_int_t batch) {
     if constexpr (std::is_same_v<value_type, float>) {
       cblas_sgemm_batch_strided(CblasRowMajor, params.opA, params.opB,
                                 params.m, params.n, params.k, salpha,
-                                a_ptr, params.lda, params.astride,
-                                b_ptr, params.ldb, params.bstride, sbeta,
-                                c_ptr, params.ldc, params.cstride, params.batch);
+                                ap, params.lda, params.astride,
+                                bp, params.ldb, params.bstride, sbeta,
+                                cp, params.ldc, params.cstride, batch);
     } else if constexpr (std::is_same_v<value_type, double>) {
       cblas_dgemm_batch_strided(CblasRowMajor, params.opA, params.opB,
                                 params.m, params.n, params.k, salpha,
-                                a_ptr, params.lda, params.astride,
-                                b_ptr, params.ldb, params.bstride, sbeta,
-                                c_ptr, params.ldc, params.cstride, params.batch);
+                                ap, params.lda, params.astride,
+                                bp, params.ldb, params.bstride, sbeta,
+                                cp, params.ldc, params.cstride, batch);
     } else if constexpr (std::is_same_v<value_type, cuda::std::complex<float>>) {
       cblas_cgemm_batch_strided(CblasRowMajor, params.opA, params.opB,
                                 params.m, params.n, params.k, (void *)&salpha,
-                                (void *)a_ptr, params.lda, params.astride,
-                                (void *)b_ptr, params.ldb, params.bstride, (void *)&sbeta,
-                                (void *)c_ptr, params.ldc, params.cstride, params.batch);
+                                (void *)ap, params.lda, params.astride,
+                                (void *)bp, params.ldb, params.bstride, (void *)&sbeta,
+                                (void *)cp, params.ldc, params.cstride, batch);
     } else if constexpr (std::is_same_v<value_type, cuda::std::complex<double>>) {
       cblas_zgemm_batch_strided(CblasRowMajor, params.opA, params.opB,
                                 params.m, params.n, params.k, (void *)&salpha,
-                                (void *)a_ptr, params.lda, params.astride,
-                                (void *)b_ptr, params.ldb, params.bstride, (void *)&sbeta,
-                                (void *)c_ptr, params.ldc, params.cstride, params.batch);
+                                (void *)ap, params.lda, params.astride,
+                                (void *)bp, params.ldb, params.bstride, (void *)&sbeta,
+                                (void *)cp, params.ldc, params.cstride, batch);
     }
+  };
+
+  if constexpr (RANK <= 3) {
+    gemm_batch(a.Data(), b.Data(), c.Data(), params.batch);
   } else {
-    for (size_t iter = 0; iter < total_iter; iter++) {
-
-      // Get pointers into A/B/C for this round
-      auto ap = cuda::std::apply([&a](auto... param) { return a.GetPointer(param...); }, a_idx);
-      auto bp = cuda::std::apply([&b](auto... param) { return b.GetPointer(param...); }, b_idx);
-      auto cp = cuda::std::apply([&c](auto... param) { return c.GetPointer(param...); }, c_idx);
-
-      if constexpr (std::is_same_v<value_type, float>) {
-        cblas_sgemm_batch_strided(CblasRowMajor, params.opA, params.opB,
-                                  params.m, params.n, params.k, salpha,
-                                  ap, params.lda, params.astride,
-                                  bp, params.ldb, params.bstride, sbeta,
-                                  cp, params.ldc, params.cstride, params.batch);
-      } else if constexpr (std::is_same_v<value_type, double>) {
-        cblas_dgemm_batch_strided(CblasRowMajor, params.opA, params.opB,
-                                  params.m, params.n, params.k, salpha,
-                                  ap, params.lda, params.astride,
-                                  bp, params.ldb, params.bstride, sbeta,
-                                  cp, params.ldc, params.cstride, params.batch);
-      } else if constexpr (std::is_same_v<value_type, cuda::std::complex<float>>) {
-        cblas_cgemm_batch_strided(CblasRowMajor, params.opA, params.opB,
-                                  params.m, params.n, params.k, (void *)&salpha,
-                                  (void *)ap, params.lda, params.astride,
-                                  (void *)bp, params.ldb, params.bstride, (void *)&sbeta,
-                                  (void *)cp, params.ldc, params.cstride, params.batch);
-      } else if constexpr (std::is_same_v<value_type, cuda::std::complex<double>>) {
-        cblas_zgemm_batch_strided(CblasRowMajor, params.opA, params.opB,
-                                  params.m, params.n, params.k, (void *)&salpha,
-                                  (void *)ap, params.lda, params.astride,
-                                  (void *)bp, params.ldb, params.bstride, (void *)&sbeta,
-                                  (void *)cp, params.ldc, params.cstride, params.batch);
+    // When every outer batch dimension steps by a whole inner batch, all batches are one
+    // strided sequence and the library gets them in a single call.
+    const auto collapsible = [](const auto &t) {
+      using t_type = remove_cvref_t<decltype(t)>;
+      if constexpr (t_type::Rank() == RANK) {
+        for (int r = 0; r < RANK - 3; r++) {
+          if (t.Stride(r) != t.Stride(r + 1) * t.Size(r + 1)) {
+            return false;
+          }
+        }
       }
+      return true;
+    };
 
-      // Update all but the last 3 indices
-      UpdateIndices<TensorTypeA, shape_type, TensorTypeA::Rank()>(a, a_idx, 3);
-      UpdateIndices<TensorTypeB, shape_type, TensorTypeB::Rank()>(b, b_idx, 3);
-      UpdateIndices<TensorTypeC, shape_type, TensorTypeC::Rank()>(c, c_idx, 3);
+    if (collapsible(a) && collapsible(b) && collapsible(c) &&
+        total_iter * params.batch <= static_cast<size_t>(std::numeric_limits<cblas_int_t>::max())) {
+      gemm_batch(a.Data(), b.Data(), c.Data(), static_cast<cblas_int_t>(total_iter * params.batch));
+    } else {
+      // Otherwise spread the outer batches across the executor's threads, each issuing
+      // single-threaded batched calls
+      const bool parallel = num_threads > 1 && total_iter > 1;
+      HostParallelForBlocked(parallel ? num_threads : 1, static_cast<index_t>(total_iter), [&](index_t i0, index_t i1) {
+        if (parallel) {
+          nvpl_blas_set_num_threads_local(1);
+        }
+        for (index_t iter = i0; iter < i1; iter++) {
+          const auto ptrs = batch_pointers(static_cast<size_t>(iter) * params.batch);
+          gemm_batch(cuda::std::get<0>(ptrs), cuda::std::get<1>(ptrs), cuda::std::get<2>(ptrs), params.batch);
+        }
+        if (parallel) {
+          nvpl_blas_set_num_threads_local(0);
+        }
+      });
     }
   }
 #else
   // The batch api is a new addition to BLIS and OpenBLAS, so it may not be present.
   // Thus, we default to the standard gemm api and loop over anything above the 2nd dimension.
-
-  #ifdef MATX_EN_OPENBLAS
-  openblas_set_num_threads(exec.GetNumThreads());
-  #elif defined(MATX_EN_BLIS)
-  bli_thread_set_num_threads(exec.GetNumThreads());
-  #endif
-
-  total_iter *= params.batch;
-  for (size_t iter = 0; iter < total_iter; iter++) {
-    // Get pointers into A/B/C for this round
-    auto ap = cuda::std::apply([&a](auto... param) { return a.GetPointer(param...); }, a_idx);
-    auto bp = cuda::std::apply([&b](auto... param) { return b.GetPointer(param...); }, b_idx);
-    auto cp = cuda::std::apply([&c](auto... param) { return c.GetPointer(param...); }, c_idx);
-
+  const auto gemm = [&](auto ap, auto bp, auto cp) {
     if constexpr (std::is_same_v<value_type, float>) {
       cblas_sgemm(CblasRowMajor, params.opA, params.opB,
                   params.m, params.n, params.k, salpha,
@@ -377,25 +456,30 @@ __MATX_INLINE__ void matmul_exec(TensorTypeC &c,
     } else if constexpr (std::is_same_v<value_type, cuda::std::complex<float>>) {
       cblas_cgemm(CblasRowMajor, params.opA, params.opB,
                   params.m, params.n, params.k, (void *)&salpha,
-                  (const void **)ap, params.lda,
-                  (const void **)bp, params.ldb, (void *)&sbeta,
-                  (void **)cp, params.ldc);
+                  (const void *)ap, params.lda,
+                  (const void *)bp, params.ldb, (void *)&sbeta,
+                  (void *)cp, params.ldc);
     } else if constexpr (std::is_same_v<value_type, cuda::std::complex<double>>) {
       cblas_zgemm(CblasRowMajor, params.opA, params.opB,
                   params.m, params.n, params.k, (void *)&salpha,
-                  (const void **)ap, params.lda,
-                  (const void **)bp, params.ldb, (void *)&sbeta,
-                  (void **)cp, params.ldc);
+                  (const void *)ap, params.lda,
+                  (const void *)bp, params.ldb, (void *)&sbeta,
+                  (void *)cp, params.ldc);
     }
+  };
 
-    // Update all but the last 2 indices
-    UpdateIndices<TensorTypeA, shape_type, TensorTypeA::Rank()>(a, a_idx, 2);
-    UpdateIndices<TensorTypeB, shape_type, TensorTypeB::Rank()>(b, b_idx, 2);
-    UpdateIndices<TensorTypeC, shape_type, TensorTypeC::Rank()>(c, c_idx, 2);
-  }
+  total_iter *= params.batch;
+  HostBlasParallelFor(num_threads, static_cast<index_t>(total_iter), [&](index_t i0, index_t i1) {
+    for (index_t iter = i0; iter < i1; iter++) {
+      const auto ptrs = batch_pointers(static_cast<size_t>(iter));
+      gemm(cuda::std::get<0>(ptrs), cuda::std::get<1>(ptrs), cuda::std::get<2>(ptrs));
+    }
+  });
 #endif
 }
 
+#endif
+
 template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB, ThreadsMode MODE>
 __MATX_INLINE__ void matmul_dispatch(TensorTypeC &c,
                                      const TensorTypeA &a,
@@ -428,10 +512,41 @@ __MATX_INLINE__ void matmul_dispatch(TensorTypeC &c,
     }
   }
 
-  auto params = GetGemmParams(c, a, b);
-  matmul_exec(c, a, b, params, alpha, beta, exec);
-}
+  using T = typename TensorTypeC::value_type;
+  constexpr bool use_blas = MATX_EN_CPU_MATMUL && !is_matx_half_v<T> && !is_complex_half_v<T>;
+
+  if constexpr (HostSmallSupported<T>()) {
+    // Batches of tiny matrices run on the batch-interleaved small-matrix kernels
+    // rather than one BLAS call per matrix
+    const index_t m = a.Size(TensorTypeA::Rank() - 2);
+    const index_t n = b.Size(TensorTypeB::Rank() - 1);
+    const index_t k = a.Size(TensorTypeA::Rank() - 1);
+    index_t batches = 1;
+    for (int r = 0; r < RANK - 2; r++) {
+      batches *= c.Size(r);
+    }
+    if (HostSmallEligible(cuda::std::max(m, cuda::std::max(n, k)), batches)) {
+      HostSmallGemmBatched<T>(m, n, k, alpha, beta,
+          {a.Stride(TensorTypeA::Rank() - 2), a.Stride(TensorTypeA::Rank() - 1)},
+          {b.Stride(TensorTypeB::Rank() - 2), b.Stride(TensorTypeB::Rank() - 1)},
+          {c.Stride(RANK - 2), c.Stride(RANK - 1)},
+          batches, [&](index_t f) { return GemmBatchPointers(c, a, b, static_cast<size_t>(f)); },
+          exec.GetNumThreads());
+      return;
+    }
+  }
+
+  if constexpr (use_blas) {
+#if MATX_EN_CPU_MATMUL
+    auto params = GetGemmParams(c, a, b);
+    matmul_exec(c, a, b, params, alpha, beta, exec);
 #endif
+  }
+  else {
+    // No BLAS library configured, or a half type: use the built-in blocked GEMM
+    matmul_host_exec(c, a, b, alpha, beta, exec);
+  }
+}
 
 } // end namespace detail
 
@@ -458,7 +573,11 @@ __MATX_INLINE__ auto getCBLASSupportedTensor( const Op &in) {
 
 
 /**
- * Run a CBLAS GEMM
+ * Run a GEMM on the host
+ *
+ * Uses the configured BLAS library (NVPL, OpenBLAS or BLIS) when there is one,
+ * and otherwise the built-in blocked GEMM in matmul_host.h. Half-precision
+ * types always use the built-in GEMM, which computes them in single precision.
  *
  * @tparam TensorTypeC
  *   Data type of C tensor or operator
@@ -491,9 +610,7 @@ void matmul_impl([[maybe_unused]] TensorTypeC C,
                  [[maybe_unused]] float beta = 0.0)
 {
   MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
-  MATX_ASSERT_STR(MATX_EN_CPU_MATMUL, matxInvalidExecutor, "Trying to run MatMul on host executor but host MatMul support is not configured");
 
-#if MATX_EN_CPU_MATMUL
   constexpr auto is_c_complex = is_complex_v<typename TensorTypeC::value_type>;
 
   if constexpr (is_c_complex) {
@@ -544,7 +661,6 @@ void matmul_impl([[maybe_unused]] TensorTypeC C,
   if (!c.isSameView(C)) {
     (C = c).run(exec);
   }
-#endif
 }
 
 }; // end namespace matx
@@ -0,0 +1,427 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/tensor.h"
+#include "matx/executors/host.h"
+
+namespace matx {
+
+namespace detail {
+
+/**
+ * Blocking parameters for the built-in host GEMM. MR x NR is the register
+ * tile of the microkernel, sized so the accumulators fit the vector register
+ * file of common AVX2/NEON targets. KC x NR slivers of B stay in L1, an
+ * MC x KC block of A in L2, and a KC x NC panel of B in L3.
+ */
+template <typename T> struct HostGemmBlocking;
+
+template <> struct HostGemmBlocking<float> {
+  static constexpr index_t MR = 6;
+  static constexpr index_t NR = 16;
+  static constexpr index_t MC = 144;
+  static constexpr index_t KC = 256;
+  static constexpr index_t NC = 4080;
+};
+
+template <> struct HostGemmBlocking<double> {
+  static constexpr index_t MR = 6;
+  static constexpr index_t NR = 8;
+  static constexpr index_t MC = 96;
+  static constexpr index_t KC = 256;
+  static constexpr index_t NC = 4080;
+};
+
+template <> struct HostGemmBlocking<cuda::std::complex<float>> {
+  static constexpr index_t MR = 4;
+  static constexpr index_t NR = 8;
+  static constexpr index_t MC = 96;
+  static constexpr index_t KC = 192;
+  static constexpr index_t NC = 2040;
+};
+
+template <> struct HostGemmBlocking<cuda::std::complex<double>> {
+  static constexpr index_t MR = 4;
+  static constexpr index_t NR = 4;
+  static constexpr index_t MC = 64;
+  static constexpr index_t KC = 192;
+  static constexpr index_t NC = 2040;
+};
+
+/**
+ * Compute type of the built-in host GEMM for storage type S. Half-precision
+ * data is computed in single precision.
+ */
+template <typename S>
+using host_gemm_compute_t = std::conditional_t<is_complex_half_v<S>, cuda::std::complex<float>, promote_half_t<S>>;
+
+/**
+ * Convert a stored value to the compute type T
+ */
+template <typename T, typename S>
+__MATX_INLINE__ T HostGemmWiden(const S &v) {
+  if constexpr (std::is_same_v<T, S>) {
+    return v;
+  } else if constexpr (is_complex_v<T>) {
+    using R = typename T::value_type;
+    return T(static_cast<R>(v.real()), static_cast<R>(v.imag()));
+  } else {
+    return static_cast<T>(v);
+  }
+}
+
+/**
+ * Convert n stored values at stride cs to the compute type T. Contiguous rows
+ * of fp16/bf16 go through the vectorized batch conversion.
+ */
+template <typename T, typename S>
+__MATX_INLINE__ void HostGemmWidenRow(const S *src, index_t cs, index_t n, T *dst) {
+  if constexpr (is_matx_half_v<S>) {
+    if (cs == 1) {
+      HostHalfToFloatN(src, dst, n);
+      return;
+    }
+  }
+
+  for (index_t j = 0; j < n; j++) {
+    dst[j] = HostGemmWiden<T>(src[j * cs]);
+  }
+}
+
+/**
+ * Convert a computed value back to the storage type S
+ */
+template <typename S, typename T>
+__MATX_INLINE__ S HostGemmNarrow(const T &v) {
+  if constexpr (std::is_same_v<T, S>) {
+    return v;
+  } else if constexpr (is_complex_v<S>) {
+    return S(v.real(), v.imag());
+  } else {
+    return static_cast<S>(v);
+  }
+}
+
+/**
+ * Pack rows [0, mc) x columns [0, kc) of A into MR-row slivers, each stored
+ * column by column (MR contiguous values per k), zero-padding the last one.
+ * Values are converted to the compute type T as they are packed.
+ */
+template <index_t MR, typename T, typename S>
+__MATX_INLINE__ void HostGemmPackA(index_t mc, index_t kc, const S *A,
+                                   index_t rsa, index_t csa, T *Ap) {
+  for (index_t ir = 0; ir < mc; ir += MR) {
+    const index_t mr = std::min(MR, mc - ir);
+    T *dst = Ap + ir * kc;
+    for (index_t p = 0; p < kc; p++) {
+      const S *src = A + ir * rsa + p * csa;
+      HostGemmWidenRow(src, rsa, mr, dst + p * MR);
+      for (index_t i = mr; i < MR; i++) {
+        dst[p * MR + i] = T(0);
+      }
+    }
+  }
+}
+
+/**
+ * Pack rows [0, kc) x columns [0, nc) of B into NR-column slivers, each
+ * stored row by row, zero-padding the last one. Complex values are split into
+ * NR real parts followed by NR imaginary parts per row, so the complex
+ * microkernel runs entirely on real vectors.
+ */
+template <index_t NR, typename T, typename S>
+__MATX_INLINE__ void HostGemmPackB(index_t kc, index_t nc, const S *B,
+                                   index_t rsb, index_t csb, T *Bp,
+                                   int num_threads) {
+  const index_t slivers = (nc + NR - 1) / NR;
+  HostParallelForBlocked(num_threads, slivers, [&](index_t s0, index_t s1) {
+    for (index_t s = s0; s < s1; s++) {
+      const index_t jr = s * NR;
+      const index_t nr = std::min(NR, nc - jr);
+      T *dst = Bp + jr * kc;
+      for (index_t p = 0; p < kc; p++) {
+        const S *src = B + p * rsb + jr * csb;
+        if constexpr (is_complex_v<T>) {
+          using R = typename T::value_type;
+          R *row = reinterpret_cast<R *>(dst + p * NR);
+          for (index_t j = 0; j < nr; j++) {
+            row[j] = static_cast<R>(src[j * csb].real());
+            row[NR + j] = static_cast<R>(src[j * csb].imag());
+          }
+          for (index_t j = nr; j < NR; j++) {
+            row[j] = R(0);
+            row[NR + j] = R(0);
+          }
+        } else {
+          HostGemmWidenRow(src, csb, nr, dst + p * NR);
+          for (index_t j = nr; j < NR; j++) {
+            dst[p * NR + j] = T(0);
+          }
+        }
+      }
+    }
+  });
+}
+
+/**
+ * MR x NR register-blocked microkernel: C = alpha * Ap * Bp + beta * C for
+ * one packed sliver of A and B, storing only the valid mr x nr corner. A zero
+ * beta overwrites C without reading it.
+ */
+template <index_t MR, index_t NR, typename T, typename S>
+__MATX_INLINE__ void HostGemmMicroKernel(index_t kc, const T *Ap, const T *Bp,
+                                         S *C, index_t rsc, index_t csc,
+                                         index_t mr, index_t nr, T alpha,
+                                         T beta) {
+  if constexpr (is_complex_v<T>) {
+    using R = typename T::value_type;
+    R cr[MR][NR] = {};
+    R ci[MR][NR] = {};
+    for (index_t p = 0; p < kc; p++) {
+      const T *a = Ap + p * MR;
+      const R *br = reinterpret_cast<const R *>(Bp + p * NR);
+      const R *bi = br + NR;
+      for (index_t i = 0; i < MR; i++) {
+        const R ar = a[i].real();
+        const R ai = a[i].imag();
+        #pragma omp simd
+        for (index_t j = 0; j < NR; j++) {
+          cr[i][j] += ar * br[j] - ai * bi[j];
+          ci[i][j] += ar * bi[j] + ai * br[j];
+        }
+      }
+    }
+    for (index_t i = 0; i < mr; i++) {
+      for (index_t j = 0; j < nr; j++) {
+        S &c = C[i * rsc + j * csc];
+        const T v = alpha * T(cr[i][j], ci[i][j]);
+        c = HostGemmNarrow<S>(beta == T(0) ? v : v + beta * HostGemmWiden<T>(c));
+      }
+    }
+  } else {
+    T acc[MR][NR] = {};
+    for (index_t p = 0; p < kc; p++) {
+      const T *a = Ap + p * MR;
+      const T *b = Bp + p * NR;
+      for (index_t i = 0; i < MR; i++) {
+        const T ai = a[i];
+        #pragma omp simd
+        for (index_t j = 0; j < NR; j++) {
+          acc[i][j] += ai * b[j];
+        }
+      }
+    }
+    for (index_t i = 0; i < mr; i++) {
+      for (index_t j = 0; j < nr; j++) {
+        S &c = C[i * rsc + j * csc];
+        c = HostGemmNarrow<S>(beta == T(0) ? alpha * acc[i][j]
+                                           : alpha * acc[i][j] + beta * HostGemmWiden<T>(c));
+      }
+    }
+  }
+}
+
+/**
+ * Built-in host GEMM, C = alpha * A * B + beta * C, with A (m x k), B (k x n)
+ * and C (m x n) addressed through arbitrary row and column strides.
+ *
+ * This follows the Goto/BLIS structure: B is packed one KC x NC panel at a
+ * time and shared by all threads, and the M x N extent of the panel is split
+ * into a grid of MC-row blocks by groups of NR-column slivers. Each thread
+ * packs the A block it needs and runs the microkernel over its slivers.
+ *
+ * A, B and C are stored as S and computed as T. When S is narrower than T
+ * (half precision), values are widened while packing and narrowed on store,
+ * and K is not split into panels so each output is rounded only once. The
+ * MC and NC blocks shrink instead to keep the packed buffers the same size.
+ */
+template <typename T, typename S>
+__MATX_INLINE__ void HostGemm(index_t m, index_t n, index_t k, T alpha,
+                              const S *A, index_t rsa, index_t csa, const S *B,
+                              index_t rsb, index_t csb, T beta, S *C,
+                              index_t rsc, index_t csc, int num_threads) {
+  using Blk = HostGemmBlocking<T>;
+  constexpr index_t MR = Blk::MR;
+  constexpr index_t NR = Blk::NR;
+  constexpr bool narrow = !std::is_same_v<T, S>;
+  const index_t KC = narrow ? std::max(Blk::KC, k) : Blk::KC;
+  const index_t MC = narrow ? std::max(MR, std::min(Blk::MC, Blk::MC * Blk::KC / KC / MR * MR)) : Blk::MC;
+  const index_t NC = narrow ? std::max(NR, std::min(Blk::NC, Blk::NC * Blk::KC / KC / NR * NR)) : Blk::NC;
+
+  if (m == 0 || n == 0) {
+    return;
+  }
+  if (k == 0 || alpha == T(0)) {
+    for (index_t i = 0; i < m; i++) {
+      for (index_t j = 0; j < n; j++) {
+        S &c = C[i * rsc + j * csc];
+        c = HostGemmNarrow<S>(beta == T(0) ? T(0) : beta * HostGemmWiden<T>(c));
+      }
+    }
+    return;
+  }
+
+  // Smaller row blocks when there are few rows, so every thread gets work.
+  const index_t threads = std::max(1, num_threads);
+  const index_t mc_fair = ((m + threads - 1) / threads + MR - 1) / MR * MR;
+  const index_t mc = std::max(MR, std::min(MC, mc_fair));
+  const index_t mblocks = (m + mc - 1) / mc;
+
+  std::vector<T> bpack(std::min(KC, k) * ((std::min(NC, n) + NR - 1) / NR * NR));
+
+  for (index_t jc = 0; jc < n; jc += NC) {
+    const index_t nc = std::min(NC, n - jc);
+    const index_t slivers = (nc + NR - 1) / NR;
+    const index_t nsplit =
+        std::min(slivers, std::max(index_t{1}, threads / mblocks));
+
+    for (index_t pc = 0; pc < k; pc += KC) {
+      const index_t kc = std::min(KC, k - pc);
+      // Only the first K panel applies the caller's beta, later panels add.
+      const T beta_p = pc == 0 ? beta : T(1);
+
+      HostGemmPackB<NR>(kc, nc, B + pc * rsb + jc * csb, rsb, csb,
+                        bpack.data(), num_threads);
+
+      HostParallelForBlocked(num_threads, mblocks * nsplit,
+                             [&](index_t w0, index_t w1) {
+        std::vector<T> apack(mc * kc);
+        index_t packed = -1;
+        for (index_t w = w0; w < w1; w++) {
+          const index_t mb = w / nsplit;
+          const index_t ns = w % nsplit;
+          const index_t ic = mb * mc;
+          const index_t mcb = std::min(mc, m - ic);
+          if (packed != mb) {
+            HostGemmPackA<MR>(mcb, kc, A + ic * rsa + pc * csa, rsa, csa,
+                              apack.data());
+            packed = mb;
+          }
+          const index_t s0 = (slivers * ns) / nsplit;
+          const index_t s1 = (slivers * (ns + 1)) / nsplit;
+          for (index_t s = s0; s < s1; s++) {
+            const index_t jr = s * NR;
+            const index_t nr = std::min(NR, nc - jr);
+            for (index_t ir = 0; ir < mcb; ir += MR) {
+              const index_t mr = std::min(MR, mcb - ir);
+              HostGemmMicroKernel<MR, NR>(
+                  kc, apack.data() + ir * kc, bpack.data() + jr * kc,
+                  C + (ic + ir) * rsc + (jc + jr) * csc, rsc, csc, mr, nr,
+                  alpha, beta_p);
+            }
+          }
+        }
+      });
+    }
+  }
+}
+
+/**
+ * Run the built-in host GEMM over all batches of rank >= 2 tensors whose
+ * batch dimensions have already been validated by the caller. When there
+ * are at least as many small batches as threads, whole GEMMs are spread
+ * across threads instead of splitting each one. Half-precision tensors are
+ * computed in single precision.
+ */
+template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB,
+          ThreadsMode MODE>
+__MATX_INLINE__ void matmul_host_exec(TensorTypeC &c, const TensorTypeA &a,
+                                      const TensorTypeB &b, const float alpha,
+                                      const float beta,
+                                      const HostExecutor<MODE> &exec) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+
+  using T = typename TensorTypeC::value_type;
+  using TC = host_gemm_compute_t<T>;
+  static constexpr int RANKA = TensorTypeA::Rank();
+  static constexpr int RANKB = TensorTypeB::Rank();
+  static constexpr int RANKC = TensorTypeC::Rank();
+
+  const index_t m = a.Size(RANKA - 2);
+  const index_t n = b.Size(RANKB - 1);
+  const index_t k = a.Size(RANKA - 1);
+  const TC salpha = static_cast<TC>(alpha);
+  const TC sbeta = static_cast<TC>(beta);
+
+  // Gather the matrix pointers of every batch up front.
+  using shape_type = typename TensorTypeA::desc_type::shape_type;
+  cuda::std::array<shape_type, RANKA> a_idx{0};
+  cuda::std::array<shape_type, RANKB> b_idx{0};
+  cuda::std::array<shape_type, RANKC> c_idx{0};
+  index_t batches = 1;
+  for (int r = 0; r < RANKC - 2; r++) {
+    batches *= c.Size(r);
+  }
+  std::vector<const T *> aps(batches), bps(batches);
+  std::vector<T *> cps(batches);
+  for (index_t i = 0; i < batches; i++) {
+    aps[i] = cuda::std::apply([&a](auto... param) { return a.GetPointer(param...); }, a_idx);
+    bps[i] = cuda::std::apply([&b](auto... param) { return b.GetPointer(param...); }, b_idx);
+    cps[i] = cuda::std::apply([&c](auto... param) { return c.GetPointer(param...); }, c_idx);
+    UpdateIndices<TensorTypeA, shape_type, RANKA>(a, a_idx, 2);
+    UpdateIndices<TensorTypeB, shape_type, RANKB>(b, b_idx, 2);
+    UpdateIndices<TensorTypeC, shape_type, RANKC>(c, c_idx, 2);
+  }
+
+  const auto gemm = [&](index_t i, int threads) {
+    HostGemm<TC, T>(m, n, k, salpha, aps[i], a.Stride(RANKA - 2),
+                a.Stride(RANKA - 1), bps[i], b.Stride(RANKB - 2),
+                b.Stride(RANKB - 1), sbeta, cps[i], c.Stride(RANKC - 2),
+                c.Stride(RANKC - 1), threads);
+  };
+
+  const int threads = exec.GetNumThreads();
+  constexpr index_t small_gemm = 128 * 128 * 128;
+  if (threads > 1 && batches >= threads && m * n * k <= small_gemm) {
+    HostParallelForBlocked(threads, batches, [&](index_t b0, index_t b1) {
+      for (index_t i = b0; i < b1; i++) {
+        gemm(i, 1);
+      }
+    });
+  } else {
+    for (index_t i = 0; i < batches; i++) {
+      gemm(i, threads);
+    }
+  }
+}
+
+} // end namespace detail
+
+} // end namespace matx
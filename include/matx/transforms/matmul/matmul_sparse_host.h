@@ -0,0 +1,510 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "matx/core/sparse_tensor.h"
+#include "matx/core/tensor.h"
+#include "matx/executors/host.h"
+
+namespace matx {
+
+namespace detail {
+
+/**
+ * Split the rows [0, m) of a compressed matrix into blocks that each hold
+ * roughly the same number of nonzeros. Balancing by nonzeros rather than by
+ * rows keeps threads evenly loaded on matrices with a few very dense rows.
+ * Returns blocks + 1 row boundaries.
+ */
+template <typename POS>
+__MATX_INLINE__ std::vector<index_t>
+SparseHostBalancedSplits(const POS *pos, index_t m, index_t blocks) {
+  std::vector<index_t> splits(blocks + 1);
+  const index_t base = static_cast<index_t>(pos[0]);
+  const index_t nnz = static_cast<index_t>(pos[m]) - base;
+  splits[0] = 0;
+  for (index_t b = 1; b < blocks; b++) {
+    const index_t target = base + (nnz * b) / blocks;
+    const index_t row = static_cast<index_t>(
+        std::lower_bound(pos, pos + m + 1, static_cast<POS>(target)) - pos);
+    splits[b] = std::clamp(row, splits[b - 1], m);
+  }
+  splits[blocks] = m;
+  return splits;
+}
+
+/**
+ * Build row positions for a row-sorted COO matrix so that it can run through
+ * the compressed-row kernels. cuSPARSE places the same sortedness requirement
+ * on its COO inputs.
+ */
+template <typename CRD>
+__MATX_INLINE__ std::vector<index_t> SparseHostCOORowPositions(const CRD *rows,
+                                                               index_t nse,
+                                                               index_t m) {
+  std::vector<index_t> pos(m + 1, 0);
+  for (index_t e = 0; e < nse; e++) {
+    pos[static_cast<index_t>(rows[e]) + 1]++;
+  }
+  for (index_t i = 0; i < m; i++) {
+    pos[i + 1] += pos[i];
+  }
+  return pos;
+}
+
+// Gathered inner product of one compressed row with a dense vector
+template <typename TCOMP, typename POS, typename CRD, typename TA, typename TB>
+__MATX_INLINE__ TCOMP SparseHostDot(const TA *vals, const CRD *idx, POS begin,
+                                    POS end, const TB *x, index_t incx) {
+  TCOMP acc{0};
+  if constexpr (is_complex_v<TCOMP>) {
+    for (POS e = begin; e < end; e++) {
+      acc += static_cast<TCOMP>(vals[e]) *
+             static_cast<TCOMP>(x[static_cast<index_t>(idx[e]) * incx]);
+    }
+  } else {
+    #pragma omp simd reduction(+ : acc)
+    for (POS e = begin; e < end; e++) {
+      acc += static_cast<TCOMP>(vals[e]) *
+             static_cast<TCOMP>(x[static_cast<index_t>(idx[e]) * incx]);
+    }
+  }
+  return acc;
+}
+
+// acc[0:n] += a * x[0:n:incx]
+template <typename TCOMP, typename TB>
+__MATX_INLINE__ void SparseHostAxpy(TCOMP a, const TB *x, index_t incx,
+                                    TCOMP *acc, index_t n) {
+  if (incx == 1) {
+    #pragma omp simd
+    for (index_t j = 0; j < n; j++) {
+      acc[j] += a * static_cast<TCOMP>(x[j]);
+    }
+  } else {
+    for (index_t j = 0; j < n; j++) {
+      acc[j] += a * static_cast<TCOMP>(x[j * incx]);
+    }
+  }
+}
+
+// y = alpha * acc + beta * y. A zero beta overwrites y without reading it.
+template <typename TCOMP, typename TC>
+__MATX_INLINE__ void SparseHostStore(TC &y, TCOMP acc, TCOMP alpha,
+                                     TCOMP beta) {
+  if (beta == TCOMP{0}) {
+    y = static_cast<TC>(alpha * acc);
+  } else {
+    y = static_cast<TC>(alpha * acc + beta * static_cast<TCOMP>(y));
+  }
+}
+
+/**
+ * Compressed-row SpMV/SpMM on the host: C = alpha * A * B + beta * C, with
+ * A given by row positions, column indices and values. B and C are dense
+ * with arbitrary strides, and an SpMV is the n == 1 case. Rows are split
+ * across threads by nonzero count.
+ */
+template <typename TCOMP, typename POS, typename CRD, typename TA,
+          typename TB, typename TC>
+__MATX_INLINE__ void
+SparseHostRowsMM(const POS *pos, const CRD *crd, const TA *vals, const TB *B,
+                 index_t ldb_r, index_t ldb_c, TC *C, index_t ldc_r,
+                 index_t ldc_c, index_t m, index_t n, TCOMP alpha, TCOMP beta,
+                 int num_threads) {
+  const index_t blocks = std::max(index_t{1}, std::min(static_cast<index_t>(num_threads), m));
+  const auto splits = SparseHostBalancedSplits(pos, m, blocks);
+
+  HostParallelForBlocked(num_threads, blocks, [&](index_t b0, index_t b1) {
+    if (n == 1) {
+      for (index_t i = splits[b0]; i < splits[b1]; i++) {
+        const TCOMP acc =
+            SparseHostDot<TCOMP>(vals, crd, pos[i], pos[i + 1], B, ldb_r);
+        SparseHostStore(C[i * ldc_r], acc, alpha, beta);
+      }
+      return;
+    }
+
+    std::vector<TCOMP> acc(n);
+    for (index_t i = splits[b0]; i < splits[b1]; i++) {
+      std::fill(acc.begin(), acc.end(), TCOMP{0});
+      for (POS e = pos[i]; e < pos[i + 1]; e++) {
+        SparseHostAxpy(static_cast<TCOMP>(vals[e]),
+                       B + static_cast<index_t>(crd[e]) * ldb_r, ldb_c,
+                       acc.data(), n);
+      }
+      for (index_t j = 0; j < n; j++) {
+        SparseHostStore(C[i * ldc_r + j * ldc_c], acc[j], alpha, beta);
+      }
+    }
+  });
+}
+
+/**
+ * Compressed-column SpMV/SpMM on the host. Each column of A scatters into
+ * the rows of C, so threads either own a range of output columns (SpMM) or
+ * accumulate into private buffers that are reduced at the end (SpMV). Column
+ * ranges are balanced by nonzero count in the latter case.
+ */
+template <typename TCOMP, typename POS, typename CRD, typename TA,
+          typename TB, typename TC>
+__MATX_INLINE__ void
+SparseHostColsMM(const POS *pos, const CRD *crd, const TA *vals, const TB *B,
+                 index_t ldb_r, index_t ldb_c, TC *C, index_t ldc_r,
+                 index_t ldc_c, index_t m, index_t k, index_t n, TCOMP alpha,
+                 TCOMP beta, int num_threads) {
+  if (n == 1) {
+    const index_t blocks = std::max(index_t{1}, std::min(static_cast<index_t>(num_threads), k));
+    const auto splits = SparseHostBalancedSplits(pos, k, blocks);
+    std::vector<TCOMP> partial(blocks * m);
+
+    HostParallelForBlocked(num_threads, blocks, [&](index_t b0, index_t b1) {
+      for (index_t b = b0; b < b1; b++) {
+        TCOMP *acc = partial.data() + b * m;
+        std::fill(acc, acc + m, TCOMP{0});
+        for (index_t kk = splits[b]; kk < splits[b + 1]; kk++) {
+          const TCOMP x = static_cast<TCOMP>(B[kk * ldb_r]);
+          for (POS e = pos[kk]; e < pos[kk + 1]; e++) {
+            acc[static_cast<index_t>(crd[e])] += static_cast<TCOMP>(vals[e]) * x;
+          }
+        }
+      }
+    });
+
+    HostParallelForBlocked(num_threads, m, [&](index_t i0, index_t i1) {
+      for (index_t i = i0; i < i1; i++) {
+        TCOMP acc{0};
+        for (index_t b = 0; b < blocks; b++) {
+          acc += partial[b * m + i];
+        }
+        SparseHostStore(C[i * ldc_r], acc, alpha, beta);
+      }
+    });
+    return;
+  }
+
+  HostParallelForBlocked(num_threads, n, [&](index_t j0, index_t j1) {
+    const index_t nb = j1 - j0;
+    std::vector<TCOMP> acc(m * nb, TCOMP{0});
+    for (index_t kk = 0; kk < k; kk++) {
+      const TB *brow = B + kk * ldb_r + j0 * ldb_c;
+      for (POS e = pos[kk]; e < pos[kk + 1]; e++) {
+        SparseHostAxpy(static_cast<TCOMP>(vals[e]), brow, ldb_c,
+                       acc.data() + static_cast<index_t>(crd[e]) * nb, nb);
+      }
+    }
+    for (index_t i = 0; i < m; i++) {
+      for (index_t j = 0; j < nb; j++) {
+        SparseHostStore(C[i * ldc_r + (j0 + j) * ldc_c], acc[i * nb + j],
+                        alpha, beta);
+      }
+    }
+  });
+}
+
+/**
+ * Diagonal SpMV/SpMM on the host, mirroring diai_spmv_kernel and
+ * diaj_spmv_kernel: row i reads diagonal d at column j = i + diags[d], and
+ * the value is indexed by row (DIA-I) or by column (DIA-J). Work per row is
+ * uniform, so rows are split evenly.
+ */
+template <bool BY_ROW, typename TCOMP, typename CRD, typename TA, typename TB,
+          typename TC>
+__MATX_INLINE__ void
+SparseHostDiaMM(const TA *vals, const CRD *diags, index_t numD, const TB *B,
+                index_t ldb_r, index_t ldb_c, TC *C, index_t ldc_r,
+                index_t ldc_c, index_t m, index_t k, index_t n, TCOMP alpha,
+                TCOMP beta, int num_threads) {
+  HostParallelForBlocked(num_threads, m, [&](index_t i0, index_t i1) {
+    std::vector<TCOMP> acc(n);
+    for (index_t i = i0; i < i1; i++) {
+      std::fill(acc.begin(), acc.end(), TCOMP{0});
+      for (index_t d = 0; d < numD; d++) {
+        const index_t j = i + static_cast<index_t>(diags[d]); // signed
+        if (0 <= j && j < k) {
+          const TCOMP a = static_cast<TCOMP>(BY_ROW ? vals[d * m + i] : vals[d * k + j]);
+          SparseHostAxpy(a, B + j * ldb_r, ldb_c, acc.data(), n);
+        }
+      }
+      for (index_t j = 0; j < n; j++) {
+        SparseHostStore(C[i * ldc_r + j * ldc_c], acc[j], alpha, beta);
+      }
+    }
+  });
+}
+
+/**
+ * Block-sparse (BSR) SpMV/SpMM on the host with dense BM x BN blocks stored
+ * row-major. Block rows are split across threads by stored block count, and
+ * each block is applied by a microkernel whose loops over the block are
+ * fully unrolled at compile time. For SpMM the columns of C are processed in
+ * tiles so the BM-row accumulator tile stays in cache.
+ */
+template <int BM, int BN, typename TCOMP, typename POS, typename CRD,
+          typename TA, typename TB, typename TC>
+__MATX_INLINE__ void
+SparseHostBsrMM(const POS *pos, const CRD *crd, const TA *vals, const TB *B,
+                index_t ldb_r, index_t ldb_c, TC *C, index_t ldc_r,
+                index_t ldc_c, index_t mb, index_t n, TCOMP alpha, TCOMP beta,
+                int num_threads) {
+  constexpr index_t NT = 64;
+  const index_t blocks = std::max(index_t{1}, std::min(static_cast<index_t>(num_threads), mb));
+  const auto splits = SparseHostBalancedSplits(pos, mb, blocks);
+
+  HostParallelForBlocked(num_threads, blocks, [&](index_t b0, index_t b1) {
+    if (n == 1) {
+      for (index_t ib = splits[b0]; ib < splits[b1]; ib++) {
+        TCOMP acc[BM] = {};
+        for (POS e = pos[ib]; e < pos[ib + 1]; e++) {
+          const TA *blk = vals + static_cast<index_t>(e) * BM * BN;
+          const TB *x = B + static_cast<index_t>(crd[e]) * BN * ldb_r;
+          TCOMP xb[BN];
+          #pragma unroll
+          for (int c = 0; c < BN; c++) {
+            xb[c] = static_cast<TCOMP>(x[c * ldb_r]);
+          }
+          #pragma unroll
+          for (int r = 0; r < BM; r++) {
+            #pragma unroll
+            for (int c = 0; c < BN; c++) {
+              acc[r] += static_cast<TCOMP>(blk[r * BN + c]) * xb[c];
+            }
+          }
+        }
+        #pragma unroll
+        for (int r = 0; r < BM; r++) {
+          SparseHostStore(C[(ib * BM + r) * ldc_r], acc[r], alpha, beta);
+        }
+      }
+      return;
+    }
+
+    std::vector<TCOMP> acc(BM * NT);
+    for (index_t ib = splits[b0]; ib < splits[b1]; ib++) {
+      for (index_t j0 = 0; j0 < n; j0 += NT) {
+        const index_t nt = std::min(NT, n - j0);
+        std::fill(acc.begin(), acc.end(), TCOMP{0});
+        for (POS e = pos[ib]; e < pos[ib + 1]; e++) {
+          const TA *blk = vals + static_cast<index_t>(e) * BM * BN;
+          const TB *brow = B + static_cast<index_t>(crd[e]) * BN * ldb_r + j0 * ldb_c;
+          #pragma unroll
+          for (int r = 0; r < BM; r++) {
+            #pragma unroll
+            for (int c = 0; c < BN; c++) {
+              SparseHostAxpy(static_cast<TCOMP>(blk[r * BN + c]), brow + c * ldb_r,
+                             ldb_c, acc.data() + r * NT, nt);
+            }
+          }
+        }
+        for (int r = 0; r < BM; r++) {
+          for (index_t j = 0; j < nt; j++) {
+            SparseHostStore(C[(ib * BM + r) * ldc_r + (j0 + j) * ldc_c],
+                            acc[r * NT + j], alpha, beta);
+          }
+        }
+      }
+    }
+  });
+}
+
+/**
+ * Dispatch a host SpMM on the storage format of A. B and C are rank-2 dense
+ * tensors (SpMV callers pass rank-1 vectors as a single column).
+ */
+template <typename TensorTypeA, typename TB, typename TC>
+__MATX_INLINE__ void
+SparseHostMM(const TensorTypeA &a, const TB *B, index_t ldb_r, index_t ldb_c,
+             TC *C, index_t ldc_r, index_t ldc_c, index_t n, float alpha,
+             float beta, int num_threads) {
+  using TA = typename TensorTypeA::val_type;
+  using TCOMP = promote_half_t<TC>;
+  using Format = typename TensorTypeA::Format;
+
+  const index_t m = a.Size(0);
+  [[maybe_unused]] const index_t k = a.Size(1);
+  const TCOMP salpha = static_cast<TCOMP>(alpha);
+  const TCOMP sbeta = static_cast<TCOMP>(beta);
+  const TA *vals = a.Data();
+
+  if constexpr (Format::isCSR()) {
+    SparseHostRowsMM(a.POSData(1), a.CRDData(1), vals, B, ldb_r, ldb_c, C,
+                     ldc_r, ldc_c, m, n, salpha, sbeta, num_threads);
+  } else if constexpr (Format::isCOO()) {
+    const auto pos = SparseHostCOORowPositions(a.CRDData(0), a.Nse(), m);
+    SparseHostRowsMM(pos.data(), a.CRDData(1), vals, B, ldb_r, ldb_c, C,
+                     ldc_r, ldc_c, m, n, salpha, sbeta, num_threads);
+  } else if constexpr (Format::isCSC()) {
+    SparseHostColsMM(a.POSData(1), a.CRDData(1), vals, B, ldb_r, ldb_c, C,
+                     ldc_r, ldc_c, m, k, n, salpha, sbeta, num_threads);
+  } else if constexpr (Format::isDIAI() || Format::isDIAJ()) {
+    SparseHostDiaMM<Format::isDIAI()>(vals, a.CRDData(0), a.crdSize(0), B,
+                                      ldb_r, ldb_c, C, ldc_r, ldc_c, m, k, n,
+                                      salpha, sbeta, num_threads);
+  } else if constexpr (Format::isBSR()) {
+    using Lvl2 = cuda::std::tuple_element_t<2, typename Format::LvlSpecs>;
+    using Lvl3 = cuda::std::tuple_element_t<3, typename Format::LvlSpecs>;
+    constexpr int BM = Lvl2::Expr::cj;
+    constexpr int BN = Lvl3::Expr::cj;
+    SparseHostBsrMM<BM, BN>(a.POSData(1), a.CRDData(1), vals, B, ldb_r, ldb_c,
+                            C, ldc_r, ldc_c, m / BM, n, salpha, sbeta,
+                            num_threads);
+  } else {
+    MATX_THROW(matxNotSupported,
+               "Host sparse matmul only supports COO/CSR/CSC/DIA/BSR");
+  }
+}
+
+template <typename Op>
+__MATX_INLINE__ auto getSparseHostSupportedTensor(const Op &in) {
+  // The host kernels take arbitrary strides, so any view can be used as-is
+  const auto func = [&]() { return true; };
+  return GetSupportedTensor(in, func, MATX_HOST_MALLOC_MEMORY);
+}
+
+} // end namespace detail
+
+/**
+ * Sparse matrix times dense matrix on the host: C = alpha * A * B + beta * C.
+ */
+template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB,
+          ThreadsMode MODE>
+void sparse_matmul_impl(TensorTypeC &C, const TensorTypeA &a,
+                        const TensorTypeB &B,
+                        const HostExecutor<MODE> &exec, float alpha = 1.0,
+                        float beta = 0.0) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+
+  auto b = detail::getSparseHostSupportedTensor(B);
+  auto c = detail::getSparseHostSupportedTensor(C);
+  if (!is_matx_transform_op<TensorTypeB>() && !b.isSameView(B)) {
+    (b = B).run(exec);
+  }
+
+  using atype = TensorTypeA;
+  using btype = decltype(b);
+  using ctype = decltype(c);
+
+  using TA = typename atype::value_type;
+  using TB = typename btype::value_type;
+  using TC = typename ctype::value_type;
+
+  static constexpr int RANKA = atype::Rank();
+  static constexpr int RANKB = btype::Rank();
+  static constexpr int RANKC = ctype::Rank();
+
+  // Restrictions.
+  static_assert(RANKA == 2 && RANKB == 2 && RANKC == 2,
+                "tensors must have rank-2");
+  static_assert(std::is_same_v<TC, TA> && std::is_same_v<TC, TB>,
+                "tensors must have the same data type");
+  static_assert(std::is_same_v<TC, matx::matxFp16> ||
+                    std::is_same_v<TC, matx::matxBf16> ||
+                    std::is_same_v<TC, float> || std::is_same_v<TC, double> ||
+                    std::is_same_v<TC, cuda::std::complex<float>> ||
+                    std::is_same_v<TC, cuda::std::complex<double>>,
+                "unsupported data type");
+  MATX_ASSERT(a.Size(RANKA - 1) == b.Size(RANKB - 2) &&
+                  c.Size(RANKC - 1) == b.Size(RANKB - 1) &&
+                  c.Size(RANKC - 2) == a.Size(RANKA - 2),
+              matxInvalidSize);
+
+  detail::SparseHostMM(a, b.Data(), b.Stride(0), b.Stride(1), c.Data(),
+                       c.Stride(0), c.Stride(1), c.Size(1), alpha, beta,
+                       exec.GetNumThreads());
+
+  // Copy transformed output back.
+  if (!c.isSameView(C)) {
+    (C = c).run(exec);
+  }
+}
+
+/**
+ * Sparse matrix times dense vector on the host: C = alpha * A * B + beta * C.
+ */
+template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB,
+          ThreadsMode MODE>
+void sparse_matvec_impl(TensorTypeC &C, const TensorTypeA &a,
+                        const TensorTypeB &B,
+                        const HostExecutor<MODE> &exec, float alpha = 1.0,
+                        float beta = 0.0) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+
+  auto b = detail::getSparseHostSupportedTensor(B);
+  auto c = detail::getSparseHostSupportedTensor(C);
+  if (!is_matx_transform_op<TensorTypeB>() && !b.isSameView(B)) {
+    (b = B).run(exec);
+  }
+
+  using atype = TensorTypeA;
+  using btype = decltype(b);
+  using ctype = decltype(c);
+
+  using TA = typename atype::value_type;
+  using TB = typename btype::value_type;
+  using TC = typename ctype::value_type;
+
+  static constexpr int RANKA = atype::Rank();
+  static constexpr int RANKB = btype::Rank();
+  static constexpr int RANKC = ctype::Rank();
+
+  // Restrictions.
+  static_assert(RANKA == 2 && RANKB == 1 && RANKC == 1,
+                "tensors must have SpMV rank");
+  static_assert(std::is_same_v<TC, TA> && std::is_same_v<TC, TB>,
+                "tensors must have the same data type");
+  static_assert(std::is_same_v<TC, matx::matxFp16> ||
+                    std::is_same_v<TC, matx::matxBf16> ||
+                    std::is_same_v<TC, float> || std::is_same_v<TC, double> ||
+                    std::is_same_v<TC, cuda::std::complex<float>> ||
+                    std::is_same_v<TC, cuda::std::complex<double>>,
+                "unsupported data type");
+  MATX_ASSERT(a.Size(RANKA - 1) == b.Size(RANKB - 1) &&
+                  a.Size(RANKA - 2) == c.Size(RANKC - 1),
+              matxInvalidSize);
+
+  // A vector is a single column with the vector's stride between rows
+  detail::SparseHostMM(a, b.Data(), b.Stride(0), index_t{1}, c.Data(),
+                       c.Stride(0), index_t{1}, index_t{1}, alpha, beta,
+                       exec.GetNumThreads());
+
+  // Copy transformed output back.
+  if (!c.isSameView(C)) {
+    (C = c).run(exec);
+  }
+}
+
+} // end namespace matx
@@ -0,0 +1,371 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/tensor.h"
+#include "matx/executors/host.h"
+#include "matx/executors/support.h"
+#include "matx/transforms/matmul/matmul_cblas.h"
+
+namespace matx {
+
+namespace detail {
+
+/**
+ * Whether a host matvec or outer product on these types can go to the BLAS
+ * Level-2 routines (gemv/ger). Anything else, including half types and mixed
+ * types, stays on the GEMM path.
+ */
+template <typename OpC, typename OpA, typename OpB>
+constexpr bool CompatibleLevel2CBLASTypes() {
+  using T = typename OpC::value_type;
+  if constexpr (!MATX_EN_CPU_MATMUL ||
+                !std::is_same_v<typename OpA::value_type, T> ||
+                !std::is_same_v<typename OpB::value_type, T>) {
+    return false;
+  }
+  else {
+    return std::is_same_v<T, float> ||
+           std::is_same_v<T, double> ||
+           std::is_same_v<T, cuda::std::complex<float>> ||
+           std::is_same_v<T, cuda::std::complex<double>>;
+  }
+}
+
+/**
+ * Get a tensor whose last dimension can be handed to CBLAS as a vector. Views
+ * with a positive last stride are used in place, while operators and repeated
+ * or reversed vectors get a new tensor.
+ */
+template <typename Op>
+__MATX_INLINE__ auto getCBLASSupportedVector(const Op &in) {
+  const auto support_func = [&]() {
+    if constexpr (is_tensor_view_v<Op>) {
+      return in.Stride(Op::Rank() - 1) > 0 || in.Size(Op::Rank() - 1) <= 1;
+    }
+    else {
+      return true;
+    }
+  };
+
+  return GetSupportedTensor(in, support_func, MATX_HOST_MALLOC_MEMORY);
+}
+
+/**
+ * Pointer to the first element of the matrix or vector at batch index bidx.
+ * Only the leading batch dimensions are indexed; the rest stay at zero.
+ */
+template <typename Op, size_t BATCH_RANK>
+__MATX_INLINE__ auto Level2BatchPointer(const Op &op, const cuda::std::array<index_t, BATCH_RANK> &bidx)
+{
+  cuda::std::array<index_t, Op::Rank()> idx{0};
+  for (int r = 0; r < static_cast<int>(BATCH_RANK); r++) {
+    idx[r] = bidx[r];
+  }
+  return cuda::std::apply([&op](auto... param) { return op.GetPointer(param...); }, idx);
+}
+
+/**
+ * Unflatten batch f over the leading BATCH_RANK dimensions of op
+ */
+template <size_t BATCH_RANK, typename Op>
+__MATX_INLINE__ cuda::std::array<index_t, BATCH_RANK> Level2BatchIndex(const Op &op, index_t f)
+{
+  cuda::std::array<index_t, BATCH_RANK> idx{};
+  for (int r = static_cast<int>(BATCH_RANK) - 1; r >= 0; r--) {
+    idx[r] = f % op.Size(r);
+    f /= op.Size(r);
+  }
+  return idx;
+}
+
+#if MATX_EN_CPU_MATMUL
+/**
+ * Leading dimension and CBLAS layout of a matrix view with a unit stride in one
+ * of its last two dimensions. A dimension of size 1 has an arbitrary stride, so
+ * the leading dimension is set to the smallest value CBLAS accepts instead.
+ */
+template <typename Op>
+__MATX_INLINE__ auto Level2MatrixLayout(const Op &op)
+{
+  constexpr int RANK = Op::Rank();
+  const index_t rows = op.Size(RANK - 2);
+  const index_t cols = op.Size(RANK - 1);
+
+  if (op.Stride(RANK - 1) == 1) {
+    const index_t ld = rows > 1 ? op.Stride(RANK - 2) : cuda::std::max(cols, index_t{1});
+    return cuda::std::make_tuple(CblasRowMajor, static_cast<cblas_int_t>(ld));
+  }
+
+  const index_t ld = cols > 1 ? op.Stride(RANK - 1) : cuda::std::max(rows, index_t{1});
+  return cuda::std::make_tuple(CblasColMajor, static_cast<cblas_int_t>(ld));
+}
+#endif
+
+/**
+ * Batched matrix-vector product on the host through cblas_?gemv
+ *
+ * Computes C = alpha*A*B + beta*C for every batch, where A is `... x m x k`, B is
+ * `... x k` and C is `... x m`. A may be row- or column-major and the vectors may
+ * have any positive stride; other layouts are copied first. Batches are spread
+ * over the executor's threads the same way batched GEMMs are.
+ *
+ * @tparam TensorTypeC
+ *   Data type of C tensor
+ * @tparam TensorTypeA
+ *   Data type of A tensor or operator
+ * @tparam TensorTypeB
+ *   Data type of B tensor or operator
+ * @tparam MODE
+ *   Threading policy
+ *
+ * @param C
+ *   Output vector(s)
+ * @param A
+ *   Input matrix(es)
+ * @param B
+ *   Input vector(s)
+ * @param alpha
+ *   Scalar multiplier to apply to operator A
+ * @param beta
+ *   Scalar multiplier to apply to operator C on input
+ * @param exec
+ *   Host executor
+ */
+template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB, ThreadsMode MODE>
+__MATX_INLINE__ void matvec_cblas_exec([[maybe_unused]] TensorTypeC &C,
+                                       [[maybe_unused]] const TensorTypeA &A,
+                                       [[maybe_unused]] const TensorTypeB &B,
+                                       [[maybe_unused]] float alpha,
+                                       [[maybe_unused]] float beta,
+                                       [[maybe_unused]] const HostExecutor<MODE> &exec)
+{
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+
+  // Batches are walked over C's dimensions and used to index A and B as well
+  for (int i = 0; i < TensorTypeC::Rank() - 1; i++) {
+    MATX_ASSERT_STR(A.Size(i) == C.Size(i), matxInvalidSize, "matvec: A and C must have the same batch sizes");
+    MATX_ASSERT_STR(B.Size(i) == C.Size(i), matxInvalidSize, "matvec: B and C must have the same batch sizes");
+  }
+
+#if MATX_EN_CPU_MATMUL
+  using T = typename TensorTypeC::value_type;
+  constexpr size_t BATCH_RANK = TensorTypeC::Rank() - 1;
+
+  auto a = getCBLASSupportedTensor(A);
+  auto b = getCBLASSupportedVector(B);
+  auto c = getCBLASSupportedVector(C);
+
+  if (!is_matx_transform_op<TensorTypeA>() && !a.isSameView(A)) {
+    (a = A).run(exec);
+  }
+
+  if (!is_matx_transform_op<TensorTypeB>() && !b.isSameView(B)) {
+    (b = B).run(exec);
+  }
+
+  if (beta != 0 && !c.isSameView(C)) {
+    (c = C).run(exec);
+  }
+
+  const auto m = static_cast<cblas_int_t>(a.Size(TensorTypeA::Rank() - 2));
+  const auto k = static_cast<cblas_int_t>(a.Size(TensorTypeA::Rank() - 1));
+  const auto a_layout = Level2MatrixLayout(a);
+  const auto layout = cuda::std::get<0>(a_layout);
+  const auto lda = cuda::std::get<1>(a_layout);
+  const auto incb = static_cast<cblas_int_t>(cuda::std::max(b.Stride(TensorTypeB::Rank() - 1), index_t{1}));
+  const auto incc = static_cast<cblas_int_t>(cuda::std::max(c.Stride(TensorTypeC::Rank() - 1), index_t{1}));
+  T salpha{alpha};
+  T sbeta{beta};
+
+  index_t batches = 1;
+  for (int r = 0; r < static_cast<int>(BATCH_RANK); r++) {
+    batches *= c.Size(r);
+  }
+
+  if (m > 0) {
+    HostBlasParallelFor(exec.GetNumThreads(), batches, [&](index_t i0, index_t i1) {
+      for (index_t f = i0; f < i1; f++) {
+        const auto idx = Level2BatchIndex<BATCH_RANK>(c, f);
+        const auto ap = Level2BatchPointer(a, idx);
+        const auto bp = Level2BatchPointer(b, idx);
+        const auto cp = Level2BatchPointer(c, idx);
+
+        if constexpr (std::is_same_v<T, float>) {
+          cblas_sgemv(layout, CblasNoTrans, m, k, salpha, ap, lda, bp, incb, sbeta, cp, incc);
+        } else if constexpr (std::is_same_v<T, double>) {
+          cblas_dgemv(layout, CblasNoTrans, m, k, salpha, ap, lda, bp, incb, sbeta, cp, incc);
+        } else if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
+          cblas_cgemv(layout, CblasNoTrans, m, k, (void *)&salpha, (const void *)ap, lda,
+                      (const void *)bp, incb, (void *)&sbeta, (void *)cp, incc);
+        } else if constexpr (std::is_same_v<T, cuda::std::complex<double>>) {
+          cblas_zgemv(layout, CblasNoTrans, m, k, (void *)&salpha, (const void *)ap, lda,
+                      (const void *)bp, incb, (void *)&sbeta, (void *)cp, incc);
+        }
+      }
+    });
+  }
+
+  if (!c.isSameView(C)) {
+    (C = c).run(exec);
+  }
+#endif
+}
+
+/**
+ * Batched outer product on the host through cblas_?ger/cblas_?geru
+ *
+ * Computes C = alpha*A*B^T + beta*C for every batch, where A is `... x m`, B is
+ * `... x n` and C is `... x m x n`. Neither vector is conjugated, so complex
+ * types use geru. BLAS ger has no beta, so C is scaled (or cleared when beta is
+ * zero) one batch at a time just before its update.
+ *
+ * @tparam TensorTypeC
+ *   Data type of C tensor
+ * @tparam TensorTypeA
+ *   Data type of A tensor or operator
+ * @tparam TensorTypeB
+ *   Data type of B tensor or operator
+ * @tparam MODE
+ *   Threading policy
+ *
+ * @param C
+ *   Output matrix(es)
+ * @param A
+ *   Input vector(s) along the rows of C
+ * @param B
+ *   Input vector(s) along the columns of C
+ * @param alpha
+ *   Scalar multiplier to apply to operator A
+ * @param beta
+ *   Scalar multiplier to apply to operator C on input
+ * @param exec
+ *   Host executor
+ */
+template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB, ThreadsMode MODE>
+__MATX_INLINE__ void outer_cblas_exec([[maybe_unused]] TensorTypeC &C,
+                                      [[maybe_unused]] const TensorTypeA &A,
+                                      [[maybe_unused]] const TensorTypeB &B,
+                                      [[maybe_unused]] float alpha,
+                                      [[maybe_unused]] float beta,
+                                      [[maybe_unused]] const HostExecutor<MODE> &exec)
+{
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+
+  // Batches are walked over C's dimensions and used to index A and B as well
+  for (int i = 0; i < TensorTypeC::Rank() - 2; i++) {
+    MATX_ASSERT_STR(A.Size(i) == C.Size(i), matxInvalidSize, "outer: A and C must have the same batch sizes");
+    MATX_ASSERT_STR(B.Size(i) == C.Size(i), matxInvalidSize, "outer: B and C must have the same batch sizes");
+  }
+
+#if MATX_EN_CPU_MATMUL
+  using T = typename TensorTypeC::value_type;
+  constexpr int RANK = TensorTypeC::Rank();
+  constexpr size_t BATCH_RANK = RANK - 2;
+
+  auto a = getCBLASSupportedVector(A);
+  auto b = getCBLASSupportedVector(B);
+  auto c = getCBLASSupportedTensor(C);
+
+  if (!is_matx_transform_op<TensorTypeA>() && !a.isSameView(A)) {
+    (a = A).run(exec);
+  }
+
+  if (!is_matx_transform_op<TensorTypeB>() && !b.isSameView(B)) {
+    (b = B).run(exec);
+  }
+
+  if (beta != 0 && !c.isSameView(C)) {
+    (c = C).run(exec);
+  }
+
+  const index_t m = c.Size(RANK - 2);
+  const index_t n = c.Size(RANK - 1);
+  const index_t cs0 = c.Stride(RANK - 2);
+  const index_t cs1 = c.Stride(RANK - 1);
+  const auto c_layout = Level2MatrixLayout(c);
+  const auto layout = cuda::std::get<0>(c_layout);
+  const auto ldc = cuda::std::get<1>(c_layout);
+  const auto inca = static_cast<cblas_int_t>(cuda::std::max(a.Stride(TensorTypeA::Rank() - 1), index_t{1}));
+  const auto incb = static_cast<cblas_int_t>(cuda::std::max(b.Stride(TensorTypeB::Rank() - 1), index_t{1}));
+  T salpha{alpha};
+  T sbeta{beta};
+
+  index_t batches = 1;
+  for (int r = 0; r < static_cast<int>(BATCH_RANK); r++) {
+    batches *= c.Size(r);
+  }
+
+  HostBlasParallelFor(exec.GetNumThreads(), batches, [&](index_t i0, index_t i1) {
+    for (index_t f = i0; f < i1; f++) {
+      const auto idx = Level2BatchIndex<BATCH_RANK>(c, f);
+      const auto ap = Level2BatchPointer(a, idx);
+      const auto bp = Level2BatchPointer(b, idx);
+      const auto cp = Level2BatchPointer(c, idx);
+
+      if (beta != 1) {
+        for (index_t i = 0; i < m; i++) {
+          for (index_t j = 0; j < n; j++) {
+            T &v = cp[i * cs0 + j * cs1];
+            v = (beta == 0) ? T{0} : v * sbeta;
+          }
+        }
+      }
+
+      if constexpr (std::is_same_v<T, float>) {
+        cblas_sger(layout, static_cast<cblas_int_t>(m), static_cast<cblas_int_t>(n), salpha,
+                   ap, inca, bp, incb, cp, ldc);
+      } else if constexpr (std::is_same_v<T, double>) {
+        cblas_dger(layout, static_cast<cblas_int_t>(m), static_cast<cblas_int_t>(n), salpha,
+                   ap, inca, bp, incb, cp, ldc);
+      } else if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
+        cblas_cgeru(layout, static_cast<cblas_int_t>(m), static_cast<cblas_int_t>(n), (void *)&salpha,
+                    (const void *)ap, inca, (const void *)bp, incb, (void *)cp, ldc);
+      } else if constexpr (std::is_same_v<T, cuda::std::complex<double>>) {
+        cblas_zgeru(layout, static_cast<cblas_int_t>(m), static_cast<cblas_int_t>(n), (void *)&salpha,
+                    (const void *)ap, inca, (const void *)bp, incb, (void *)cp, ldc);
+      }
+    }
+  });
+
+  if (!c.isSameView(C)) {
+    (C = c).run(exec);
+  }
+#endif
+}
+
+} // end namespace detail
+
+}; // end namespace matx
@@ -0,0 +1,223 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <cusparse.h>
+
+#include "matx/core/sparse_tensor.h"
+#include "matx/core/tensor.h"
+#include "matx/transforms/convert/dense2sparse_cusparse.h"
+
+namespace matx {
+
+namespace detail {
+
+/**
+ * A cuSPARSE SpGEMM for C = alpha * A * B with A, B and C in CSR format.
+ *
+ * Unlike SpMM, the handle is not cached: the sparsity pattern of C, and with
+ * it the size of the work buffers and of the output storage, depends on the
+ * contents of A and B rather than just on their buffers. Each execution runs
+ * the work estimation (symbolic) and compute (numeric) phases, sizes the crd
+ * and value storage of C from the resulting nnz, and copies the result out.
+ */
+template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB>
+class SpGEMMCUSPARSEHandle_t {
+public:
+  using TC = typename TensorTypeC::val_type;
+  using POS = typename TensorTypeC::pos_type;
+  using CRD = typename TensorTypeC::crd_type;
+
+  SpGEMMCUSPARSEHandle_t(TensorTypeC &c, const TensorTypeA &a,
+                         const TensorTypeB &b, cudaStream_t stream,
+                         float alpha)
+      : stream_(stream) {
+    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+
+    if constexpr (is_complex_v<TC>) {
+      salpha_ = {alpha, 0};
+      sbeta_ = {0, 0};
+    } else {
+      salpha_ = alpha;
+      sbeta_ = 0;
+    }
+
+    [[maybe_unused]] cusparseStatus_t ret = cusparseCreate(&handle_);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    ret = cusparseSetStream(handle_, stream_);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+
+    const cusparseIndexType_t pt = MatXTypeToCuSparseIndexType<POS>();
+    const cusparseIndexType_t ct = MatXTypeToCuSparseIndexType<CRD>();
+    const cusparseIndexBase_t zb = CUSPARSE_INDEX_BASE_ZERO;
+    const cudaDataType dt = MatXTypeToCudaType<TC>();
+    ret = cusparseCreateCsr(&matA_, a.Size(0), a.Size(1), a.Nse(),
+                            a.POSData(1), a.CRDData(1), a.Data(), pt, ct, zb,
+                            dt);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    ret = cusparseCreateCsr(&matB_, b.Size(0), b.Size(1), b.Nse(),
+                            b.POSData(1), b.CRDData(1), b.Data(), pt, ct, zb,
+                            dt);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    ret = cusparseCreateCsr(&matC_, c.Size(0), c.Size(1), 0, c.POSData(1),
+                            nullptr, nullptr, pt, ct, zb, dt);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    ret = cusparseSpGEMM_createDescr(&desc_);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+  }
+
+  ~SpGEMMCUSPARSEHandle_t() {
+    if (workspace1_) {
+      matxFree(workspace1_, stream_);
+    }
+    if (workspace2_) {
+      matxFree(workspace2_, stream_);
+    }
+    cusparseSpGEMM_destroyDescr(desc_);
+    cusparseDestroySpMat(matA_);
+    cusparseDestroySpMat(matB_);
+    cusparseDestroySpMat(matC_);
+    cusparseDestroy(handle_);
+  }
+
+  __MATX_INLINE__ void Exec(TensorTypeC &c) {
+    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL);
+    const cusparseOperation_t op = CUSPARSE_OPERATION_NON_TRANSPOSE;
+    const cusparseSpGEMMAlg_t algo = CUSPARSE_SPGEMM_DEFAULT;
+    const cudaDataType comptp = MatXTypeToCudaType<TC>();
+
+    // Symbolic phase, querying the workspace size first.
+    size_t size1 = 0;
+    [[maybe_unused]] cusparseStatus_t ret = cusparseSpGEMM_workEstimation(
+        handle_, op, op, &salpha_, matA_, matB_, &sbeta_, matC_, comptp, algo,
+        desc_, &size1, nullptr);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    if (size1) {
+      matxAlloc(&workspace1_, size1, MATX_ASYNC_DEVICE_MEMORY, stream_);
+    }
+    ret = cusparseSpGEMM_workEstimation(handle_, op, op, &salpha_, matA_,
+                                        matB_, &sbeta_, matC_, comptp, algo,
+                                        desc_, &size1, workspace1_);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+
+    // Numeric phase, querying the workspace size first.
+    size_t size2 = 0;
+    ret = cusparseSpGEMM_compute(handle_, op, op, &salpha_, matA_, matB_,
+                                 &sbeta_, matC_, comptp, algo, desc_, &size2,
+                                 nullptr);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    if (size2) {
+      matxAlloc(&workspace2_, size2, MATX_ASYNC_DEVICE_MEMORY, stream_);
+    }
+    ret = cusparseSpGEMM_compute(handle_, op, op, &salpha_, matA_, matB_,
+                                 &sbeta_, matC_, comptp, algo, desc_, &size2,
+                                 workspace2_);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+
+    // Pre-allocate sparse tensor output from the computed nnz.
+    [[maybe_unused]] int64_t num_rows_tmp, num_cols_tmp, nnz;
+    ret = cusparseSpMatGetSize(matC_, &num_rows_tmp, &num_cols_tmp, &nnz);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+    const matxMemorySpace_t space = GetPointerKind(c.POSData(1));
+    c.SetVal(makeDefaultNonOwningStorage<TC>(nnz, space, stream_));
+    c.SetCrd(1, makeDefaultNonOwningStorage<CRD>(nnz, space, stream_));
+    c.SetSparseDataImpl();
+    ret = cusparseCsrSetPointers(matC_, c.POSData(1), c.CRDData(1), c.Data());
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+
+    ret = cusparseSpGEMM_copy(handle_, op, op, &salpha_, matA_, matB_,
+                              &sbeta_, matC_, comptp, algo, desc_);
+    MATX_ASSERT(ret == CUSPARSE_STATUS_SUCCESS, matxMatMulError);
+  }
+
+private:
+  cusparseHandle_t handle_ = nullptr;
+  cusparseSpMatDescr_t matA_ = nullptr;
+  cusparseSpMatDescr_t matB_ = nullptr;
+  cusparseSpMatDescr_t matC_ = nullptr;
+  cusparseSpGEMMDescr_t desc_ = nullptr;
+  void *workspace1_ = nullptr;
+  void *workspace2_ = nullptr;
+  cudaStream_t stream_;
+  TC salpha_;
+  TC sbeta_;
+};
+
+} // end namespace detail
+
+/**
+ * Sparse matrix times sparse matrix: C = alpha * A * B, with A, B and C all
+ * in CSR format.
+ */
+template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB>
+void sparse_spgemm_impl(TensorTypeC &c, const TensorTypeA &a,
+                        const TensorTypeB &b, const cudaExecutor &exec,
+                        float alpha = 1.0, [[maybe_unused]] float beta = 0.0) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+  const auto stream = exec.getStream();
+
+  using TA = typename TensorTypeA::val_type;
+  using TB = typename TensorTypeB::val_type;
+  using TC = typename TensorTypeC::val_type;
+
+  // Restrictions.
+  static_assert(TensorTypeA::Format::isCSR() && TensorTypeB::Format::isCSR() &&
+                    TensorTypeC::Format::isCSR(),
+                "SpGEMM currently only supports CSR x CSR -> CSR");
+  static_assert(std::is_same_v<TC, TA> && std::is_same_v<TC, TB>,
+                "tensors must have the same data type");
+  static_assert(std::is_same_v<typename TensorTypeC::pos_type,
+                               typename TensorTypeA::pos_type> &&
+                    std::is_same_v<typename TensorTypeC::pos_type,
+                                   typename TensorTypeB::pos_type> &&
+                    std::is_same_v<typename TensorTypeC::crd_type,
+                                   typename TensorTypeA::crd_type> &&
+                    std::is_same_v<typename TensorTypeC::crd_type,
+                                   typename TensorTypeB::crd_type>,
+                "tensors must have the same index types");
+  static_assert(std::is_same_v<TC, float> || std::is_same_v<TC, double> ||
+                    std::is_same_v<TC, cuda::std::complex<float>> ||
+                    std::is_same_v<TC, cuda::std::complex<double>>,
+                "unsupported data type");
+  MATX_ASSERT(a.Size(1) == b.Size(0) && c.Size(0) == a.Size(0) &&
+                  c.Size(1) == b.Size(1),
+              matxInvalidSize);
+  MATX_ASSERT_STR(beta == 0.0f, matxNotSupported,
+                  "SpGEMM does not support accumulating into C (beta != 0)");
+
+  detail::SpGEMMCUSPARSEHandle_t<TensorTypeC, TensorTypeA, TensorTypeB> handle(
+      c, a, b, stream, alpha);
+  handle.Exec(c);
+}
+
+} // end namespace matx
@@ -0,0 +1,218 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "matx/core/sparse_tensor.h"
+#include "matx/core/tensor.h"
+#include "matx/executors/host.h"
+#include "matx/transforms/convert/dense2sparse_host.h"
+#include "matx/transforms/matmul/matmul_sparse_host.h"
+
+namespace matx {
+
+namespace detail {
+
+/**
+ * Row splits for a host SpGEMM. The work of row i of C = A * B is the number
+ * of partial products it forms, i.e. the sum of the lengths of the rows of B
+ * selected by the nonzeros in row i of A. Rows are split so that each block
+ * forms roughly the same number of products.
+ */
+template <typename POSA, typename CRDA, typename POSB>
+__MATX_INLINE__ std::vector<index_t>
+SpGEMMHostSplits(const POSA *apos, const CRDA *acrd, const POSB *bpos,
+                 index_t m, index_t blocks, int num_threads) {
+  std::vector<index_t> work(m + 1, 0);
+  HostParallelForBlocked(num_threads, m, [&](index_t i0, index_t i1) {
+    for (index_t i = i0; i < i1; i++) {
+      index_t w = 0;
+      for (POSA e = apos[i]; e < apos[i + 1]; e++) {
+        const index_t kk = static_cast<index_t>(acrd[e]);
+        w += static_cast<index_t>(bpos[kk + 1] - bpos[kk]);
+      }
+      work[i] = w;
+    }
+  });
+  HostParallelExclusiveScan(num_threads, work.data(), m + 1);
+  return SparseHostBalancedSplits(work.data(), m, blocks);
+}
+
+/**
+ * Symbolic phase of a Gustavson SpGEMM: count the distinct columns of each
+ * row of C = A * B into cpos[0, m). Each block keeps a dense marker over the
+ * n columns of C, tagged with the last row that touched a column, so the
+ * marker never has to be cleared between rows.
+ */
+template <typename POS, typename CRD>
+__MATX_INLINE__ void
+SpGEMMHostSymbolic(const POS *apos, const CRD *acrd, const POS *bpos,
+                   const CRD *bcrd, POS *cpos, index_t n,
+                   const std::vector<index_t> &splits, int num_threads) {
+  const index_t blocks = static_cast<index_t>(splits.size()) - 1;
+  HostParallelForBlocked(num_threads, blocks, [&](index_t b0, index_t b1) {
+    std::vector<index_t> mark(n, -1);
+    for (index_t i = splits[b0]; i < splits[b1]; i++) {
+      POS cnt = 0;
+      for (POS e = apos[i]; e < apos[i + 1]; e++) {
+        const index_t kk = static_cast<index_t>(acrd[e]);
+        for (POS f = bpos[kk]; f < bpos[kk + 1]; f++) {
+          const index_t j = static_cast<index_t>(bcrd[f]);
+          if (mark[j] != i) {
+            mark[j] = i;
+            cnt++;
+          }
+        }
+      }
+      cpos[i] = cnt;
+    }
+  });
+}
+
+/**
+ * Numeric phase of a Gustavson SpGEMM. Row i of C is accumulated into a dense
+ * per-block accumulator while its column indices are appended directly into
+ * the final crd storage at cpos[i], which the symbolic phase sized exactly.
+ * The columns of each row are then sorted and the values gathered in order.
+ */
+template <typename TCOMP, typename POS, typename CRD, typename TA,
+          typename TB, typename TC>
+__MATX_INLINE__ void
+SpGEMMHostNumeric(const POS *apos, const CRD *acrd, const TA *avals,
+                  const POS *bpos, const CRD *bcrd, const TB *bvals,
+                  const POS *cpos, CRD *ccrd, TC *cvals, index_t n,
+                  TCOMP alpha, const std::vector<index_t> &splits,
+                  int num_threads) {
+  const index_t blocks = static_cast<index_t>(splits.size()) - 1;
+  HostParallelForBlocked(num_threads, blocks, [&](index_t b0, index_t b1) {
+    std::vector<index_t> mark(n, -1);
+    std::vector<TCOMP> acc(n);
+    for (index_t i = splits[b0]; i < splits[b1]; i++) {
+      const POS begin = cpos[i];
+      POS end = begin;
+      for (POS e = apos[i]; e < apos[i + 1]; e++) {
+        const index_t kk = static_cast<index_t>(acrd[e]);
+        const TCOMP av = static_cast<TCOMP>(avals[e]);
+        for (POS f = bpos[kk]; f < bpos[kk + 1]; f++) {
+          const index_t j = static_cast<index_t>(bcrd[f]);
+          const TCOMP prod = av * static_cast<TCOMP>(bvals[f]);
+          if (mark[j] != i) {
+            mark[j] = i;
+            acc[j] = prod;
+            ccrd[end++] = static_cast<CRD>(j);
+          } else {
+            acc[j] += prod;
+          }
+        }
+      }
+      std::sort(ccrd + begin, ccrd + end);
+      for (POS p = begin; p < end; p++) {
+        cvals[p] = static_cast<TC>(alpha * acc[static_cast<index_t>(ccrd[p])]);
+      }
+    }
+  });
+}
+
+} // end namespace detail
+
+/**
+ * Sparse matrix times sparse matrix on the host: C = alpha * A * B, with A, B
+ * and C all in CSR format. A symbolic phase sizes every row of C, the crd and
+ * value storage of C is allocated once (or reused when large enough), and a
+ * numeric phase then fills the rows in parallel without further allocation.
+ */
+template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB,
+          ThreadsMode MODE>
+void sparse_spgemm_impl(TensorTypeC &c, const TensorTypeA &a,
+                        const TensorTypeB &b, const HostExecutor<MODE> &exec,
+                        float alpha = 1.0, [[maybe_unused]] float beta = 0.0) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+
+  using TA = typename TensorTypeA::val_type;
+  using TB = typename TensorTypeB::val_type;
+  using TC = typename TensorTypeC::val_type;
+  using POS = typename TensorTypeC::pos_type;
+  using CRD = typename TensorTypeC::crd_type;
+  using TCOMP = promote_half_t<TC>;
+
+  // Restrictions.
+  static_assert(TensorTypeA::Format::isCSR() && TensorTypeB::Format::isCSR() &&
+                    TensorTypeC::Format::isCSR(),
+                "SpGEMM currently only supports CSR x CSR -> CSR");
+  static_assert(std::is_same_v<TC, TA> && std::is_same_v<TC, TB>,
+                "tensors must have the same data type");
+  static_assert(std::is_same_v<POS, typename TensorTypeA::pos_type> &&
+                    std::is_same_v<POS, typename TensorTypeB::pos_type> &&
+                    std::is_same_v<CRD, typename TensorTypeA::crd_type> &&
+                    std::is_same_v<CRD, typename TensorTypeB::crd_type>,
+                "tensors must have the same index types");
+  MATX_ASSERT(a.Size(1) == b.Size(0) && c.Size(0) == a.Size(0) &&
+                  c.Size(1) == b.Size(1),
+              matxInvalidSize);
+  MATX_ASSERT_STR(beta == 0.0f, matxNotSupported,
+                  "SpGEMM does not support accumulating into C (beta != 0)");
+
+  const int threads = exec.GetNumThreads();
+  const index_t m = a.Size(0);
+  const index_t n = b.Size(1);
+  const POS *apos = a.POSData(1);
+  const CRD *acrd = a.CRDData(1);
+  const POS *bpos = b.POSData(1);
+  const CRD *bcrd = b.CRDData(1);
+
+  detail::checkHostSparseSpace(c.POSData(1));
+  POS *cpos = c.POSData(1);
+
+  const index_t blocks = std::max(index_t{1}, std::min<index_t>(threads, m));
+  const auto splits =
+      detail::SpGEMMHostSplits(apos, acrd, bpos, m, blocks, threads);
+
+  // Symbolic phase: size each row, then scan into row positions.
+  detail::SpGEMMHostSymbolic(apos, acrd, bpos, bcrd, cpos, n, splits, threads);
+  cpos[m] = 0;
+  const index_t nnz = static_cast<index_t>(
+      detail::HostParallelExclusiveScan(threads, cpos, m + 1));
+
+  // Pre-allocate sparse tensor output.
+  const matxMemorySpace_t space = GetPointerKind(cpos);
+  detail::resizeHostSparseOutput(c, nnz, space);
+
+  // Numeric phase.
+  detail::SpGEMMHostNumeric(apos, acrd, a.Data(), bpos, bcrd, b.Data(), cpos,
+                            c.CRDData(1), c.Data(), n,
+                            static_cast<TCOMP>(alpha), splits, threads);
+}
+
+} // end namespace matx
@@ -32,6 +32,8 @@
 
 #pragma once
 
+#include "matx/transforms/matmul/matvec_cblas.h"
+
 namespace matx {
 
 /**
@@ -93,6 +95,11 @@ __MATX_INLINE__ void matvec_impl(TensorTypeC C, const TensorTypeA A,
   if constexpr (is_cuda_executor_v<Executor>) {
     matmul_impl<decltype(c), decltype(A), decltype(b), PROV>(c, A, b, exec, alpha, beta);
   }
+  else if constexpr (detail::CompatibleLevel2CBLASTypes<TensorTypeC, TensorTypeA, TensorTypeB>()) {
+    // A host BLAS has a dedicated matrix-vector routine, which is usually much faster
+    // than a GEMM with a single column
+    detail::matvec_cblas_exec(C, A, B, alpha, beta, exec);
+  }
   else {
     matmul_impl<decltype(c), decltype(A), decltype(b)>(c, A, b, exec, alpha, beta);
   }
@@ -32,6 +32,8 @@
 
 #pragma once
 
+#include "matx/transforms/matmul/matvec_cblas.h"
+
 namespace matx {
 
 /**
@@ -99,6 +101,9 @@ __MATX_INLINE__ void outer_impl(TensorTypeC C, const TensorTypeA A,
 
   if constexpr (is_cuda_executor_v<Executor>) {
     matmul_impl<decltype(C), decltype(act), decltype(bct), PROV>(C, act, bct, exec, alpha, beta);
+  } else if constexpr (detail::CompatibleLevel2CBLASTypes<TensorTypeC, TensorTypeA, TensorTypeB>()) {
+    // Rank-1 update through the host BLAS rather than a GEMM with k = 1
+    detail::outer_cblas_exec(C, A, B, alpha, beta, exec);
   } else {
     matmul_impl<decltype(C), decltype(act), decltype(bct)>(C, act, bct, exec, alpha, beta);
   }
@@ -171,14 +171,19 @@ public:
       (out = a).run(exec);
     }
 
-    lapack_int_t info;
-    for (size_t i = 0; i < this->batch_a_ptrs.size(); i++) {
-      geqrf_dispatch(&params.m, &params.n, reinterpret_cast<T1*>(this->batch_a_ptrs[i]),
-                     &params.m, reinterpret_cast<T1*>(this->batch_tau_ptrs[i]),
-                     reinterpret_cast<T1*>(this->work), &this->lwork, &info);
-
-      MATX_ASSERT_STR_EXP(info, 0, matxSolverError, "LAPACK geqrf error");
-    }
+    const size_t batches = this->batch_a_ptrs.size();
+    this->AllocateWorkspaceSlots(HostLapackBatchSlots(exec.GetNumThreads(), batches));
+
+    const lapack_int_t info = HostLapackBatchFor(exec.GetNumThreads(), batches,
+      [&](size_t i, int slot) {
+        lapack_int_t binfo;
+        geqrf_dispatch(&params.m, &params.n, reinterpret_cast<T1*>(this->batch_a_ptrs[i]),
+                       &params.m, reinterpret_cast<T1*>(this->batch_tau_ptrs[i]),
+                       this->WorkSlot(slot), &this->lwork, &binfo);
+        return binfo;
+      });
+
+    MATX_ASSERT_STR_EXP(info, 0, matxSolverError, "LAPACK geqrf error");
   }
 
   /**
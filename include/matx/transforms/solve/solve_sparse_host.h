@@ -0,0 +1,697 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "matx/core/cache.h"
+#include "matx/core/sparse_tensor.h"
+#include "matx/core/tensor.h"
+#include "matx/executors/host.h"
+#include "matx/transforms/convert/dense2sparse_host.h"
+
+namespace matx {
+
+namespace detail {
+
+/**
+ * Reverse Cuthill-McKee ordering of the symmetrized pattern of a CSR matrix.
+ * Each connected component is ordered by a breadth-first search started from
+ * a pseudo-peripheral node, visiting neighbors by increasing degree, and the
+ * final order is reversed. Returns perm with perm[new] = old.
+ */
+template <typename POS, typename CRD>
+__MATX_INLINE__ std::vector<index_t> SparseHostRCM(const POS *pos,
+                                                   const CRD *crd, index_t n) {
+  // Adjacency of A + A^T without self loops.
+  std::vector<index_t> deg(n + 1, 0);
+  for (index_t i = 0; i < n; i++) {
+    for (POS p = pos[i]; p < pos[i + 1]; p++) {
+      const index_t j = static_cast<index_t>(crd[p]);
+      if (j != i) {
+        deg[i]++;
+        deg[j]++;
+      }
+    }
+  }
+  std::vector<index_t> adjp(n + 1, 0);
+  for (index_t i = 0; i < n; i++) {
+    adjp[i + 1] = adjp[i] + deg[i];
+  }
+  std::vector<index_t> adj(adjp[n]);
+  std::vector<index_t> fill(adjp.begin(), adjp.end() - 1);
+  for (index_t i = 0; i < n; i++) {
+    for (POS p = pos[i]; p < pos[i + 1]; p++) {
+      const index_t j = static_cast<index_t>(crd[p]);
+      if (j != i) {
+        adj[fill[i]++] = j;
+        adj[fill[j]++] = i;
+      }
+    }
+  }
+  // Drop duplicate edges so degrees reflect the graph.
+  for (index_t i = 0; i < n; i++) {
+    auto b = adj.begin() + adjp[i];
+    auto e = adj.begin() + adjp[i + 1];
+    std::sort(b, e);
+    deg[i] = static_cast<index_t>(std::unique(b, e) - b);
+  }
+
+  std::vector<index_t> perm;
+  perm.reserve(n);
+  std::vector<char> seen(n, 0);
+
+  // Breadth-first search from root over the unplaced nodes, appending them to
+  // perm from position first. Returns where the deepest level starts in perm
+  // and the number of levels. With order set, the children of each node are
+  // visited by increasing degree, as Cuthill-McKee requires.
+  const auto bfs = [&](index_t root, index_t first, bool order) {
+    perm.resize(first);
+    perm.push_back(root);
+    seen[root] = 1;
+    index_t level_start = first;
+    index_t levels = 0;
+    while (level_start < static_cast<index_t>(perm.size())) {
+      const index_t level_end = static_cast<index_t>(perm.size());
+      for (index_t h = level_start; h < level_end; h++) {
+        const index_t v = perm[h];
+        const index_t child_start = static_cast<index_t>(perm.size());
+        for (index_t p = adjp[v]; p < adjp[v] + deg[v]; p++) {
+          const index_t w = adj[p];
+          if (!seen[w]) {
+            seen[w] = 1;
+            perm.push_back(w);
+          }
+        }
+        if (order) {
+          std::sort(perm.begin() + child_start, perm.end(),
+                    [&](index_t x, index_t y) { return deg[x] < deg[y]; });
+        }
+      }
+      levels++;
+      if (level_end == static_cast<index_t>(perm.size())) {
+        break;
+      }
+      level_start = level_end;
+    }
+    return std::make_pair(level_start, levels);
+  };
+  const auto unsee = [&](index_t first) {
+    for (index_t h = first; h < static_cast<index_t>(perm.size()); h++) {
+      seen[perm[h]] = 0;
+    }
+  };
+
+  for (index_t s = 0; s < n; s++) {
+    if (seen[s]) {
+      continue;
+    }
+    // Pseudo-peripheral root: move to a minimum-degree node of the deepest
+    // level for as long as the number of levels keeps growing.
+    const index_t first = static_cast<index_t>(perm.size());
+    index_t root = s;
+    auto [deepest, levels] = bfs(root, first, false);
+    for (int it = 0; it < 8; it++) {
+      index_t cand = perm[deepest];
+      for (index_t h = deepest; h < static_cast<index_t>(perm.size()); h++) {
+        if (deg[perm[h]] < deg[cand]) {
+          cand = perm[h];
+        }
+      }
+      unsee(first);
+      const auto [cdeepest, clevels] = bfs(cand, first, false);
+      if (clevels <= levels) {
+        break;
+      }
+      root = cand;
+      deepest = cdeepest;
+      levels = clevels;
+    }
+    unsee(first);
+    bfs(root, first, true);
+  }
+
+  std::reverse(perm.begin(), perm.end());
+  return perm;
+}
+
+/**
+ * Rows of a triangular matrix grouped into levels: all rows of a level only
+ * depend on rows of earlier levels, so each level can be solved in parallel.
+ * The rows of level l are rows[ptr[l], ptr[l + 1]).
+ */
+struct SparseHostLevels {
+  std::vector<index_t> ptr;
+  std::vector<index_t> rows;
+};
+
+/**
+ * Sparse LU factorization on the host for solving A x = b with a square CSR
+ * matrix A.
+ *
+ * The matrix is first symmetrically permuted with a reverse Cuthill-McKee
+ * ordering, Ap = A(q, q), which confines fill to the envelope of the matrix.
+ * Ap is then factored column by column with the left-looking Gilbert-Peierls
+ * algorithm, P Ap = L U, where each column is a sparse triangular solve whose
+ * nonzero pattern is found by a depth-first search over L. Partial pivoting
+ * uses a threshold that prefers the diagonal so that the ordering is kept
+ * unless the diagonal is too small.
+ *
+ * For the solves, the strictly triangular parts of L and U are stored by row
+ * together with their level schedules.
+ */
+template <typename T> class SparseHostLU {
+public:
+  template <typename POS, typename CRD>
+  void Analyze(const POS *pos, const CRD *crd, index_t n) {
+    n_ = n;
+    q_ = SparseHostRCM(pos, crd, n);
+    qinv_.assign(n, 0);
+    for (index_t i = 0; i < n; i++) {
+      qinv_[q_[i]] = i;
+    }
+  }
+
+  template <typename POS, typename CRD>
+  void Factor(const POS *pos, const CRD *crd, const T *vals) {
+    const index_t n = n_;
+
+    // Ap = A(q, q) in CSC.
+    std::vector<index_t> ap(n + 1, 0);
+    for (index_t i = 0; i < n; i++) {
+      for (POS p = pos[i]; p < pos[i + 1]; p++) {
+        ap[qinv_[static_cast<index_t>(crd[p])] + 1]++;
+      }
+    }
+    for (index_t j = 0; j < n; j++) {
+      ap[j + 1] += ap[j];
+    }
+    std::vector<index_t> ai(ap[n]);
+    std::vector<T> ax(ap[n]);
+    std::vector<index_t> next(ap.begin(), ap.end() - 1);
+    for (index_t i = 0; i < n; i++) {
+      for (POS p = pos[i]; p < pos[i + 1]; p++) {
+        const index_t e = next[qinv_[static_cast<index_t>(crd[p])]]++;
+        ai[e] = qinv_[i];
+        ax[e] = vals[p];
+      }
+    }
+
+    // Left-looking factorization. L holds the pivot row first in each column
+    // with a unit value, U holds the pivot last. Row indices of L refer to
+    // rows of Ap until the end, when they are renumbered by pivot order.
+    std::vector<index_t> lp{0}, li, up{0}, ui;
+    std::vector<T> lx, ux;
+    li.reserve(2 * ap[n] + n);
+    lx.reserve(2 * ap[n] + n);
+    ui.reserve(2 * ap[n] + n);
+    ux.reserve(2 * ap[n] + n);
+    pinv_.assign(n, -1);
+    std::vector<T> x(n, T(0));
+    std::vector<index_t> xi(n), stack(n), pstack(n), mark(n, -1);
+    constexpr double tol = 0.1;
+
+    for (index_t k = 0; k < n; k++) {
+      // Nonzero pattern of column k of L \ Ap(:, k) in topological order, in
+      // xi[top, n).
+      index_t top = n;
+      for (index_t p = ap[k]; p < ap[k + 1]; p++) {
+        if (mark[ai[p]] == k) {
+          continue;
+        }
+        index_t head = 0;
+        stack[0] = ai[p];
+        while (head >= 0) {
+          const index_t j = stack[head];
+          const index_t jnew = pinv_[j];
+          if (mark[j] != k) {
+            mark[j] = k;
+            pstack[head] = jnew < 0 ? 0 : lp[jnew];
+          }
+          bool done = true;
+          const index_t pend = jnew < 0 ? 0 : lp[jnew + 1];
+          for (index_t pp = pstack[head]; pp < pend; pp++) {
+            const index_t i = li[pp];
+            if (mark[i] == k) {
+              continue;
+            }
+            pstack[head] = pp;
+            stack[++head] = i;
+            done = false;
+            break;
+          }
+          if (done) {
+            head--;
+            xi[--top] = j;
+          }
+        }
+      }
+
+      // Numeric sparse triangular solve.
+      for (index_t p = ap[k]; p < ap[k + 1]; p++) {
+        x[ai[p]] += ax[p];
+      }
+      for (index_t px = top; px < n; px++) {
+        const index_t j = xi[px];
+        const index_t jnew = pinv_[j];
+        if (jnew < 0) {
+          continue;
+        }
+        const T xj = x[j];
+        for (index_t pp = lp[jnew] + 1; pp < lp[jnew + 1]; pp++) {
+          x[li[pp]] -= lx[pp] * xj;
+        }
+      }
+
+      // Split into U and the pivot candidates.
+      index_t ipiv = -1;
+      double amax = -1;
+      for (index_t px = top; px < n; px++) {
+        const index_t i = xi[px];
+        if (pinv_[i] < 0) {
+          const double t = Magnitude(x[i]);
+          if (t > amax) {
+            amax = t;
+            ipiv = i;
+          }
+        } else {
+          ui.push_back(pinv_[i]);
+          ux.push_back(x[i]);
+        }
+      }
+      if (ipiv < 0 || amax <= 0) {
+        MATX_THROW(matxSolverError, "Sparse matrix is singular");
+      }
+      if (pinv_[k] < 0 && mark[k] == k && Magnitude(x[k]) >= amax * tol) {
+        ipiv = k;
+      }
+
+      const T pivot = x[ipiv];
+      ui.push_back(k);
+      ux.push_back(pivot);
+      up.push_back(static_cast<index_t>(ui.size()));
+      pinv_[ipiv] = k;
+      li.push_back(ipiv);
+      lx.push_back(T(1));
+      for (index_t px = top; px < n; px++) {
+        const index_t i = xi[px];
+        if (pinv_[i] < 0) {
+          li.push_back(i);
+          lx.push_back(x[i] / pivot);
+        }
+        x[i] = T(0);
+      }
+      lp.push_back(static_cast<index_t>(li.size()));
+    }
+    for (auto &i : li) {
+      i = pinv_[i];
+    }
+
+    // Strict lower L by row (the unit diagonal is implicit).
+    Transpose(lp, li, lx, /*skip_first=*/true, /*skip_last=*/false, lrp_, lci_,
+              lv_);
+    // Strict upper U by row, with the diagonal kept apart.
+    udiag_.resize(n);
+    for (index_t k = 0; k < n; k++) {
+      udiag_[k] = ux[up[k + 1] - 1];
+    }
+    Transpose(up, ui, ux, /*skip_first=*/false, /*skip_last=*/true, urp_, uci_,
+              uv_);
+
+    // Level schedules for the forward and backward solves.
+    std::vector<index_t> lev(n, 0);
+    for (index_t i = 0; i < n; i++) {
+      for (index_t p = lrp_[i]; p < lrp_[i + 1]; p++) {
+        lev[i] = std::max(lev[i], lev[lci_[p]] + 1);
+      }
+    }
+    BuildLevels(lev, llev_);
+    std::fill(lev.begin(), lev.end(), 0);
+    for (index_t i = n - 1; i >= 0; i--) {
+      for (index_t p = urp_[i]; p < urp_[i + 1]; p++) {
+        lev[i] = std::max(lev[i], lev[uci_[p]] + 1);
+      }
+    }
+    BuildLevels(lev, ulev_);
+  }
+
+  /**
+   * Solve A X^T = B^T, where row r of B (and of X) holds one right-hand side
+   * (solution). B and X are addressed as B[r * ldb_r + i * ldb_c].
+   */
+  template <typename TB, typename TC>
+  void Solve(const TB *b, index_t ldb_r, index_t ldb_c, TC *c, index_t ldc_r,
+             index_t ldc_c, index_t nrhs, int num_threads) const {
+    const index_t n = n_;
+    // All right-hand sides of an unknown are kept together, so every row
+    // update is a short unit-stride loop over the right-hand sides.
+    std::vector<T> w(n * nrhs);
+    HostParallelForBlocked(num_threads, n, [&](index_t i0, index_t i1) {
+      for (index_t i = i0; i < i1; i++) {
+        T *wi = &w[pinv_[i] * nrhs];
+        const index_t src = q_[i] * ldb_c;
+        for (index_t r = 0; r < nrhs; r++) {
+          wi[r] = static_cast<T>(b[r * ldb_r + src]);
+        }
+      }
+    });
+
+    RunLevels(llev_, nrhs, num_threads, [&](index_t i) {
+      T *wi = &w[i * nrhs];
+      for (index_t p = lrp_[i]; p < lrp_[i + 1]; p++) {
+        const T v = lv_[p];
+        const T *wj = &w[lci_[p] * nrhs];
+        for (index_t r = 0; r < nrhs; r++) {
+          wi[r] -= v * wj[r];
+        }
+      }
+    });
+
+    RunLevels(ulev_, nrhs, num_threads, [&](index_t i) {
+      T *wi = &w[i * nrhs];
+      for (index_t p = urp_[i]; p < urp_[i + 1]; p++) {
+        const T v = uv_[p];
+        const T *wj = &w[uci_[p] * nrhs];
+        for (index_t r = 0; r < nrhs; r++) {
+          wi[r] -= v * wj[r];
+        }
+      }
+      const T d = udiag_[i];
+      for (index_t r = 0; r < nrhs; r++) {
+        wi[r] /= d;
+      }
+    });
+
+    HostParallelForBlocked(num_threads, n, [&](index_t j0, index_t j1) {
+      for (index_t j = j0; j < j1; j++) {
+        const T *wj = &w[j * nrhs];
+        const index_t dst = q_[j] * ldc_c;
+        for (index_t r = 0; r < nrhs; r++) {
+          c[r * ldc_r + dst] = static_cast<TC>(wj[r]);
+        }
+      }
+    });
+  }
+
+private:
+  static double Magnitude(const T &v) {
+    if constexpr (is_complex_v<T>) {
+      return static_cast<double>(cuda::std::abs(v));
+    } else {
+      return std::abs(static_cast<double>(v));
+    }
+  }
+
+  // Compressed columns to compressed rows, optionally dropping the first or
+  // last entry of every column (the diagonals of L and U).
+  void Transpose(const std::vector<index_t> &cp, const std::vector<index_t> &ci,
+                 const std::vector<T> &cx, bool skip_first, bool skip_last,
+                 std::vector<index_t> &rp, std::vector<index_t> &rc,
+                 std::vector<T> &rv) const {
+    const index_t n = n_;
+    rp.assign(n + 1, 0);
+    for (index_t j = 0; j < n; j++) {
+      for (index_t p = cp[j] + skip_first; p < cp[j + 1] - skip_last; p++) {
+        rp[ci[p] + 1]++;
+      }
+    }
+    for (index_t i = 0; i < n; i++) {
+      rp[i + 1] += rp[i];
+    }
+    rc.resize(rp[n]);
+    rv.resize(rp[n]);
+    std::vector<index_t> next(rp.begin(), rp.end() - 1);
+    for (index_t j = 0; j < n; j++) {
+      for (index_t p = cp[j] + skip_first; p < cp[j + 1] - skip_last; p++) {
+        const index_t e = next[ci[p]]++;
+        rc[e] = j;
+        rv[e] = cx[p];
+      }
+    }
+  }
+
+  void BuildLevels(const std::vector<index_t> &lev,
+                   SparseHostLevels &levels) const {
+    const index_t n = n_;
+    const index_t nlev =
+        n == 0 ? 0 : *std::max_element(lev.begin(), lev.end()) + 1;
+    levels.ptr.assign(nlev + 1, 0);
+    for (index_t i = 0; i < n; i++) {
+      levels.ptr[lev[i] + 1]++;
+    }
+    for (index_t l = 0; l < nlev; l++) {
+      levels.ptr[l + 1] += levels.ptr[l];
+    }
+    levels.rows.resize(n);
+    std::vector<index_t> next(levels.ptr.begin(), levels.ptr.end() - 1);
+    for (index_t i = 0; i < n; i++) {
+      levels.rows[next[lev[i]]++] = i;
+    }
+  }
+
+  // Run func on every row, level by level. Levels with too little work to
+  // amortize a parallel region run on the calling thread.
+  template <typename Func>
+  static void RunLevels(const SparseHostLevels &levels, index_t nrhs,
+                        int num_threads, Func &&func) {
+    constexpr index_t grain = 1024;
+    const index_t nlev = static_cast<index_t>(levels.ptr.size()) - 1;
+    for (index_t l = 0; l < nlev; l++) {
+      const index_t *rows = levels.rows.data() + levels.ptr[l];
+      const index_t width = levels.ptr[l + 1] - levels.ptr[l];
+      if (num_threads > 1 && width * nrhs >= grain) {
+        HostParallelForBlocked(num_threads, width, [&](index_t r0, index_t r1) {
+          for (index_t r = r0; r < r1; r++) {
+            func(rows[r]);
+          }
+        });
+      } else {
+        for (index_t r = 0; r < width; r++) {
+          func(rows[r]);
+        }
+      }
+    }
+  }
+
+  index_t n_ = 0;
+  std::vector<index_t> q_, qinv_, pinv_;
+  std::vector<index_t> lrp_, lci_, urp_, uci_;
+  std::vector<T> lv_, uv_, udiag_;
+  SparseHostLevels llev_, ulev_;
+};
+
+/**
+ * Parameters identifying a cached host sparse factorization. Only the matrix
+ * takes part, so that solves with new right-hand sides reuse the factors.
+ */
+struct SolveHostParams_t {
+  MatXDataType_t dtype;
+  MatXDataType_t ptype;
+  MatXDataType_t ctype;
+  index_t nse;
+  index_t m;
+  void *ptrA0;
+  void *ptrA2;
+  void *ptrA4;
+};
+
+template <typename TensorTypeA> class SolveHostHandle_t {
+public:
+  using VAL = typename TensorTypeA::val_type;
+  using POS = typename TensorTypeA::pos_type;
+  using CRD = typename TensorTypeA::crd_type;
+
+  SolveHostHandle_t(const TensorTypeA &a) {
+    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+    Snapshot(a);
+    lu_.Analyze(pos_.data(), crd_.data(), a.Size(0));
+    lu_.Factor(pos_.data(), crd_.data(), val_.data());
+  }
+
+  static detail::SolveHostParams_t GetSolveParams(const TensorTypeA &a) {
+    detail::SolveHostParams_t params;
+    params.dtype = TypeToInt<VAL>();
+    params.ptype = TypeToInt<POS>();
+    params.ctype = TypeToInt<CRD>();
+    params.nse = a.Nse();
+    params.m = a.Size(0);
+    // Like the cuDSS handles, the factors belong to specific buffers.
+    params.ptrA0 = a.Data();
+    params.ptrA2 = a.POSData(1);
+    params.ptrA4 = a.CRDData(1);
+    return params;
+  }
+
+  template <typename TensorTypeC, typename TensorTypeB>
+  __MATX_INLINE__ void Exec(TensorTypeC &c, const TensorTypeA &a,
+                            const TensorTypeB &b, int num_threads) {
+    MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL);
+    // The buffers may have been rewritten in place since the factorization.
+    // A changed pattern needs a new ordering, changed values only a new
+    // numeric factorization.
+    const index_t m = a.Size(0);
+    const index_t nse = a.Nse();
+    if (std::memcmp(pos_.data(), a.POSData(1), (m + 1) * sizeof(POS)) != 0 ||
+        std::memcmp(crd_.data(), a.CRDData(1), nse * sizeof(CRD)) != 0) {
+      Snapshot(a);
+      lu_.Analyze(pos_.data(), crd_.data(), m);
+      lu_.Factor(pos_.data(), crd_.data(), val_.data());
+    } else if (std::memcmp(val_.data(), a.Data(), nse * sizeof(VAL)) != 0) {
+      std::copy(a.Data(), a.Data() + nse, val_.begin());
+      lu_.Factor(pos_.data(), crd_.data(), val_.data());
+    }
+    lu_.Solve(b.Data(), b.Stride(0), b.Stride(1), c.Data(), c.Stride(0),
+              c.Stride(1), b.Size(0), num_threads);
+  }
+
+private:
+  void Snapshot(const TensorTypeA &a) {
+    const index_t m = a.Size(0);
+    const index_t nse = a.Nse();
+    pos_.assign(a.POSData(1), a.POSData(1) + m + 1);
+    crd_.assign(a.CRDData(1), a.CRDData(1) + nse);
+    val_.assign(a.Data(), a.Data() + nse);
+  }
+
+  std::vector<POS> pos_;
+  std::vector<CRD> crd_;
+  std::vector<VAL> val_;
+  SparseHostLU<VAL> lu_;
+};
+
+/**
+ * Crude hash on a host SOLVE to get a reasonably good delta for collisions.
+ */
+struct SolveHostParamsKeyHash {
+  std::size_t operator()(const SolveHostParams_t &k) const noexcept {
+    return std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrA0)) +
+           std::hash<uint64_t>()(reinterpret_cast<uint64_t>(k.ptrA2)) +
+           std::hash<index_t>()(k.nse);
+  }
+};
+
+/**
+ * Test host SOLVE parameters for equality. Unlike the hash, all parameters
+ * must match exactly to ensure the cached factorization can be reused.
+ */
+struct SolveHostParamsKeyEq {
+  bool operator()(const SolveHostParams_t &l,
+                  const SolveHostParams_t &t) const noexcept {
+    return l.dtype == t.dtype && l.ptype == t.ptype && l.ctype == t.ctype &&
+           l.nse == t.nse && l.m == t.m && l.ptrA0 == t.ptrA0 &&
+           l.ptrA2 == t.ptrA2 && l.ptrA4 == t.ptrA4;
+  }
+};
+
+using solve_host_cache_t =
+    std::unordered_map<SolveHostParams_t, std::any, SolveHostParamsKeyHash,
+                       SolveHostParamsKeyEq>;
+
+template <typename Op>
+__MATX_INLINE__ auto getSolveHostSupportedTensor(const Op &in) {
+  // The solver gathers B and scatters X with arbitrary strides
+  const auto func = [&]() { return true; };
+  return GetSupportedTensor(in, func, MATX_HOST_MALLOC_MEMORY);
+}
+
+} // end namespace detail
+
+/**
+ * Sparse direct solver on the host for a square matrix A in CSR format. The
+ * factorization is cached per matrix, so repeated solves with new right-hand
+ * sides only run the triangular solves. The factors are recomputed when the
+ * values (or pattern) of A change in place.
+ */
+template <typename TensorTypeC, typename TensorTypeA, typename TensorTypeB,
+          ThreadsMode MODE>
+void sparse_solve_impl(TensorTypeC &C, const TensorTypeA &a,
+                       const TensorTypeB &B, const HostExecutor<MODE> &exec) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_API)
+
+  // Transform into supported form.
+  auto b = detail::getSolveHostSupportedTensor(B);
+  auto c = detail::getSolveHostSupportedTensor(C);
+  if (!is_matx_transform_op<TensorTypeB>() && !b.isSameView(B)) {
+    (b = B).run(exec);
+  }
+
+  using atype = TensorTypeA;
+  using btype = decltype(b);
+  using ctype = decltype(c);
+
+  using TA = typename atype::value_type;
+  using TB = typename btype::value_type;
+  using TC = typename ctype::value_type;
+
+  static constexpr int RANKA = atype::Rank();
+  static constexpr int RANKB = btype::Rank();
+  static constexpr int RANKC = ctype::Rank();
+
+  // Restrictions.
+  static_assert(atype::Format::isCSR(),
+                "Host sparse direct solver currently only supports CSR");
+  static_assert(RANKA == 2 && RANKB == 2 && RANKC == 2,
+                "tensors must have rank-2");
+  static_assert(std::is_same_v<TC, TA> && std::is_same_v<TC, TB>,
+                "tensors must have the same data type");
+  static_assert(std::is_same_v<TC, float> || std::is_same_v<TC, double> ||
+                    std::is_same_v<TC, cuda::std::complex<float>> ||
+                    std::is_same_v<TC, cuda::std::complex<double>>,
+                "unsupported data type");
+  MATX_ASSERT(                                  // Note: B,C transposed!
+      a.Size(RANKA - 1) == a.Size(RANKA - 2) && // square
+          a.Size(RANKA - 1) == b.Size(RANKB - 1) &&
+          a.Size(RANKA - 2) == c.Size(RANKC - 1) &&
+          b.Size(RANKB - 2) == c.Size(RANKC - 2),
+      matxInvalidSize);
+  detail::checkHostSparseSpace(a.POSData(1));
+
+  // Lookup and cache.
+  auto params = detail::SolveHostHandle_t<atype>::GetSolveParams(a);
+  using cache_val_type = detail::SolveHostHandle_t<atype>;
+  detail::GetCache().LookupAndExec<detail::solve_host_cache_t>(
+      detail::GetCacheIdFromType<detail::solve_host_cache_t>(), params,
+      [&]() { return std::make_shared<cache_val_type>(a); },
+      [&](std::shared_ptr<cache_val_type> cache_type) {
+        cache_type->Exec(c, a, b, exec.GetNumThreads());
+      });
+
+  // Copy transformed output back.
+  if (!c.isSameView(C)) {
+    (C = c).run(exec);
+  }
+}
+
+} // end namespace matx
@@ -32,6 +32,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
+#include "matx/executors/host.h"
+
 namespace matx {
 
 #ifdef MATX_EN_NVPL
@@ -51,6 +56,7 @@ namespace matx {
   #define lapack_complex_float cuda::std::complex<float>
   #define lapack_complex_double cuda::std::complex<double>
   #include <lapack.h>
+  #include <cblas.h> // openblas_set_num_threads
   using lapack_int_t = lapack_int;
   #define LAPACK_CALL(fn) LAPACK_##fn
 #else
@@ -320,31 +326,62 @@ public:
 
   virtual ~matxDnHostSolver_t()
   {
-    matxFree(work);
-    matxFree(rwork);
-    matxFree(iwork);
+    FreeWorkspace();
   }
 
   void AllocateWorkspace([[maybe_unused]] size_t batches)
   {
+    AllocateWorkspaceSlots(1);
+  }
+
+  /**
+   * Make sure there is a separate set of work arrays for each of `slots`
+   * LAPACK calls running concurrently. Slot i of each array starts i * lwork
+   * (or lrwork/liwork) elements into it.
+   */
+  void AllocateWorkspaceSlots(int slots)
+  {
+    if (slots <= work_slots) {
+      return;
+    }
+
+    FreeWorkspace();
+
     if (lwork > 0) {
-      matxAlloc(&work, lwork * sizeof(ValueType), MATX_HOST_MALLOC_MEMORY);
+      matxAlloc(&work, slots * lwork * sizeof(ValueType), MATX_HOST_MALLOC_MEMORY);
     }
 
     // used for eig and svd complex types
     if (lrwork > 0) {
-      matxAlloc(&rwork, lrwork * sizeof(typename inner_op_type_t<ValueType>::type), MATX_HOST_MALLOC_MEMORY);
+      matxAlloc(&rwork, slots * lrwork * sizeof(typename inner_op_type_t<ValueType>::type), MATX_HOST_MALLOC_MEMORY);
     }
 
     // used for all eig types
     if (liwork > 0) {
-      matxAlloc(&iwork, liwork * sizeof(lapack_int_t), MATX_HOST_MALLOC_MEMORY);
+      matxAlloc(&iwork, slots * liwork * sizeof(lapack_int_t), MATX_HOST_MALLOC_MEMORY);
     }
+
+    work_slots = slots;
   }
 
   virtual void GetWorkspaceSize() {};
 
 protected:
+  ValueType *WorkSlot(int slot) const
+  {
+    return reinterpret_cast<ValueType *>(work) + slot * cuda::std::max(lwork, lapack_int_t{0});
+  }
+
+  typename inner_op_type_t<ValueType>::type *RworkSlot(int slot) const
+  {
+    return reinterpret_cast<typename inner_op_type_t<ValueType>::type *>(rwork) + slot * cuda::std::max(lrwork, lapack_int_t{0});
+  }
+
+  lapack_int_t *IworkSlot(int slot) const
+  {
+    return reinterpret_cast<lapack_int_t *>(iwork) + slot * cuda::std::max(liwork, lapack_int_t{0});
+  }
+
   std::vector<void *> batch_a_ptrs;
   void *work = nullptr;  // work array of input type
   void *rwork = nullptr; // real valued work array
@@ -352,7 +389,103 @@ protected:
   lapack_int_t lwork = -1;
   lapack_int_t lrwork = -1;
   lapack_int_t liwork = -1;
+  int work_slots = 0;
+
+private:
+  void FreeWorkspace()
+  {
+    if (work != nullptr) {
+      matxFree(work);
+      work = nullptr;
+    }
+    if (rwork != nullptr) {
+      matxFree(rwork);
+      rwork = nullptr;
+    }
+    if (iwork != nullptr) {
+      matxFree(iwork);
+      iwork = nullptr;
+    }
+    work_slots = 0;
+  }
 };
+
+/**
+ * Number of concurrent LAPACK calls used for a batch on the host: one per executor
+ * thread, but never more than there are batches.
+ */
+__MATX_INLINE__ int HostLapackBatchSlots(int num_threads, size_t batches)
+{
+  return static_cast<int>(std::max<size_t>(1, std::min<size_t>(static_cast<size_t>(std::max(num_threads, 1)), batches)));
+}
+
+/**
+ * Run a LAPACK call on each matrix of a batch, spreading the batches across the
+ * host executor's threads.
+ *
+ * Each thread works through a contiguous range of batches and is given a slot
+ * number in [0, HostLapackBatchSlots()) for indexing its own workspace. While the
+ * batches run in parallel the LAPACK library itself is limited to one thread, since
+ * its internal threading does nothing for small matrices and would oversubscribe
+ * the cores for large ones. A single batch keeps the library's own threading. OpenBLAS
+ * has one process-wide thread count, which is limited through HostLibThreads so that
+ * concurrent executors don't restore it under each other.
+ *
+ * LAPACK errors cannot be thrown from inside the parallel region, so func returns
+ * the call's info value and the first nonzero one, in batch order, is returned.
+ *
+ * @tparam Func Callable taking (size_t batch, int slot) and returning lapack_int_t info
+ * @param num_threads Number of executor threads
+ * @param batches Number of batches
+ * @param func Function to call on each batch
+ * @return First nonzero info, or 0 if every call succeeded
+ */
+template <typename Func>
+__MATX_INLINE__ lapack_int_t HostLapackBatchFor(int num_threads, size_t batches, Func &&func)
+{
+  const int slots = HostLapackBatchSlots(num_threads, batches);
+  if (slots == 1) {
+    for (size_t b = 0; b < batches; b++) {
+      const lapack_int_t info = func(b, 0);
+      if (info != 0) {
+        return info;
+      }
+    }
+    return 0;
+  }
+
+#if defined(MATX_EN_OPENBLAS_LAPACK)
+  HostLibThreads<HostLibOpenBLAS>::Serial serial(openblas_get_num_threads, openblas_set_num_threads);
+#endif
+
+  std::vector<lapack_int_t> slot_info(slots, 0);
+  HostParallelForBlocked(slots, slots, [&](index_t s0, index_t s1) {
+#ifdef MATX_EN_NVPL
+    nvpl_lapack_set_num_threads_local(1);
+#endif
+    for (index_t s = s0; s < s1; s++) {
+      const size_t begin = (batches * static_cast<size_t>(s)) / static_cast<size_t>(slots);
+      const size_t end = (batches * static_cast<size_t>(s + 1)) / static_cast<size_t>(slots);
+      for (size_t b = begin; b < end; b++) {
+        const lapack_int_t info = func(b, static_cast<int>(s));
+        if (info != 0) {
+          slot_info[s] = info;
+          break;
+        }
+      }
+    }
+#ifdef MATX_EN_NVPL
+    nvpl_lapack_set_num_threads_local(0);
+#endif
+  });
+
+  for (const auto info : slot_info) {
+    if (info != 0) {
+      return info;
+    }
+  }
+  return 0;
+}
 #endif
 
 } // end namespace detail
@@ -0,0 +1,790 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "matx/core/error.h"
+#include "matx/core/nvtx.h"
+#include "matx/core/tensor.h"
+#include "matx/executors/host.h"
+#include "matx/operators/scalar_ops.h"
+#include "matx/transforms/matmul/matmul_cblas.h"
+#include "matx/transforms/solver_common.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace matx {
+
+namespace detail {
+
+/*
+ * Host kernels for the power-iteration and randomized SVDs. All matrices are dense and
+ * row-major with a leading dimension equal to their column count. Products go through the
+ * host GEMM (matmul_impl) and orthogonalization through LAPACK's QR. Each batch is processed
+ * independently, so the batch loop is spread across the executor's threads, and the BLAS
+ * calls themselves only use multiple threads when there is a single batch.
+ */
+
+template <typename T>
+__MATX_INLINE__ auto svd_host_norm(const T *x, index_t n, index_t stride = 1) {
+  typename inner_op_type_t<T>::type acc = 0;
+  for (index_t i = 0; i < n; i++) {
+    acc += scalar_internal_abs2(x[i * stride]);
+  }
+  return std::sqrt(acc);
+}
+
+// Conjugate transpose of a rank-2 tensor view
+template <typename Op>
+__MATX_INLINE__ auto svd_host_herm(const Op &op) {
+  if constexpr (is_complex_v<typename Op::value_type>) {
+    return conj(transpose_matrix(op));
+  } else {
+    return transpose_matrix(op);
+  }
+}
+
+// C (m x n) = op(A) * B, where op(A) is A (m x k) or A^H with A stored as k x m
+template <typename T, typename Executor>
+__MATX_INLINE__ void svd_host_gemm(T *C, T *A, T *B, index_t m, index_t n, index_t k,
+                                   bool conj_trans_a, const Executor &exec) {
+  auto c = make_tensor<T>(C, {m, n});
+  auto b = make_tensor<T>(B, {k, n});
+  if (conj_trans_a) {
+    matmul_impl(c, svd_host_herm(make_tensor<T>(A, {k, m})), b, exec);
+  } else {
+    matmul_impl(c, make_tensor<T>(A, {m, k}), b, exec);
+  }
+}
+
+// G = A * A^H (m x m) when aah is true, otherwise G = A^H * A (n x n)
+template <typename T, typename Executor>
+__MATX_INLINE__ void svd_host_gram(T *G, T *A, index_t m, index_t n, bool aah, const Executor &exec) {
+  if (aah) {
+    auto a = make_tensor<T>(A, {m, n});
+    matmul_impl(make_tensor<T>(G, {m, m}), a, svd_host_herm(a), exec);
+  } else {
+    svd_host_gemm(G, A, A, n, n, m, true, exec);
+  }
+}
+
+#if MATX_EN_CPU_SOLVER
+/**
+ * Thin QR of row-major m x l matrices (m >= l) using LAPACK geqrf and orgqr/ungqr.
+ *
+ * LAPACK works on column-major data, so each matrix is transposed into a scratch copy
+ * that is factored in place and then transposed back. The workspace is sized once for
+ * the shape, and one object is used per thread.
+ */
+template <typename T>
+class SvdHostQR {
+  public:
+    SvdHostQR(index_t m, index_t l) :
+      m_(static_cast<lapack_int_t>(m)), l_(static_cast<lapack_int_t>(l)), a_(m * l), tau_(l)
+    {
+      lapack_int_t info;
+      lapack_int_t query = -1;
+      T geqrf_work{};
+      T orgqr_work{};
+      geqrf_dispatch(nullptr, &geqrf_work, &query, &info);
+      MATX_ASSERT_STR_EXP(info, 0, matxSolverError, "LAPACK geqrf workspace query failed");
+      orgqr_dispatch(nullptr, &orgqr_work, &query, &info);
+      MATX_ASSERT_STR_EXP(info, 0, matxSolverError, "LAPACK orgqr workspace query failed");
+
+      lwork_ = cuda::std::max(static_cast<lapack_int_t>(scalar_internal_real(geqrf_work)),
+                              static_cast<lapack_int_t>(scalar_internal_real(orgqr_work)));
+      lwork_ = cuda::std::max(lwork_, lapack_int_t{1});
+      work_.resize(static_cast<size_t>(lwork_));
+    }
+
+    /**
+     * Replace Q with the orthonormal factor of its QR decomposition. If R is not null it
+     * receives the l x l upper triangular factor, also row-major.
+     *
+     * @return LAPACK info of the first failing call, or 0
+     */
+    lapack_int_t operator()(T *Q, T *R) {
+      const index_t m = m_;
+      const index_t l = l_;
+      for (index_t r = 0; r < m; r++) {
+        for (index_t c = 0; c < l; c++) {
+          a_[c * m + r] = Q[r * l + c];
+        }
+      }
+
+      lapack_int_t info;
+      geqrf_dispatch(a_.data(), work_.data(), &lwork_, &info);
+      if (info != 0) {
+        return info;
+      }
+
+      if (R != nullptr) {
+        for (index_t r = 0; r < l; r++) {
+          for (index_t c = 0; c < l; c++) {
+            R[r * l + c] = c >= r ? a_[c * m + r] : T(0);
+          }
+        }
+      }
+
+      orgqr_dispatch(a_.data(), work_.data(), &lwork_, &info);
+      if (info != 0) {
+        return info;
+      }
+
+      for (index_t r = 0; r < m; r++) {
+        for (index_t c = 0; c < l; c++) {
+          Q[r * l + c] = a_[c * m + r];
+        }
+      }
+      return 0;
+    }
+
+  private:
+    void geqrf_dispatch(T *a, T *work, const lapack_int_t *lwork, lapack_int_t *info) {
+      if constexpr (std::is_same_v<T, float>) {
+        LAPACK_CALL(sgeqrf)(&m_, &l_, a, &m_, tau_.data(), work, lwork, info);
+      } else if constexpr (std::is_same_v<T, double>) {
+        LAPACK_CALL(dgeqrf)(&m_, &l_, a, &m_, tau_.data(), work, lwork, info);
+      } else if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
+        LAPACK_CALL(cgeqrf)(&m_, &l_, a, &m_, tau_.data(), work, lwork, info);
+      } else if constexpr (std::is_same_v<T, cuda::std::complex<double>>) {
+        LAPACK_CALL(zgeqrf)(&m_, &l_, a, &m_, tau_.data(), work, lwork, info);
+      }
+    }
+
+    void orgqr_dispatch(T *a, T *work, const lapack_int_t *lwork, lapack_int_t *info) {
+      if constexpr (std::is_same_v<T, float>) {
+        LAPACK_CALL(sorgqr)(&m_, &l_, &l_, a, &m_, tau_.data(), work, lwork, info);
+      } else if constexpr (std::is_same_v<T, double>) {
+        LAPACK_CALL(dorgqr)(&m_, &l_, &l_, a, &m_, tau_.data(), work, lwork, info);
+      } else if constexpr (std::is_same_v<T, cuda::std::complex<float>>) {
+        LAPACK_CALL(cungqr)(&m_, &l_, &l_, a, &m_, tau_.data(), work, lwork, info);
+      } else if constexpr (std::is_same_v<T, cuda::std::complex<double>>) {
+        LAPACK_CALL(zungqr)(&m_, &l_, &l_, a, &m_, tau_.data(), work, lwork, info);
+      }
+    }
+
+    lapack_int_t m_;
+    lapack_int_t l_;
+    lapack_int_t lwork_ = 0;
+    std::vector<T> a_;
+    std::vector<T> tau_;
+    std::vector<T> work_;
+};
+#endif
+
+// One-sided (Hestenes) Jacobi SVD of the n x l matrix W. On return the columns of W are
+// orthogonal with norms sigma, and V (l x l) holds the accumulated rotations so that
+// W_in * V = W_out.
+template <typename T>
+__MATX_INLINE__ void svd_host_jacobi(T *W, T *V, typename inner_op_type_t<T>::type *sigma, index_t n, index_t l) {
+  using S = typename inner_op_type_t<T>::type;
+  constexpr int max_sweeps = 60;
+  const S eps = std::numeric_limits<S>::epsilon();
+
+  std::fill(V, V + l * l, T(0));
+  for (index_t i = 0; i < l; i++) {
+    V[i * l + i] = T(1);
+  }
+
+  const auto rotate = [](T *M, index_t rows, index_t ld, index_t p, index_t q, S c, S s, T e_conj) {
+    for (index_t r = 0; r < rows; r++) {
+      const T mp = M[r * ld + p];
+      const T mq = M[r * ld + q] * e_conj;
+      M[r * ld + p] = c * mp - s * mq;
+      M[r * ld + q] = s * mp + c * mq;
+    }
+  };
+
+  for (int sweep = 0; sweep < max_sweeps; sweep++) {
+    bool rotated = false;
+    for (index_t p = 0; p < l - 1; p++) {
+      for (index_t q = p + 1; q < l; q++) {
+        S alpha = 0;
+        S beta = 0;
+        T gamma = 0;
+        for (index_t r = 0; r < n; r++) {
+          const T wp = W[r * l + p];
+          const T wq = W[r * l + q];
+          alpha += scalar_internal_abs2(wp);
+          beta += scalar_internal_abs2(wq);
+          gamma += scalar_internal_conj(wp) * wq;
+        }
+
+        const S g = std::sqrt(scalar_internal_abs2(gamma));
+        if (g == 0 || g <= eps * std::sqrt(alpha * beta)) {
+          continue;
+        }
+
+        rotated = true;
+        const S zeta = (beta - alpha) / (2 * g);
+        const S t = (zeta >= 0 ? S(1) : S(-1)) / (std::abs(zeta) + std::sqrt(1 + zeta * zeta));
+        const S c = 1 / std::sqrt(1 + t * t);
+        const S s = c * t;
+        // Rotating column q by conj(gamma)/|gamma| makes the inner product real
+        const T e_conj = scalar_internal_conj(gamma) / g;
+
+        rotate(W, n, l, p, q, c, s, e_conj);
+        rotate(V, l, l, p, q, c, s, e_conj);
+      }
+    }
+
+    if (!rotated) {
+      break;
+    }
+  }
+
+  for (index_t j = 0; j < l; j++) {
+    sigma[j] = svd_host_norm(W + j, n, l);
+  }
+}
+
+// Power-iteration SVD of a single m x n matrix. Ap is destroyed by deflation.
+template <typename T, typename Executor>
+__MATX_INLINE__ void svdpi_host_batch(T *U, typename inner_op_type_t<T>::type *S, T *VT, T *Ap, const T *x0,
+                                      T *G, T *x, T *y, index_t m, index_t n, index_t k, int iterations,
+                                      const Executor &exec) {
+  const bool ufirst = (n >= m);
+  const index_t d = std::min(m, n);
+
+  for (index_t i = 0; i < k; i++) {
+    svd_host_gram(G, Ap, m, n, ufirst, exec);
+
+    std::copy(x0, x0 + d, x);
+    for (int it = 0; it < iterations; it++) {
+      svd_host_gemm(y, G, x, d, 1, d, false, exec);
+      const auto nrm = svd_host_norm(y, d);
+      for (index_t j = 0; j < d; j++) {
+        x[j] = y[j] / nrm;
+      }
+    }
+
+    typename inner_op_type_t<T>::type s;
+    if (ufirst) {
+      for (index_t r = 0; r < m; r++) {
+        U[r * k + i] = x[r];
+      }
+      // v = A^H * u
+      svd_host_gemm(y, Ap, x, n, 1, m, true, exec);
+      s = svd_host_norm(y, n);
+      for (index_t c = 0; c < n; c++) {
+        VT[i * n + c] = scalar_internal_conj(y[c] / s);
+      }
+    } else {
+      for (index_t c = 0; c < n; c++) {
+        VT[i * n + c] = scalar_internal_conj(x[c]);
+      }
+      // u = A * v
+      svd_host_gemm(y, Ap, x, m, 1, n, false, exec);
+      s = svd_host_norm(y, m);
+      for (index_t r = 0; r < m; r++) {
+        U[r * k + i] = y[r] / s;
+      }
+    }
+    S[i] = s;
+
+    // Remove current singular vectors from matrix
+    if (i < k - 1) {
+      for (index_t r = 0; r < m; r++) {
+        const T su = s * U[r * k + i];
+        for (index_t c = 0; c < n; c++) {
+          Ap[r * n + c] -= su * VT[i * n + c];
+        }
+      }
+    }
+  }
+}
+
+#if MATX_EN_CPU_SOLVER
+// Block power-iteration SVD of a single m x n matrix. qr must be sized for d x d matrices.
+template <typename T, typename Executor>
+__MATX_INLINE__ lapack_int_t svdbpi_host_batch(T *U, typename inner_op_type_t<T>::type *S, T *VT, T *A,
+                                               T *G, T *Q, T *Qold, T *R, SvdHostQR<T> &qr, index_t m, index_t n,
+                                               int max_iters, float tol, const Executor &exec) {
+  using STypeS = typename inner_op_type_t<T>::type;
+  const index_t d = std::min(m, n);
+
+  // create spd matrix
+  svd_host_gram(G, A, m, n, m < n, exec);
+
+  std::fill(Q, Q + d * d, T(0));
+  for (index_t i = 0; i < d; i++) {
+    Q[i * d + i] = T(1);
+  }
+  std::fill(R, R + d * d, T(0));
+
+  for (int i = 0; i < max_iters; i += 2) {
+    // double pump this iteration so we get Qold and Q for tolerance checking
+    svd_host_gemm(Qold, G, Q, d, d, d, false, exec);
+    lapack_int_t info = qr(Qold, R);
+    if (info != 0) {
+      return info;
+    }
+
+    svd_host_gemm(Q, G, Qold, d, d, d, false, exec);
+    info = qr(Q, R);
+    if (info != 0) {
+      return info;
+    }
+
+    if (tol != 0.0f) {
+      STypeS diff = 0;
+      for (index_t j = 0; j < d * d; j++) {
+        diff += scalar_internal_abs2(Q[j] - Qold[j]);
+      }
+      if (std::sqrt(diff) < static_cast<STypeS>(tol)) {
+        break;
+      }
+    }
+  }
+
+  // The diagonal of R converges to the eigenvalues of the spd matrix
+  for (index_t j = 0; j < d; j++) {
+    S[j] = std::sqrt(std::sqrt(static_cast<STypeS>(scalar_internal_abs2(R[j * d + j]))));
+  }
+
+  if (m >= n) {
+    for (index_t r = 0; r < d; r++) {
+      for (index_t c = 0; c < n; c++) {
+        VT[r * n + c] = scalar_internal_conj(Q[c * d + r]);
+      }
+    }
+    svd_host_gemm(U, A, Q, m, d, n, false, exec);
+    // normalize U by singular values, skipping zeros to avoid nans
+    for (index_t r = 0; r < m; r++) {
+      for (index_t c = 0; c < d; c++) {
+        if (S[c] != STypeS(0)) {
+          U[r * d + c] /= S[c];
+        }
+      }
+    }
+  } else {
+    std::copy(Q, Q + d * d, U);
+    svd_host_gemm(VT, Q, A, d, n, m, true, exec);
+    // normalize VT by singular values, skipping zeros to avoid nans
+    for (index_t r = 0; r < d; r++) {
+      if (S[r] != STypeS(0)) {
+        for (index_t c = 0; c < n; c++) {
+          VT[r * n + c] /= S[r];
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+
+// Randomized range-finder SVD of a single m x n matrix, keeping the top k of l = k + oversample
+// singular triplets. Omega is the n x l Gaussian test matrix, and qr_m and qr_n must be sized
+// for m x l and n x l matrices.
+template <typename T, typename Executor>
+__MATX_INLINE__ lapack_int_t svd_rand_host_batch(T *U, typename inner_op_type_t<T>::type *S, T *VT, T *A,
+                                                 T *Omega, T *Y, T *Z, T *B, T *V, T *YV,
+                                                 SvdHostQR<T> &qr_m, SvdHostQR<T> &qr_n,
+                                                 typename inner_op_type_t<T>::type *sigma, index_t *order,
+                                                 index_t m, index_t n, index_t k, index_t l, int iters,
+                                                 const Executor &exec) {
+  using STypeS = typename inner_op_type_t<T>::type;
+
+  // Range finder: Q = orth(A * Omega), refined with subspace iterations
+  svd_host_gemm(Y, A, Omega, m, l, n, false, exec);
+  lapack_int_t info = qr_m(Y, nullptr);
+  for (int it = 0; it < iters && info == 0; it++) {
+    svd_host_gemm(Z, A, Y, n, l, m, true, exec);
+    info = qr_n(Z, nullptr);
+    if (info == 0) {
+      svd_host_gemm(Y, A, Z, m, l, n, false, exec);
+      info = qr_m(Y, nullptr);
+    }
+  }
+  if (info != 0) {
+    return info;
+  }
+
+  // W = B^H = A^H * Q (n x l). Jacobi on W gives B = V * Sigma * W^H / Sigma
+  svd_host_gemm(B, A, Y, n, l, m, true, exec);
+  svd_host_jacobi(B, V, sigma, n, l);
+
+  std::iota(order, order + l, 0);
+  std::sort(order, order + l, [&](index_t a, index_t b) { return sigma[a] > sigma[b]; });
+
+  for (index_t j = 0; j < k; j++) {
+    const index_t src = order[j];
+    const STypeS s = sigma[src];
+    S[j] = s;
+    for (index_t c = 0; c < n; c++) {
+      VT[j * n + c] = s > 0 ? scalar_internal_conj(B[c * l + src]) / s : T(0);
+    }
+  }
+
+  // U = Q * V, keeping only the top k columns
+  svd_host_gemm(YV, Y, V, m, l, l, false, exec);
+  for (index_t r = 0; r < m; r++) {
+    for (index_t j = 0; j < k; j++) {
+      U[r * k + j] = YV[r * l + order[j]];
+    }
+  }
+
+  return 0;
+}
+#endif
+
+template <typename UType, typename SType, typename VTType, typename AType>
+__MATX_INLINE__ void svd_host_check_shapes(const char *name, const UType &U, const SType &S, const VTType &VT,
+                                           const AType &A, index_t k) {
+  const int RANK = AType::Rank();
+  const index_t m = A.Size(RANK-2);
+  const index_t n = A.Size(RANK-1);
+
+  for(int i = 0 ; i < RANK-2; i++) {
+    MATX_ASSERT_STR(U.Size(i) == A.Size(i), matxInvalidDim, std::string(name) + ": U and A must have the same batch sizes");
+    MATX_ASSERT_STR(VT.Size(i) == A.Size(i), matxInvalidDim, std::string(name) + ": VT and A must have the same batch sizes");
+    MATX_ASSERT_STR(S.Size(i) == A.Size(i), matxInvalidDim, std::string(name) + ": S and A must have the same batch sizes");
+  }
+
+  MATX_ASSERT_STR(U.Size(RANK-2) == m, matxInvalidDim, std::string(name) + ": U must have Size(RANK-2) == m");
+  MATX_ASSERT_STR(U.Size(RANK-1) == k, matxInvalidDim, std::string(name) + ": U must have Size(RANK-1) == k");
+  MATX_ASSERT_STR(VT.Size(RANK-2) == k, matxInvalidDim, std::string(name) + ": VT must have Size(RANK-2) == k");
+  MATX_ASSERT_STR(VT.Size(RANK-1) == n, matxInvalidDim, std::string(name) + ": VT must have Size(RANK-1) == n");
+  MATX_ASSERT_STR(S.Size(RANK-2) == k, matxInvalidDim, std::string(name) + ": S must have Size(RANK-2) == k");
+}
+
+} // end namespace detail
+
+
+/**
+ * Perform a SVD decomposition using the power iteration on the host. Batches are
+ * distributed across the executor's threads.
+ *
+ * @tparam UType
+ *   Tensor or operator type for output of U singular vectors.
+ * @tparam SType
+ *   Tensor or operator type for output of S singular values. SType must have Rank one less than AType.
+ * @tparam VType
+ *   Tensor or operator type for output of VT singular vectors.
+ * @tparam AType
+ *   Tensor or operator type for output of A input tensors.
+ * @tparam X0Type
+ *   Tensor or operator type for X0 initial guess in power iteration.
+ *
+ * @param U
+ *   U tensor or operator for left singular vectors output with size "batches by m by k"
+ * @param S
+ *   S tensor or operator for singular values output with size "batches by k"
+ * @param VT
+ *   VT tensor or operator for right singular vectors output as VH with size "batches by k by n"
+ * @param A
+ *   Input tensor or operator for tensor A input with size "batches by m by n"
+ * @param x0
+ *   Input tensor or operator signaling the initial guess for x0 at each power iteration.  A
+ *   Random tensor of size batches x min(n,m) is suggested.
+ * @param iterations
+ *   The number of power iterations to perform for each singular value.
+ * @param exec
+ *   Host executor
+ * @param k
+ *    The number of singular values to find.  Default is all singular values: min(m,n).
+ */
+template<typename UType, typename SType, typename VTType, typename AType, typename X0Type, ThreadsMode MODE>
+void svdpi_impl(UType &U, SType &S, VTType &VT, AType &A, X0Type &x0, int iterations,
+                const HostExecutor<MODE> &exec, index_t k=-1) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
+
+  static_assert(UType::Rank() == AType::Rank());
+  static_assert(VTType::Rank() == AType::Rank());
+  static_assert(SType::Rank() == AType::Rank()-1);
+
+  using ATypeS = typename AType::value_type;
+  using STypeS = typename SType::value_type;
+  const int RANK = AType::Rank();
+
+  const index_t m = A.Size(RANK-2);  // rows
+  const index_t n = A.Size(RANK-1);  // cols
+  const index_t d = cuda::std::min(n,m); // dim for AAT or ATA
+
+  // if sentinal found get all singularvalues
+  if( k == -1 ) k = d;
+
+  detail::svd_host_check_shapes("svdpi", U, S, VT, A, k);
+  MATX_ASSERT_STR(x0.Size(x0.Rank()-1) == d, matxInvalidSize, "svdpi: Initial guess x0 must have the last dimension equal to min(m,n)");
+
+  cuda::std::array<index_t, RANK-1> x0Shape;
+  for(int i = 0; i < RANK-2; i++) {
+    x0Shape[i] = A.Size(i);
+  }
+  x0Shape[RANK-2] = d;
+
+  // Deflation destroys the input, so work on a packed copy
+  auto Ap = make_tensor<ATypeS>(A.Shape(), MATX_HOST_MALLOC_MEMORY);
+  auto x0p = make_tensor<ATypeS>(x0Shape, MATX_HOST_MALLOC_MEMORY);
+  auto Up = make_tensor<ATypeS>(U.Shape(), MATX_HOST_MALLOC_MEMORY);
+  auto Sp = make_tensor<STypeS>(S.Shape(), MATX_HOST_MALLOC_MEMORY);
+  auto VTp = make_tensor<ATypeS>(VT.Shape(), MATX_HOST_MALLOC_MEMORY);
+  (Ap = A).run(exec);
+  (x0p = x0).run(exec);
+
+  const index_t batches = (m * n) > 0 ? TotalSize(Ap) / (m * n) : 0;
+  const int inner_threads = batches == 1 ? exec.GetNumThreads() : 1;
+
+  detail::HostParallelForBlocked(exec.GetNumThreads(), batches, [&](index_t b0, index_t b1) {
+    const HostExecutor<ThreadsMode::SELECT> inner_exec{HostExecParams{inner_threads}};
+    std::vector<ATypeS> G(d * d), x(d), y(cuda::std::max(m, n));
+    for (index_t b = b0; b < b1; b++) {
+      detail::svdpi_host_batch(Up.Data() + b * m * k, Sp.Data() + b * k, VTp.Data() + b * k * n,
+                               Ap.Data() + b * m * n, x0p.Data() + b * d, G.data(), x.data(), y.data(),
+                               m, n, k, iterations, inner_exec);
+    }
+  });
+
+  (U = Up).run(exec);
+  (S = Sp).run(exec);
+  (VT = VTp).run(exec);
+}
+
+/**
+ * Perform a SVD decomposition using the block power iteration on the host. Batches are
+ * distributed across the executor's threads, and each batch stops iterating as soon as it
+ * converges.
+ *
+ * @tparam UType
+ *   Tensor or operator type for output of U singular vectors.
+ * @tparam SType
+ *   Tensor or operator type for output of S singular values. SType must have Rank one less than AType.
+ * @tparam VType
+ *   Tensor or operator type for output of VT singular vectors.
+ * @tparam AType
+ *   Tensor or operator type for output of A input tensors.
+ *
+ * @param U
+ *   U tensor or operator for left singular vectors output with size "batches by m by n"
+ * @param S
+ *   S tensor or operator for singular values output with size "batches by min(m,n)"
+ * @param VT
+ *   VT tensor or operator for right singular vectors output as VH with size "batches by min(m,n) by n"
+ * @param A
+ *   Input tensor or operator for tensor A input with size "batches by m by n"
+ * @param max_iters
+ *   The approximate maximum number of QR iterations to perform.
+ * @param tol
+ *   The termination tolerance for the QR iteration. Setting this to 0 will skip the tolerance check.
+ * @param exec
+ *   Host executor
+ */
+template<typename UType, typename SType, typename VTType, typename AType, ThreadsMode MODE>
+inline void svdbpi_impl(UType &U, SType &S, VTType &VT, const AType &A, [[maybe_unused]] int max_iters,
+                        [[maybe_unused]] float tol, const HostExecutor<MODE> &exec) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL);
+
+  static_assert(UType::Rank() == AType::Rank());
+  static_assert(VTType::Rank() == AType::Rank());
+  static_assert(SType::Rank() == AType::Rank()-1);
+
+  using ATypeS = typename AType::value_type;
+  using STypeS = typename SType::value_type;
+  const int RANK = AType::Rank();
+
+  const index_t m = A.Size(RANK-2);  // rows
+  const index_t n = A.Size(RANK-1);  // cols
+  const index_t d = cuda::std::min(n,m); // dim for AAT or ATA
+
+  detail::svd_host_check_shapes("svdbpi", U, S, VT, A, d);
+  MATX_ASSERT_STR(MATX_EN_CPU_SOLVER, matxInvalidExecutor,
+    "svdbpi: Trying to run a host Solver executor but host Solver support is not configured");
+
+  auto Ap = make_tensor<ATypeS>(A.Shape(), MATX_HOST_MALLOC_MEMORY);
+  auto Up = make_tensor<ATypeS>(U.Shape(), MATX_HOST_MALLOC_MEMORY);
+  auto Sp = make_tensor<STypeS>(S.Shape(), MATX_HOST_MALLOC_MEMORY);
+  auto VTp = make_tensor<ATypeS>(VT.Shape(), MATX_HOST_MALLOC_MEMORY);
+  (Ap = A).run(exec);
+
+#if MATX_EN_CPU_SOLVER
+  const index_t batches = (m * n) > 0 ? TotalSize(Ap) / (m * n) : 0;
+  const int inner_threads = batches == 1 ? exec.GetNumThreads() : 1;
+
+  // Scratch space for each batch running concurrently
+  struct Workspace {
+    std::vector<ATypeS> G, Q, Qold, R;
+    detail::SvdHostQR<ATypeS> qr;
+  };
+  const int slots = detail::HostLapackBatchSlots(exec.GetNumThreads(), static_cast<size_t>(batches));
+  std::vector<Workspace> ws;
+  ws.reserve(static_cast<size_t>(slots));
+  for (int i = 0; i < slots; i++) {
+    ws.push_back(Workspace{std::vector<ATypeS>(d * d), std::vector<ATypeS>(d * d), std::vector<ATypeS>(d * d),
+                           std::vector<ATypeS>(d * d), detail::SvdHostQR<ATypeS>(d, d)});
+  }
+
+  const lapack_int_t info = detail::HostLapackBatchFor(exec.GetNumThreads(), static_cast<size_t>(batches),
+    [&](size_t bs, int slot) {
+      const index_t b = static_cast<index_t>(bs);
+      const HostExecutor<ThreadsMode::SELECT> inner_exec{HostExecParams{inner_threads}};
+      auto &w = ws[static_cast<size_t>(slot)];
+      return detail::svdbpi_host_batch(Up.Data() + b * m * d, Sp.Data() + b * d, VTp.Data() + b * d * n,
+                                       Ap.Data() + b * m * n, w.G.data(), w.Q.data(), w.Qold.data(), w.R.data(), w.qr,
+                                       m, n, max_iters, tol, inner_exec);
+    });
+
+  MATX_ASSERT_STR_EXP(info, 0, matxSolverError, "svdbpi: LAPACK QR error");
+#endif
+
+  (U = Up).run(exec);
+  (S = Sp).run(exec);
+  (VT = VTp).run(exec);
+}
+
+/**
+ * Perform a truncated SVD using a randomized range finder on the host.
+ *
+ * A Gaussian test matrix of `k + oversample` columns is used to sample the range of A,
+ * optionally refined with `iters` subspace iterations, and the SVD of the small projected
+ * matrix is computed with one-sided Jacobi. Batches are distributed across the executor's
+ * threads. The test matrix for each batch is seeded from `seed` and the batch index, so
+ * results do not depend on the number of threads.
+ *
+ * @tparam UType
+ *   Tensor or operator type for output of U singular vectors.
+ * @tparam SType
+ *   Tensor or operator type for output of S singular values. SType must have Rank one less than AType.
+ * @tparam VType
+ *   Tensor or operator type for output of VT singular vectors.
+ * @tparam AType
+ *   Tensor or operator type for output of A input tensors.
+ *
+ * @param U
+ *   U tensor or operator for left singular vectors output with size "batches by m by k"
+ * @param S
+ *   S tensor or operator for singular values output with size "batches by k"
+ * @param VT
+ *   VT tensor or operator for right singular vectors output as VH with size "batches by k by n"
+ * @param A
+ *   Input tensor or operator for tensor A input with size "batches by m by n"
+ * @param k
+ *   Number of singular values to find
+ * @param oversample
+ *   Number of extra columns sampled beyond k
+ * @param iters
+ *   Number of subspace (power) iterations used to refine the range
+ * @param seed
+ *   Seed for the Gaussian test matrix
+ * @param exec
+ *   Host executor
+ */
+template<typename UType, typename SType, typename VTType, typename AType, ThreadsMode MODE>
+inline void svd_rand_impl(UType &U, SType &S, VTType &VT, const AType &A, index_t k, index_t oversample,
+                          [[maybe_unused]] int iters, [[maybe_unused]] uint64_t seed, const HostExecutor<MODE> &exec) {
+  MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL);
+
+  static_assert(UType::Rank() == AType::Rank());
+  static_assert(VTType::Rank() == AType::Rank());
+  static_assert(SType::Rank() == AType::Rank()-1);
+
+  using ATypeS = typename AType::value_type;
+  using STypeS = typename SType::value_type;
+  const int RANK = AType::Rank();
+
+  const index_t m = A.Size(RANK-2);  // rows
+  const index_t n = A.Size(RANK-1);  // cols
+  const index_t d = cuda::std::min(n,m);
+
+  MATX_ASSERT_STR(k > 0 && k <= d, matxInvalidParameter, "svd_rand: k must be between 1 and min(m,n)");
+  MATX_ASSERT_STR(oversample >= 0, matxInvalidParameter, "svd_rand: oversample must be non-negative");
+  detail::svd_host_check_shapes("svd_rand", U, S, VT, A, k);
+  MATX_ASSERT_STR(MATX_EN_CPU_SOLVER, matxInvalidExecutor,
+    "svd_rand: Trying to run a host Solver executor but host Solver support is not configured");
+
+  [[maybe_unused]] const index_t l = cuda::std::min(k + oversample, d);
+
+  auto Ap = make_tensor<ATypeS>(A.Shape(), MATX_HOST_MALLOC_MEMORY);
+  auto Up = make_tensor<ATypeS>(U.Shape(), MATX_HOST_MALLOC_MEMORY);
+  auto Sp = make_tensor<STypeS>(S.Shape(), MATX_HOST_MALLOC_MEMORY);
+  auto VTp = make_tensor<ATypeS>(VT.Shape(), MATX_HOST_MALLOC_MEMORY);
+  (Ap = A).run(exec);
+
+#if MATX_EN_CPU_SOLVER
+  const index_t batches = (m * n) > 0 ? TotalSize(Ap) / (m * n) : 0;
+  const int inner_threads = batches == 1 ? exec.GetNumThreads() : 1;
+
+  // Scratch space for each batch running concurrently
+  struct Workspace {
+    std::vector<ATypeS> Omega, Y, Z, B, V, YV;
+    std::vector<STypeS> sigma;
+    std::vector<index_t> order;
+    detail::SvdHostQR<ATypeS> qr_m;
+    detail::SvdHostQR<ATypeS> qr_n;
+  };
+  const int slots = detail::HostLapackBatchSlots(exec.GetNumThreads(), static_cast<size_t>(batches));
+  std::vector<Workspace> ws;
+  ws.reserve(static_cast<size_t>(slots));
+  for (int i = 0; i < slots; i++) {
+    ws.push_back(Workspace{std::vector<ATypeS>(n * l), std::vector<ATypeS>(m * l), std::vector<ATypeS>(n * l),
+                           std::vector<ATypeS>(n * l), std::vector<ATypeS>(l * l), std::vector<ATypeS>(m * l),
+                           std::vector<STypeS>(l), std::vector<index_t>(l),
+                           detail::SvdHostQR<ATypeS>(m, l), detail::SvdHostQR<ATypeS>(n, l)});
+  }
+
+  const lapack_int_t info = detail::HostLapackBatchFor(exec.GetNumThreads(), static_cast<size_t>(batches),
+    [&](size_t bs, int slot) {
+      const index_t b = static_cast<index_t>(bs);
+      const HostExecutor<ThreadsMode::SELECT> inner_exec{HostExecParams{inner_threads}};
+      auto &w = ws[static_cast<size_t>(slot)];
+
+      std::mt19937_64 gen(seed + static_cast<uint64_t>(b));
+      std::normal_distribution<STypeS> dist;
+      for (auto &o : w.Omega) {
+        if constexpr (is_complex_v<ATypeS>) {
+          const STypeS re = dist(gen);
+          o = ATypeS{re, dist(gen)};
+        } else {
+          o = dist(gen);
+        }
+      }
+
+      return detail::svd_rand_host_batch(Up.Data() + b * m * k, Sp.Data() + b * k, VTp.Data() + b * k * n,
+                                         Ap.Data() + b * m * n, w.Omega.data(), w.Y.data(), w.Z.data(), w.B.data(),
+                                         w.V.data(), w.YV.data(), w.qr_m, w.qr_n, w.sigma.data(), w.order.data(),
+                                         m, n, k, l, iters, inner_exec);
+    });
+
+  MATX_ASSERT_STR_EXP(info, 0, matxSolverError, "svd_rand: LAPACK QR error");
+#endif
+
+  (U = Up).run(exec);
+  (S = Sp).run(exec);
+  (VT = VTp).run(exec);
+}
+
+} // end namespace matx
@@ -222,7 +222,7 @@ public:
 
   template<ThreadsMode MODE>
   void Exec(UTensor &u, STensor &s, VtTensor &vt,
-            const ATensor &a, [[maybe_unused]] const HostExecutor<MODE> &exec,
+            const ATensor &a, const HostExecutor<MODE> &exec,
             const char jobz = 'A')
   {
     MATX_NVTX_START("", matx::MATX_NVTX_LOG_INTERNAL)
@@ -250,35 +250,41 @@ public:
     SetBatchPointers<BatchType::MATRIX>(vt, this->batch_vt_ptrs);
     SetBatchPointers<BatchType::VECTOR>(s, this->batch_s_ptrs);
 
-    lapack_int_t info;
     lapack_int_t ldvt = vt.Size(RANK-2);
+    const size_t batches = this->batch_a_ptrs.size();
+    this->AllocateWorkspaceSlots(HostLapackBatchSlots(exec.GetNumThreads(), batches));
+
     if (params.algo == SVDHostAlgo::QR) {
-      for (size_t i = 0; i < this->batch_a_ptrs.size(); i++) {
-        gesvd_dispatch(&jobz, &jobz, &params.m, &params.n,
-                        reinterpret_cast<T1*>(this->batch_a_ptrs[i]),
-                        &params.m, reinterpret_cast<T3*>(this->batch_s_ptrs[i]),
-                        reinterpret_cast<T1*>(this->batch_u_ptrs[i]), &params.m,
-                        reinterpret_cast<T1*>(this->batch_vt_ptrs[i]), &ldvt,
-                        reinterpret_cast<T1*>(this->work), &this->lwork,
-                        reinterpret_cast<T3*>(this->rwork), &info);
-
-
-        MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
-          (std::to_string(info) + " superdiagonals of an intermediate bidiagonal form did not converge to zero in LAPACK").c_str());
-      }
+      const lapack_int_t info = HostLapackBatchFor(exec.GetNumThreads(), batches,
+        [&](size_t i, int slot) {
+          lapack_int_t binfo;
+          gesvd_dispatch(&jobz, &jobz, &params.m, &params.n,
+                          reinterpret_cast<T1*>(this->batch_a_ptrs[i]),
+                          &params.m, reinterpret_cast<T3*>(this->batch_s_ptrs[i]),
+                          reinterpret_cast<T1*>(this->batch_u_ptrs[i]), &params.m,
+                          reinterpret_cast<T1*>(this->batch_vt_ptrs[i]), &ldvt,
+                          this->WorkSlot(slot), &this->lwork,
+                          this->RworkSlot(slot), &binfo);
+          return binfo;
+        });
+
+      MATX_ASSERT_STR_EXP(info, 0, matxSolverError,
+        (std::to_string(info) + " superdiagonals of an intermediate bidiagonal form did not converge to zero in LAPACK").c_str());
     } else if (params.algo == SVDHostAlgo::DC) {
-      for (size_t i = 0; i < this->batch_a_ptrs.size(); i++) {
-        gesdd_dispatch(&jobz, &params.m, &params.n,
-                        reinterpret_cast<T1*>(this->batch_a_ptrs[i]),
-                        &params.m, reinterpret_cast<T3*>(this->batch_s_ptrs[i]),
-                        reinterpret_cast<T1*>(this->batch_u_ptrs[i]), &params.m,
-                        reinterpret_cast<T1*>(this->batch_vt_ptrs[i]), &ldvt,
-                        reinterpret_cast<T1*>(this->work), &this->lwork,
-                        reinterpret_cast<T3*>(this->rwork),
-                        reinterpret_cast<lapack_int_t*>(this->iwork), &info);
-
-        MATX_ASSERT_STR_EXP(info, 0, matxSolverError, "gesdd error in LAPACK");
-      }
+      const lapack_int_t info = HostLapackBatchFor(exec.GetNumThreads(), batches,
+        [&](size_t i, int slot) {
+          lapack_int_t binfo;
+          gesdd_dispatch(&jobz, &params.m, &params.n,
+                          reinterpret_cast<T1*>(this->batch_a_ptrs[i]),
+                          &params.m, reinterpret_cast<T3*>(this->batch_s_ptrs[i]),
+                          reinterpret_cast<T1*>(this->batch_u_ptrs[i]), &params.m,
+                          reinterpret_cast<T1*>(this->batch_vt_ptrs[i]), &ldvt,
+                          this->WorkSlot(slot), &this->lwork,
+                          this->RworkSlot(slot), this->IworkSlot(slot), &binfo);
+          return binfo;
+        });
+
+      MATX_ASSERT_STR_EXP(info, 0, matxSolverError, "gesdd error in LAPACK");
     }
   }
 
@@ -7,16 +7,11 @@ using namespace matx;
 using namespace matx::test;
 
 
-//TYPED_TEST(OperatorTestsFloatNonComplexNonHalfAllExecs, Interp)
-TEST(InterpTests, Interp)
+TYPED_TEST(OperatorTestsFloatNonComplexNonHalfAllExecs, Interp)
 {
   MATX_ENTER_HANDLER();
-  using TestType = float;
-  using ExecType = cudaExecutor;
-
-  if constexpr (!is_cuda_executor_v<ExecType>) {
-    GTEST_SKIP();
-  }
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
 
   using inner_type = typename inner_op_type_t<TestType>::type;
   ExecType exec{};
@@ -49,7 +44,7 @@ TEST(InterpTests, Interp)
 
 
   auto out_linear = make_tensor<TestType>({xq.Size(0)});
-  (out_linear = interp1(x, v, xq, InterpMethod::LINEAR)).run(exec);
+  (out_linear = interp1<InterpMethod::LINEAR>(x, v, xq)).run(exec);
   // example-end interp-test-1
   exec.sync();
 
@@ -59,7 +54,7 @@ TEST(InterpTests, Interp)
 
   // example-begin interp-test-2
   auto out_nearest = make_tensor<TestType>({xq.Size(0)});
-  (out_nearest = interp1(x, v, xq, InterpMethod::NEAREST)).run(exec);
+  (out_nearest = interp1<InterpMethod::NEAREST>(x, v, xq)).run(exec);
   // example-end interp-test-2
   exec.sync();
 
@@ -68,7 +63,7 @@ TEST(InterpTests, Interp)
   }
 
   auto out_next = make_tensor<TestType>(xq.Shape());
-  (out_next = interp1(x, v, xq, InterpMethod::NEXT)).run(exec);
+  (out_next = interp1<InterpMethod::NEXT>(x, v, xq)).run(exec);
   exec.sync();
 
   for (index_t i = 0; i < xq.Size(0); i++) {
@@ -76,7 +71,7 @@ TEST(InterpTests, Interp)
   }
 
   auto out_prev = make_tensor<TestType>(xq.Shape());
-  (out_prev = interp1(x, v, xq, InterpMethod::PREV)).run(exec);
+  (out_prev = interp1<InterpMethod::PREV>(x, v, xq)).run(exec);
   exec.sync();
 
   for (index_t i = 0; i < xq.Size(0); i++) {
@@ -84,13 +79,28 @@ TEST(InterpTests, Interp)
   }
 
   auto out_spline = make_tensor<TestType>(xq.Shape());
-  (out_spline = interp1(x, v, xq, InterpMethod::SPLINE)).run(exec);
+  (out_spline = interp1<InterpMethod::SPLINE>(x, v, xq)).run(exec);
   exec.sync();
 
   for (index_t i = 0; i < xq.Size(0); i++) {
     ASSERT_NEAR(out_spline(i), vq_spline(i), 1e-4);
   }
 
+  // Unsorted query points take the per-query search path
+  auto xq_rev = make_tensor<TestType>(xq.Shape());
+  (xq_rev = reverse<0>(xq)).run(exec);
+
+  auto out_linear_rev = make_tensor<TestType>(xq.Shape());
+  (out_linear_rev = interp1<InterpMethod::LINEAR>(x, v, xq_rev)).run(exec);
+  auto out_spline_rev = make_tensor<TestType>(xq.Shape());
+  (out_spline_rev = interp1<InterpMethod::SPLINE>(x, v, xq_rev)).run(exec);
+  exec.sync();
+
+  for (index_t i = 0; i < xq.Size(0); i++) {
+    ASSERT_EQ(out_linear_rev(i), vq_linear(xq.Size(0) - 1 - i));
+    ASSERT_NEAR(out_spline_rev(i), vq_spline(xq.Size(0) - 1 - i), 1e-4);
+  }
+
 
   auto x2 = make_tensor<TestType>({2, 5});
   auto v3 = make_tensor<TestType>({3, 2, 5});
@@ -102,7 +112,7 @@ TEST(InterpTests, Interp)
 
 
   auto out_linear4 = make_tensor<TestType>(xq4.Shape());
-  (out_linear4 = interp1(x, v3, xq4, InterpMethod::LINEAR)).run(exec);
+  (out_linear4 = interp1<InterpMethod::LINEAR>(x, v3, xq4)).run(exec);
   exec.sync();
 
   for (index_t i = 0; i < xq4.Size(0); i++) {
@@ -117,7 +127,7 @@ TEST(InterpTests, Interp)
   
 
   auto out_nearest4 = make_tensor<TestType>(xq4.Shape());
-  (out_nearest4 = interp1(x, v3, xq4, InterpMethod::NEAREST)).run(exec);
+  (out_nearest4 = interp1<InterpMethod::NEAREST>(x, v3, xq4)).run(exec);
   exec.sync();
 
   for (index_t i = 0; i < xq4.Size(0); i++) {
@@ -131,7 +141,7 @@ TEST(InterpTests, Interp)
   }
 
   auto out_next4 = make_tensor<TestType>(xq4.Shape());
-  (out_next4 = interp1(x, v3, xq4, InterpMethod::NEXT)).run(exec);
+  (out_next4 = interp1<InterpMethod::NEXT>(x, v3, xq4)).run(exec);
   exec.sync();
 
   for (index_t i = 0; i < xq4.Size(0); i++) {
@@ -145,7 +155,7 @@ TEST(InterpTests, Interp)
   }
 
   auto out_prev4 = make_tensor<TestType>(xq4.Shape());
-  (out_prev4 = interp1(x, v3, xq4, InterpMethod::PREV)).run(exec);
+  (out_prev4 = interp1<InterpMethod::PREV>(x, v3, xq4)).run(exec);
   exec.sync();
 
   for (index_t i = 0; i < xq4.Size(0); i++) {
@@ -159,7 +169,7 @@ TEST(InterpTests, Interp)
   }
 
   auto out_spline4 = make_tensor<TestType>(xq4.Shape());
-  (out_spline4 = interp1(x, v3, xq4, InterpMethod::SPLINE)).run(exec);
+  (out_spline4 = interp1<InterpMethod::SPLINE>(x, v3, xq4)).run(exec);
   exec.sync();
 
   for (index_t i = 0; i < xq4.Size(0); i++) {
@@ -184,7 +194,7 @@ TEST(InterpTests, Interp)
 
 
   auto out_perm_linear4 = make_tensor<TestType>(pxq4.Shape());
-  (out_perm_linear4 = interp1(px2, pv3, pxq4, {2}, InterpMethod::LINEAR)).run(exec);
+  (out_perm_linear4 = interp1<InterpMethod::LINEAR>(px2, pv3, pxq4, {2})).run(exec);
   exec.sync();
 
   for (index_t i = 0; i < pxq4.Size(0); i++) {
@@ -199,7 +209,7 @@ TEST(InterpTests, Interp)
   
 
   auto out_perm_nearest4 = make_tensor<TestType>(pxq4.Shape());
-  (out_perm_nearest4 = interp1(px2, pv3, pxq4, {2}, InterpMethod::NEAREST)).run(exec);
+  (out_perm_nearest4 = interp1<InterpMethod::NEAREST>(px2, pv3, pxq4, {2})).run(exec);
   exec.sync();
 
   for (index_t i = 0; i < pxq4.Size(0); i++) {
@@ -213,7 +223,7 @@ TEST(InterpTests, Interp)
   }
 
   auto out_perm_next4 = make_tensor<TestType>(pxq4.Shape());
-  (out_perm_next4 = interp1(px2, pv3, pxq4, {2}, InterpMethod::NEXT)).run(exec);
+  (out_perm_next4 = interp1<InterpMethod::NEXT>(px2, pv3, pxq4, {2})).run(exec);
   exec.sync();
 
   for (index_t i = 0; i < pxq4.Size(0); i++) {
@@ -227,7 +237,7 @@ TEST(InterpTests, Interp)
   }
 
   auto out_perm_prev4 = make_tensor<TestType>(pxq4.Shape());
-  (out_perm_prev4 = interp1(px2, pv3, pxq4, {2}, InterpMethod::PREV)).run(exec);
+  (out_perm_prev4 = interp1<InterpMethod::PREV>(px2, pv3, pxq4, {2})).run(exec);
   exec.sync();
 
   for (index_t i = 0; i < pxq4.Size(0); i++) {
@@ -241,7 +251,7 @@ TEST(InterpTests, Interp)
   }
 
   auto out_perm_spline4 = make_tensor<TestType>(pxq4.Shape());
-  (out_perm_spline4 = interp1(px2, pv3, pxq4, {2}, InterpMethod::SPLINE)).run(exec);
+  (out_perm_spline4 = interp1<InterpMethod::SPLINE>(px2, pv3, pxq4, {2})).run(exec);
   exec.sync();
 
   for (index_t i = 0; i < pxq4.Size(0); i++) {
@@ -44,6 +44,12 @@ template <typename T> class InvSolverTest : public ::testing::Test {
 protected:
   void SetUp() override
   {
+    // Use an arbitrary number of threads for the select threads host exec.
+    if constexpr (is_select_threads_host_executor_v<GExecType>) {
+      HostExecParams params{4};
+      exec = SelectThreadsHostExecutor{params};
+    }
+
     pb = std::make_unique<detail::MatXPybind>();
 
   }
@@ -59,7 +65,7 @@ class InvSolverTestFloatTypes : public InvSolverTest<TensorType> {
 };
 
 TYPED_TEST_SUITE(InvSolverTestFloatTypes,
-  MatXFloatNonHalfTypesCUDAExec);
+  MatXFloatNonHalfTypesAllExecs);
 
 TYPED_TEST(InvSolverTestFloatTypes, Inv4x4)
 {
@@ -77,12 +77,37 @@ template <typename TensorType>
 class SVDSolverTestNonHalfTypes : public SVDSolverTest<TensorType> {
 };
 
+template <typename T> class SVDPISolverTest : public SVDTest<T> {
+protected:
+  using GTestType = cuda::std::tuple_element_t<0, T>;
+  using GExecType = cuda::std::tuple_element_t<1, T>;
+  void SetUp() override
+  {
+    // The power iterations don't need a host solver, but the checks use matmul()
+    if constexpr (!detail::CheckMatMulSupport<GExecType, GTestType>()) {
+      GTEST_SKIP();
+    }
+
+    if constexpr (is_select_threads_host_executor_v<GExecType>) {
+      HostExecParams params{4};
+      this->exec = SelectThreadsHostExecutor{params};
+    }
+
+    this->pb = std::make_unique<detail::MatXPybind>();
+  }
+};
+
 template <typename TensorType>
-class SVDPISolverTestNonHalfTypes : public SVDTest<TensorType> {
+class SVDPISolverTestNonHalfTypes : public SVDPISolverTest<TensorType> {
+};
+
+template <typename TensorType>
+class SVDRandSolverTestNonHalfTypes : public SVDPISolverTest<TensorType> {
 };
 
 TYPED_TEST_SUITE(SVDSolverTestNonHalfTypes, MatXFloatNonHalfTypesAllExecs);
-TYPED_TEST_SUITE(SVDPISolverTestNonHalfTypes, MatXFloatNonHalfTypesCUDAExec);
+TYPED_TEST_SUITE(SVDPISolverTestNonHalfTypes, MatXFloatNonHalfTypesAllExecs);
+TYPED_TEST_SUITE(SVDRandSolverTestNonHalfTypes, MatXFloatNonHalfTypesAllExecs);
 
 TYPED_TEST(SVDSolverTestNonHalfTypes, SVDBasic)
 {
@@ -724,6 +749,12 @@ TYPED_TEST(SVDPISolverTestNonHalfTypes, SVDBPI)
 {
   MATX_ENTER_HANDLER();
   using TestType = cuda::std::tuple_element_t<0, TypeParam>;  
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  // The block power iteration orthogonalizes with the solver's QR
+  if constexpr (!detail::CheckSolverSupport<ExecType>()) {
+    GTEST_SKIP();
+  }
 
   svdbpi_test<TestType>({4,4}, this->exec);
   svdbpi_test<TestType>({4,16}, this->exec);
@@ -739,3 +770,112 @@ TYPED_TEST(SVDPISolverTestNonHalfTypes, SVDBPI)
 
   MATX_EXIT_HANDLER();
 }
+
+template <typename TypeParam, int RANK, typename Executor>
+void svd_rand_test( const index_t (&AshapeA)[RANK], index_t k, Executor exec) {
+  using AType = TypeParam;
+  using SType = typename inner_op_type_t<AType>::type;
+
+  cuda::std::array<index_t, RANK> Ashape = detail::to_array(AshapeA);
+
+  index_t mm = Ashape[RANK-2];
+  index_t nn = Ashape[RANK-1];
+
+  auto Ushape = Ashape;
+  Ushape[RANK-1] = k;
+
+  auto VTshape = Ashape;
+  VTshape[RANK-2] = k;
+
+  cuda::std::array<index_t, RANK-1> Sshape;
+  for(index_t i = 0; i < RANK-2; i++) {
+    Sshape[i] = Ashape[i];
+  }
+  Sshape[RANK-2] = k;
+
+  // Build A as a product of k-column factors so its rank is exactly k and the
+  // randomized SVD reconstructs it
+  auto Lshape = Ashape;
+  Lshape[RANK-1] = k;
+  auto Rshape = Ashape;
+  Rshape[RANK-2] = k;
+
+  auto L = make_tensor<AType>(Lshape);
+  auto R = make_tensor<AType>(Rshape);
+  (L = random<AType>(Lshape, NORMAL)).run(exec);
+  (R = random<AType>(Rshape, NORMAL)).run(exec);
+
+  // example-begin svd_rand-test-1
+  auto A = make_tensor<AType>(Ashape);
+  auto U = make_tensor<AType>(Ushape);
+  auto VT = make_tensor<AType>(VTshape);
+  auto S = make_tensor<SType>(Sshape);
+
+  (A = matmul(L, R)).run(exec);
+
+  // Top-k SVD with 5 oversampled columns and 2 subspace iterations
+  (mtie(U, S, VT) = svd_rand(A, k, 5, 2)).run(exec);
+  // example-end svd_rand-test-1
+
+  auto Ishape = Ushape;
+  Ishape[RANK-1] = k;
+  Ishape[RANK-2] = k;
+
+  auto UD = make_tensor<AType>(Ushape);
+  auto UDVT = make_tensor<AType>(Ashape);
+  auto UTU = make_tensor<AType>(Ishape);
+  auto UTUd = make_tensor<SType>(Ishape);
+  auto Ad = make_tensor<SType>(Ashape);
+
+  (UTU = matmul(conj(transpose_matrix(U)), U)).run(exec);
+
+  cuda::std::array<index_t, RANK> Dshape;
+  Dshape.fill(matxKeepDim);
+  Dshape[RANK-2] = mm;
+  auto D = clone<RANK>(S, Dshape);
+  (UD = U * D).run(exec);
+  (UDVT = matmul(UD, VT)).run(exec);
+
+  auto e = eye<SType>({k,k});
+  auto eShape = Ishape;
+  eShape[RANK-1] = matxKeepDim;
+  eShape[RANK-2] = matxKeepDim;
+  auto I = clone<RANK>(e, eShape);
+
+  auto mdiffU = make_tensor<SType>({});
+  auto mdiffA = make_tensor<SType>({});
+
+  (UTUd = abs(UTU - I)).run(exec);
+  (Ad = abs(A - UDVT)).run(exec);
+  (mdiffU = max(UTUd)).run(exec);
+  (mdiffA = max(Ad)).run(exec);
+  exec.sync();
+
+  ASSERT_NEAR( mdiffU(), SType(0), .01);
+  ASSERT_NEAR( mdiffA(), SType(0), .01 * static_cast<SType>(nn));
+
+  // Singular values are returned in descending order
+  if constexpr (RANK == 2) {
+    for (index_t i = 1; i < k; i++) {
+      ASSERT_GE(S(i-1), S(i));
+    }
+  }
+}
+
+TYPED_TEST(SVDRandSolverTestNonHalfTypes, SVDRand)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  // svd_rand() is host-only and orthogonalizes with the host solver's QR
+  if constexpr (is_cuda_executor_v<ExecType> || !detail::CheckSolverSupport<ExecType>()) {
+    GTEST_SKIP();
+  } else {
+    svd_rand_test<TestType>({64,16}, 4, this->exec);
+    svd_rand_test<TestType>({16,64}, 4, this->exec);
+    svd_rand_test<TestType>({8,64,16}, 3, this->exec);
+  }
+
+  MATX_EXIT_HANDLER();
+}
@@ -0,0 +1,151 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "assert.h"
+#include "matx.h"
+#include "test_types.h"
+#include "utilities.h"
+#include "gtest/gtest.h"
+
+using namespace matx;
+
+//
+// Helper method to construct a 4x6 matrix with 2x3 blocks:
+//
+// | 1 2 3 0 0 0 |
+// | 4 5 6 0 0 0 |
+// | 0 0 0 7 8 9 |
+// | 1 0 2 3 0 4 |
+//
+template <typename T> static auto makeBSR() {
+  auto V = make_tensor<T>({3 * 6});
+  const float v[] = {1, 2, 3, 4, 5, 6, 1, 0, 2, 0, 0, 0, 7, 8, 9, 3, 0, 4};
+  for (index_t i = 0; i < 18; i++) {
+    V(i) = static_cast<T>(v[i]);
+  }
+  auto P = make_tensor<index_t>({3});
+  P(0) = 0;
+  P(1) = 1;
+  P(2) = 3;
+  auto C = make_tensor<index_t>({3});
+  C(0) = 0;
+  C(1) = 0;
+  C(2) = 1;
+  return experimental::make_tensor_bsr<2, 3>(V, P, C, {4, 6});
+}
+
+template <typename T> static auto makeDense() {
+  auto D = make_tensor<T>({4, 6});
+  const float v[] = {1, 2, 3, 0, 0, 0, 4, 5, 6, 0, 0, 0,
+                     0, 0, 0, 7, 8, 9, 1, 0, 2, 3, 0, 4};
+  for (index_t i = 0; i < 4; i++) {
+    for (index_t j = 0; j < 6; j++) {
+      D(i, j) = static_cast<T>(v[i * 6 + j]);
+    }
+  }
+  return D;
+}
+
+template <typename T> class BsrSparseTest : public ::testing::Test {
+protected:
+  using GTestType = cuda::std::tuple_element_t<0, T>;
+  using GExecType = cuda::std::tuple_element_t<1, T>;
+  void SetUp() override { CheckTestTypeSupport<GTestType>(); }
+  float thresh = 0.001f;
+};
+
+template <typename T> class BsrSparseTestsAll : public BsrSparseTest<T> {};
+
+TYPED_TEST_SUITE(BsrSparseTestsAll, MatXFloatNonComplexNonHalfTypesAllExecs);
+
+TYPED_TEST(BsrSparseTestsAll, MatvecMatmulBSR) {
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  if constexpr (!is_host_executor_v<ExecType>) {
+    GTEST_SKIP();
+  } else {
+    ExecType exec{};
+
+    auto A = makeBSR<TestType>();
+    auto D = makeDense<TestType>();
+    const index_t m = A.Size(0);
+    const index_t k = A.Size(1);
+    const index_t n = 3;
+    ASSERT_EQ(A.Nse(), 18);
+
+    // Getters are expensive, but fully functional!
+    for (index_t i = 0; i < m; i++) {
+      for (index_t j = 0; j < k; j++) {
+        ASSERT_EQ(A(i, j), D(i, j));
+      }
+    }
+
+    auto X = make_tensor<TestType>({k});
+    auto B = make_tensor<TestType>({k, n});
+    for (index_t i = 0; i < k; i++) {
+      X(i) = static_cast<TestType>(i + 1);
+      for (index_t j = 0; j < n; j++) {
+        B(i, j) = static_cast<TestType>(i - j);
+      }
+    }
+
+    // Matvec.
+    auto Y = make_tensor<TestType>({m});
+    (Y = matvec(A, X)).run(exec);
+
+    // Matmul.
+    auto O = make_tensor<TestType>({m, n});
+    (O = matmul(A, B)).run(exec);
+
+    // Verify result.
+    exec.sync();
+    for (index_t i = 0; i < m; i++) {
+      TestType y = 0;
+      for (index_t l = 0; l < k; l++) {
+        y += D(i, l) * X(l);
+      }
+      ASSERT_NEAR(Y(i), y, this->thresh);
+      for (index_t j = 0; j < n; j++) {
+        TestType o = 0;
+        for (index_t l = 0; l < k; l++) {
+          o += D(i, l) * B(l, j);
+        }
+        ASSERT_NEAR(O(i, j), o, this->thresh);
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
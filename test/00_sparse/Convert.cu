@@ -66,7 +66,7 @@ protected:
 template <typename T>
 class ConvertSparseTestsAll : public ConvertSparseTest<T> {};
 
-TYPED_TEST_SUITE(ConvertSparseTestsAll, MatXFloatNonComplexTypesCUDAExec);
+TYPED_TEST_SUITE(ConvertSparseTestsAll, MatXTypesFloatNonComplexAllExecs);
 
 TYPED_TEST(ConvertSparseTestsAll, ConvertCOO) {
   MATX_ENTER_HANDLER();
@@ -252,3 +252,126 @@ TYPED_TEST(ConvertSparseTestsAll, ConvertCSC) {
 
   MATX_EXIT_HANDLER();
 }
+
+TYPED_TEST(ConvertSparseTestsAll, ConvertHostUnsortedCOO) {
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  if constexpr (!is_host_executor_v<ExecType>) {
+    GTEST_SKIP();
+  } else {
+    ExecType exec{};
+
+    auto D = makeD<TestType>();
+    const auto m = D.Size(0);
+    const auto n = D.Size(1);
+
+    // Unsorted COO with D(4, 4) split over two duplicate entries.
+    auto val = make_tensor<TestType>({5});
+    auto row = make_tensor<index_t>({5});
+    auto col = make_tensor<index_t>({5});
+    const index_t r[] = {9, 4, 0, 9, 4};
+    const index_t c[] = {9, 4, 1, 1, 4};
+    const float v[] = {4, 1.5f, 1, 3, 0.5f};
+    for (index_t e = 0; e < 5; e++) {
+      row(e) = r[e];
+      col(e) = c[e];
+      val(e) = static_cast<TestType>(v[e]);
+    }
+    auto S = experimental::make_tensor_coo(val, row, col, {m, n});
+
+    // Sorting and summing duplicates into CSR.
+    auto Acsr =
+        experimental::make_zero_tensor_csr<TestType, index_t, index_t>({m, n});
+    (Acsr = sparse2sparse(S)).run(exec);
+    ASSERT_EQ(Acsr.Nse(), 4);
+
+    // Transposing CSR into CSC and back into sorted COO.
+    auto Acsc =
+        experimental::make_zero_tensor_csc<TestType, index_t, index_t>({m, n});
+    (Acsc = sparse2sparse(Acsr)).run(exec);
+    ASSERT_EQ(Acsc.Nse(), 4);
+    auto Acoo = experimental::make_zero_tensor_coo<TestType, index_t>({m, n});
+    (Acoo = sparse2sparse(Acsc)).run(exec);
+    ASSERT_EQ(Acoo.Nse(), 4);
+
+    exec.sync();
+    for (index_t i = 0; i < m; i++) {
+      for (index_t j = 0; j < n; j++) {
+        ASSERT_EQ(Acsr(i, j), D(i, j));
+        ASSERT_EQ(Acsc(i, j), D(i, j));
+        ASSERT_EQ(Acoo(i, j), D(i, j));
+      }
+    }
+    for (index_t e = 1; e < Acoo.Nse(); e++) {
+      ASSERT_LE(Acoo.CRDData(0)[e - 1], Acoo.CRDData(0)[e]);
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(ConvertSparseTestsAll, ConvertHostReuseCSR) {
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  if constexpr (!is_host_executor_v<ExecType>) {
+    GTEST_SKIP();
+  } else {
+    ExecType exec{};
+
+    auto D = makeD<TestType>();
+    const auto m = D.Size(0);
+    const auto n = D.Size(1);
+
+    // CSR over user buffers with room for 10 nonzeros. The tensors it was
+    // made from go out of scope before the conversions.
+    TestType *vals = nullptr;
+    auto S = [&]() {
+      auto val = make_tensor<TestType>({10});
+      auto col = make_tensor<index_t>({10});
+      auto rowp = make_tensor<index_t>({m + 1});
+      vals = val.Data();
+      return experimental::make_tensor_csr(val, rowp, col, {m, n});
+    }();
+    ASSERT_EQ(S.Nse(), 10);
+
+    // Fewer nonzeros than the buffers hold refill them in place.
+    (S = dense2sparse(D)).run(exec);
+    ASSERT_EQ(S.Nse(), 4);
+    ASSERT_EQ(S.crdSize(1), 4);
+    ASSERT_EQ(S.Data(), vals);
+    ASSERT_EQ(IsAllocated(vals), true);
+
+    // More nonzeros, still within the original capacity.
+    D(2, 3) = static_cast<TestType>(5);
+    D(7, 0) = static_cast<TestType>(6);
+    (S = dense2sparse(D)).run(exec);
+    ASSERT_EQ(S.Nse(), 6);
+    ASSERT_EQ(S.crdSize(1), 6);
+    ASSERT_EQ(S.Data(), vals);
+
+    exec.sync();
+    for (index_t i = 0; i < m; i++) {
+      for (index_t j = 0; j < n; j++) {
+        ASSERT_EQ(S(i, j), D(i, j));
+      }
+    }
+
+    // Beyond the capacity, the output gets new buffers.
+    TestType C3 = static_cast<TestType>(3);
+    (S = dense2sparse(D + C3)).run(exec);
+    ASSERT_EQ(S.Nse(), 100);
+
+    exec.sync();
+    for (index_t i = 0; i < m; i++) {
+      for (index_t j = 0; j < n; j++) {
+        ASSERT_EQ(S(i, j), D(i, j) + C3);
+      }
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
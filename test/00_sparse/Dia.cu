@@ -114,7 +114,7 @@ template <typename T> class DiaSparseTestsAll : public DiaSparseTest<T> {};
 
 template <typename T> class DiaSolveSparseTestsAll : public DiaSparseTest<T> {};
 
-TYPED_TEST_SUITE(DiaSparseTestsAll, MatXFloatNonComplexHalfTypesCUDAExec);
+TYPED_TEST_SUITE(DiaSparseTestsAll, MatXFloatNonComplexHalfTypesAllExecs);
 TYPED_TEST_SUITE(DiaSolveSparseTestsAll, MatXFloatNonHalfTypesCUDAExec);
 
 TYPED_TEST(DiaSparseTestsAll, MatvecDIAI) {
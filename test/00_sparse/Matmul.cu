@@ -33,6 +33,7 @@
 
 #include "assert.h"
 #include "matx.h"
+#include "sparse_utilities.h"
 #include "test_types.h"
 #include "utilities.h"
 #include "gtest/gtest.h"
@@ -117,6 +118,16 @@ class MatmulSparseTestsAll : public MatmulSparseTest<T> {};
 
 TYPED_TEST_SUITE(MatmulSparseTestsAll, MatXFloatNonComplexHalfTypesCUDAExec);
 
+template <typename T>
+class MatmulSparseTestsAllExecs : public MatmulSparseTest<T> {};
+
+TYPED_TEST_SUITE(MatmulSparseTestsAllExecs, MatXFloatNonComplexHalfTypesAllExecs);
+
+template <typename T>
+class MatmulSparseTestsNonHalfAllExecs : public MatmulSparseTest<T> {};
+
+TYPED_TEST_SUITE(MatmulSparseTestsNonHalfAllExecs, MatXFloatNonComplexNonHalfTypesAllExecs);
+
 TYPED_TEST(MatmulSparseTestsAll, MatmulCOO) {
   MATX_ENTER_HANDLER();
   using TestType = cuda::std::tuple_element_t<0, TypeParam>;
@@ -274,3 +285,96 @@ TYPED_TEST(MatmulSparseTestsAll, MatmulCSC) {
 
   MATX_EXIT_HANDLER();
 }
+
+TYPED_TEST(MatmulSparseTestsAllExecs, MatmulFormats) {
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+
+  auto A = makeA<TestType>();
+  auto B = makeB<TestType>();
+  auto E = makeE<TestType>();
+  const auto m = A.Size(0);
+  const auto n = B.Size(1);
+  auto [Scoo, Scsr, Scsc] = makeSparseForms(A);
+
+  const auto verify = [&](auto &S) {
+    auto O = make_tensor<TestType>({m, n});
+    (O = matmul(S, B)).run(exec);
+    auto TO = make_tensor<TestType>({n, m});
+    (transpose(TO) = matmul(S, B)).run(exec);
+    exec.sync();
+    for (index_t i = 0; i < m; i++) {
+      for (index_t j = 0; j < n; j++) {
+        ASSERT_NEAR(O(i, j), E(i, j), this->thresh);
+        ASSERT_NEAR(TO(j, i), E(i, j), this->thresh);
+      }
+    }
+  };
+  verify(Scoo);
+  verify(Scsr);
+  verify(Scsc);
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(MatmulSparseTestsNonHalfAllExecs, MatmulSpGEMM) {
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+
+  // C = 2 * A^T * A with all of A^T, A and C in CSR.
+  auto A = makeA<TestType>();
+  const auto m = A.Size(0);
+  const auto k = A.Size(1);
+  auto At = make_tensor<TestType>({k, m});
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < k; j++) {
+      At(j, i) = A(i, j);
+    }
+  }
+  auto Acsr = cuda::std::get<1>(makeSparseForms(A));
+  auto Atcsr = cuda::std::get<1>(makeSparseForms(At));
+
+  auto C = experimental::make_zero_tensor_csr<TestType, index_t, index_t>({k, k});
+  (C = matmul(Atcsr, Acsr, 2.0f)).run(exec);
+
+  // Verify result against the dense product.
+  exec.sync();
+  auto E = make_tensor<TestType>({k, k});
+  index_t nnz = 0;
+  for (index_t i = 0; i < k; i++) {
+    for (index_t j = 0; j < k; j++) {
+      TestType acc = static_cast<TestType>(0);
+      for (index_t l = 0; l < m; l++) {
+        acc += A(l, i) * A(l, j);
+      }
+      E(i, j) = static_cast<TestType>(2) * acc;
+      nnz += acc != static_cast<TestType>(0);
+    }
+  }
+  ASSERT_EQ(C.Nse(), nnz);
+  const index_t *rowp = C.POSData(1);
+  const index_t *col = C.CRDData(1);
+  const TestType *val = C.Data();
+  for (index_t i = 0; i < k; i++) {
+    for (index_t p = rowp[i]; p < rowp[i + 1]; p++) {
+      if (p > rowp[i]) {
+        ASSERT_LT(col[p - 1], col[p]);
+      }
+      ASSERT_NEAR(val[p], E(i, col[p]), this->thresh);
+      E(i, col[p]) = static_cast<TestType>(0);
+    }
+  }
+  for (index_t i = 0; i < k; i++) {
+    for (index_t j = 0; j < k; j++) {
+      ASSERT_EQ(E(i, j), static_cast<TestType>(0));
+    }
+  }
+
+  MATX_EXIT_HANDLER();
+}
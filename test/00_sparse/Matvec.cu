@@ -33,6 +33,7 @@
 
 #include "assert.h"
 #include "matx.h"
+#include "sparse_utilities.h"
 #include "test_types.h"
 #include "utilities.h"
 #include "gtest/gtest.h"
@@ -97,6 +98,11 @@ class MatvecSparseTestsAll : public MatvecSparseTest<T> {};
 
 TYPED_TEST_SUITE(MatvecSparseTestsAll, MatXFloatNonComplexHalfTypesCUDAExec);
 
+template <typename T>
+class MatvecSparseTestsAllExecs : public MatvecSparseTest<T> {};
+
+TYPED_TEST_SUITE(MatvecSparseTestsAllExecs, MatXFloatNonComplexHalfTypesAllExecs);
+
 TYPED_TEST(MatvecSparseTestsAll, MatvecCOO) {
   MATX_ENTER_HANDLER();
   using TestType = cuda::std::tuple_element_t<0, TypeParam>;
@@ -206,3 +212,31 @@ TYPED_TEST(MatvecSparseTestsAll, MatvecCSC) {
 
   MATX_EXIT_HANDLER();
 }
+
+TYPED_TEST(MatvecSparseTestsAllExecs, MatvecFormats) {
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  ExecType exec{};
+
+  auto A = makeA<TestType>();
+  auto B = makeB<TestType>();
+  auto C = makeC<TestType>();
+  const auto m = A.Size(0);
+  auto [Scoo, Scsr, Scsc] = makeSparseForms(A);
+
+  const auto verify = [&](auto &S) {
+    auto O = make_tensor<TestType>({m});
+    (O = matvec(S, B)).run(exec);
+    exec.sync();
+    for (index_t i = 0; i < m; i++) {
+      ASSERT_NEAR(O(i), C(i), this->thresh);
+    }
+  };
+  verify(Scoo);
+  verify(Scsr);
+  verify(Scsc);
+
+  MATX_EXIT_HANDLER();
+}
@@ -54,7 +54,7 @@ protected:
 
 template <typename T> class SolveSparseTestsAll : public SolveSparseTest<T> {};
 
-TYPED_TEST_SUITE(SolveSparseTestsAll, MatXFloatNonHalfTypesCUDAExec);
+TYPED_TEST_SUITE(SolveSparseTestsAll, MatXFloatNonHalfTypesAllExecs);
 
 TYPED_TEST(SolveSparseTestsAll, SolveCSR) {
   MATX_ENTER_HANDLER();
@@ -155,3 +155,89 @@ TYPED_TEST(SolveSparseTestsAll, SolveCSR) {
 
   MATX_EXIT_HANDLER();
 }
+
+TYPED_TEST(SolveSparseTestsAll, SolveCSRRefactor) {
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  if constexpr (!is_host_executor_v<ExecType>) {
+    GTEST_SKIP();
+  } else {
+    ExecType exec{};
+
+    //
+    // Unsymmetric system with a zero diagonal entry, which forces pivoting,
+    // and long-range couplings that make the ordering matter:
+    //
+    //   A(i, i)     = 4       (except A(5, 5) = 0)
+    //   A(i, i + 1) = -1
+    //   A(i + 1, i) = -2
+    //   A(i, n-1-i) = 1       (anti-diagonal)
+    //
+    const index_t n = 16;
+    auto A = make_tensor<TestType>({n, n});
+    for (index_t i = 0; i < n; i++) {
+      for (index_t j = 0; j < n; j++) {
+        A(i, j) = static_cast<TestType>(0);
+      }
+    }
+    for (index_t i = 0; i < n; i++) {
+      A(i, i) = static_cast<TestType>(i == 5 ? 0 : 4);
+      if (i + 1 < n) {
+        A(i, i + 1) = static_cast<TestType>(-1);
+        A(i + 1, i) = static_cast<TestType>(-2);
+      }
+      A(i, n - 1 - i) = A(i, n - 1 - i) + static_cast<TestType>(1);
+    }
+    auto S =
+        experimental::make_zero_tensor_csr<TestType, int32_t, int32_t>({n, n});
+    (S = dense2sparse(A)).run(exec);
+
+    // Repeated solves (the second reuses the cached factorization), then a
+    // solve after the values of S changed in place.
+    auto X = make_tensor<TestType>({3, n});
+    auto Y = make_tensor<TestType>({3, n});
+    const auto verify = [&]() {
+      for (index_t r = 0; r < 3; r++) {
+        for (index_t i = 0; i < n; i++) {
+          TestType acc = static_cast<TestType>(0);
+          for (index_t j = 0; j < n; j++) {
+            acc += A(i, j) * X(r, j);
+          }
+          if constexpr (is_complex_v<TestType>) {
+            ASSERT_NEAR(acc.real(), Y(r, i).real(), this->thresh);
+            ASSERT_NEAR(acc.imag(), Y(r, i).imag(), this->thresh);
+          } else {
+            ASSERT_NEAR(acc, Y(r, i), this->thresh);
+          }
+        }
+      }
+    };
+    for (int iter = 0; iter < 2; iter++) {
+      for (index_t r = 0; r < 3; r++) {
+        for (index_t i = 0; i < n; i++) {
+          Y(r, i) = static_cast<TestType>((r + 1) * (i % 5) + iter);
+        }
+      }
+      (X = solve(S, Y)).run(exec);
+      exec.sync();
+      verify();
+    }
+
+    TestType *vals = S.Data();
+    for (index_t e = 0; e < S.Nse(); e++) {
+      vals[e] = vals[e] * static_cast<TestType>(2);
+    }
+    for (index_t i = 0; i < n; i++) {
+      for (index_t j = 0; j < n; j++) {
+        A(i, j) = A(i, j) * static_cast<TestType>(2);
+      }
+    }
+    (X = solve(S, Y)).run(exec);
+    exec.sync();
+    verify();
+  }
+
+  MATX_EXIT_HANDLER();
+}
@@ -198,6 +198,105 @@ TYPED_TEST(BasicTensorTestsAll, RefCnt)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(BasicTensorTestsAll, HostMemoryCache)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  // Turn the cache back off even when an assertion below returns early, so later tests
+  // allocate straight from malloc again
+  struct CacheGuard {
+    ~CacheGuard() { matxDisableHostMemoryCache(); }
+  };
+  [[maybe_unused]] CacheGuard guard;
+
+  matxEnableHostMemoryCache();
+  TestType *data;
+  {
+    auto tmp = make_tensor<TestType>({10, 4}, MATX_HOST_MALLOC_MEMORY);
+    data = tmp.Data();
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(data) % 64, 0);
+  }
+
+  // The freed block is cached and handed back for the next allocation of the same size
+  ASSERT_EQ(IsAllocated(data), false);
+  ASSERT_GT(matxMemoryStats.hostCachedBytes.load(), 0);
+  const size_t hits = matxMemoryStats.hostCacheHits.load();
+  {
+    auto tmp = make_tensor<TestType>({10, 4}, MATX_HOST_MALLOC_MEMORY);
+    ASSERT_EQ(tmp.Data(), data);
+    ASSERT_EQ(GetPointerKind(tmp.Data()), MATX_HOST_MALLOC_MEMORY);
+  }
+  ASSERT_EQ(matxMemoryStats.hostCacheHits.load(), hits + 1);
+
+  matxReleaseHostMemoryCache();
+  ASSERT_EQ(matxMemoryStats.hostCachedBytes.load(), 0);
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(BasicTensorTestsAll, Arena)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  Arena arena{1024, MATX_HOST_MALLOC_MEMORY};
+  size_t current, total, max;
+  std::vector<TestType *> ptrs;
+
+  for (int frame = 0; frame < 3; frame++) {
+    auto a = make_tensor<TestType>({10, 4}, arena);
+    auto b = make_tensor<TestType>(cuda::std::array<index_t, 1>{1000}, arena);
+    tensor_t<TestType, 2> c;
+    make_tensor(c, {3, 3}, arena);
+
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(a.Data()) % Arena::ALIGNMENT, 0);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(b.Data()) % Arena::ALIGNMENT, 0);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(c.Data()) % Arena::ALIGNMENT, 0);
+    ASSERT_EQ(IsAllocated(a.Data()), false);
+    ptrs.push_back(a.Data());
+
+    // The first frame overflows, and the reset merges its blocks into one that fits later frames
+    if (frame == 0) {
+      ASSERT_GT(arena.capacity(), 1024);
+    }
+
+    arena.reset();
+    ASSERT_EQ(arena.used(), 0);
+    if (frame == 0) {
+      matxGetMemoryStats(&current, &total, &max);
+    }
+  }
+
+  size_t current2, total2, max2;
+  matxGetMemoryStats(&current2, &total2, &max2);
+  ASSERT_EQ(total, total2);
+  ASSERT_EQ(ptrs[1], ptrs[2]);
+
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(BasicTensorTestsAll, HostNumaPlacement)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  for (const auto &numa : {HostNumaPolicy::Node(0), HostNumaPolicy::Interleave(), HostNumaPolicy::FirstTouch(4)}) {
+    TestType *data;
+    {
+      auto t = make_tensor<TestType>({100, 50}, numa);
+      data = t.Data();
+      ASSERT_EQ(reinterpret_cast<uintptr_t>(data) % 4096, 0);
+      ASSERT_EQ(GetPointerKind(data), MATX_HOST_MALLOC_MEMORY);
+      t(99, 49) = TestType(1);
+      ASSERT_EQ(t(99, 49), TestType(1));
+    }
+    ASSERT_EQ(IsAllocated(data), false);
+  }
+
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(BasicTensorTestsAll, ViewSize)
 {
   MATX_ENTER_HANDLER();
@@ -564,3 +663,56 @@ TYPED_TEST(BasicTensorTestsAll, DLPack)
   MATX_EXIT_HANDLER();
 }
 
+
+TEST(BasicTensorTests, HostHalfConversions)
+{
+  MATX_ENTER_HANDLER();
+
+  // Every fp16 value widens exactly as the CUDA conversion does
+  for (uint32_t b = 0; b < 65536; b++) {
+    __half_raw raw;
+    raw.x = static_cast<unsigned short>(b);
+    const float ref = __half2float(__half(raw));
+    const float f = detail::HostFp16BitsToFloat(static_cast<uint16_t>(b));
+    if (std::isnan(ref)) {
+      ASSERT_TRUE(std::isnan(f));
+    }
+    else {
+      ASSERT_EQ(f, ref);
+    }
+  }
+
+  // Narrowing rounds to nearest even, including denormals and overflow
+  const index_t n = 1003;
+  auto in = make_tensor<float>({n});
+  auto h16 = make_tensor<matxFp16>({n});
+  auto b16 = make_tensor<matxBf16>({n});
+  auto out = make_tensor<float>({n});
+  for (index_t i = 0; i < n; i++) {
+    in(i) = static_cast<float>(i - n / 2) * 0.731f * std::pow(2.0f, static_cast<float>(i % 60 - 30));
+  }
+
+  detail::HostFloatToHalfN(in.Data(), h16.Data(), n);
+  detail::HostFloatToHalfN(in.Data(), b16.Data(), n);
+  for (index_t i = 0; i < n; i++) {
+    ASSERT_EQ(static_cast<__half_raw>(static_cast<__half>(h16(i))).x,
+              static_cast<__half_raw>(__float2half_rn(in(i))).x);
+    ASSERT_EQ(static_cast<__nv_bfloat16_raw>(static_cast<__nv_bfloat16>(b16(i))).x,
+              static_cast<__nv_bfloat16_raw>(__float2bfloat16_rn(in(i))).x);
+  }
+
+  detail::HostHalfToFloatN(h16.Data(), out.Data(), n);
+  for (index_t i = 0; i < n; i++) {
+    ASSERT_EQ(out(i), __half2float(__float2half_rn(in(i))));
+  }
+
+  // Elementwise expressions on the host match the float computation rounded once
+  auto h16b = make_tensor<matxFp16>({n});
+  (h16b = h16 * h16 + h16).run(SingleThreadedHostExecutor{});
+  for (index_t i = 0; i < n; i++) {
+    const float x = static_cast<float>(h16(i));
+    ASSERT_EQ(static_cast<float>(h16b(i)), __half2float(__float2half_rn(__half2float(__float2half_rn(x * x)) + x)));
+  }
+
+  MATX_EXIT_HANDLER();
+}
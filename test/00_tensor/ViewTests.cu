@@ -468,6 +468,55 @@ TYPED_TEST(ViewTestsFloatNonComplexNonHalf, Random)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(ViewTestsFloatNonComplexNonHalf, RandomHostReproducible)
+{
+  MATX_ENTER_HANDLER();
+  {
+    using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+    using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+    if constexpr (!is_host_executor_v<ExecType>) {
+      GTEST_SKIP();
+    }
+    else {
+      // Host generation is counter-based, so the thread count must not change the values
+      index_t count = 37;
+      SingleThreadedHostExecutor single{};
+      tensor_t<TestType, 3> ref({count, count, count});
+      tensor_t<TestType, 3> t3f({count, count, count});
+
+      for (auto dist : {UNIFORM, NORMAL}) {
+        (ref = random<TestType>({count, count, count}, dist, 1234)).run(single);
+        (t3f = random<TestType>({count, count, count}, dist, 1234)).run(this->exec);
+        this->exec.sync();
+
+        for (index_t i = 0; i < count; i++) {
+          for (index_t j = 0; j < count; j++) {
+            for (index_t k = 0; k < count; k++) {
+              ASSERT_EQ(ref(i, j, k), t3f(i, j, k));
+            }
+          }
+        }
+      }
+
+      // A different seed must give a different sequence
+      (t3f = random<TestType>({count, count, count}, UNIFORM, 4321)).run(this->exec);
+      (ref = random<TestType>({count, count, count}, UNIFORM, 1234)).run(single);
+      this->exec.sync();
+      ASSERT_NE(ref(0, 0, 0), t3f(0, 0, 0));
+
+      // Running the same operator again continues the sequence instead of repeating it
+      auto op = (t3f = random<TestType>({count, count, count}, UNIFORM, 1234));
+      op.run(this->exec);
+      (ref = t3f).run(this->exec);
+      op.run(this->exec);
+      this->exec.sync();
+      ASSERT_NE(ref(0, 0, 0), t3f(0, 0, 0));
+    }
+  }
+  MATX_EXIT_HANDLER();
+}
+
 
 
 TYPED_TEST(ViewTestsIntegral, Randomi)
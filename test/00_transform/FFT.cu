@@ -1021,4 +1021,224 @@ TYPED_TEST(FFTTestComplexNonHalfTypesAllExecs, IFFT1D1024C2CShort)
 
   MATX_TEST_ASSERT_COMPARE(this->pb, avo, "a_out", this->thresh);
   MATX_EXIT_HANDLER();
-}
\ No newline at end of file
+}
+
+TYPED_TEST(FFTTestComplexNonHalfTypesAllExecs, FFT1DMixedRadixBatched)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using rtype = typename TestType::value_type;
+  const index_t batches = 3;
+
+  // Radix 2/3/4/5 sizes, a small prime handled directly, and primes that need Bluestein
+  for (const index_t fft_dim : {60, 243, 1000, 77, 97, 1031}) {
+    this->pb->template InitAndRunTVGenerator<TestType>(
+        "00_transforms", "fft_operators", "fft_1d_batched", {batches, fft_dim, fft_dim});
+    tensor_t<TestType, 2> av{{batches, fft_dim}};
+    tensor_t<TestType, 2> avo{{batches, fft_dim}};
+    this->pb->NumpyToTensorView(av, "a_in");
+
+    (avo = fft(av)).run(this->exec);
+    this->exec.sync();
+
+    MATX_TEST_ASSERT_COMPARE(this->pb, avo, "a_out", this->thresh);
+
+    this->pb->template InitAndRunTVGenerator<rtype>(
+        "00_transforms", "fft_operators", "rfft_1d_batched", {batches, fft_dim, fft_dim});
+    tensor_t<rtype, 2> arv{{batches, fft_dim}};
+    tensor_t<TestType, 2> arvo{{batches, fft_dim / 2 + 1}};
+    this->pb->NumpyToTensorView(arv, "a_in");
+
+    (arvo = fft(arv, fft_dim)).run(this->exec);
+    this->exec.sync();
+
+    MATX_TEST_ASSERT_COMPARE(this->pb, arvo, "a_out", this->thresh);
+  }
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(FFTTestComplexNonHalfTypesAllExecs, FFT1DStridedViewC2C)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  const index_t fft_dim = 1024;
+  const index_t cols = 3;
+  this->pb->template InitAndRunTVGenerator<TestType>(
+      "00_transforms", "fft_operators", "fft_1d", {fft_dim, fft_dim});
+
+  tensor_t<TestType, 1> av{{fft_dim}};
+  this->pb->NumpyToTensorView(av, "a_in");
+
+  // Transform down one column of a matrix into a column of another, so both the
+  // input and output have a non-unit stride
+  auto in_mat = make_tensor<TestType>({fft_dim, cols});
+  auto out_mat = make_tensor<TestType>({fft_dim, cols});
+  auto in_col = slice<1>(in_mat, {0, 1}, {matxEnd, matxDropDim});
+  auto out_col = slice<1>(out_mat, {0, 2}, {matxEnd, matxDropDim});
+  (in_col = av).run(this->exec);
+
+  (out_col = fft(in_col)).run(this->exec);
+  this->exec.sync();
+
+  MATX_TEST_ASSERT_COMPARE(this->pb, out_col, "a_out", this->thresh);
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(FFTTestComplexNonHalfTypesAllExecs, FFTOperatorInput)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  const index_t batches = 3;
+  const index_t fft_dim = 1000;
+
+  // An elementwise operator as the input, which host FFTs evaluate block by block
+  this->pb->template InitAndRunTVGenerator<TestType>(
+      "00_transforms", "fft_operators", "fft_1d_batched", {batches, fft_dim, fft_dim});
+  tensor_t<TestType, 2> av{{batches, fft_dim}};
+  tensor_t<TestType, 2> avc{{batches, fft_dim}};
+  tensor_t<TestType, 2> avo{{batches, fft_dim}};
+  this->pb->NumpyToTensorView(av, "a_in");
+  (avc = conj(av)).run(this->exec);
+
+  (avo = fft(conj(avc))).run(this->exec);
+  this->exec.sync();
+  MATX_TEST_ASSERT_COMPARE(this->pb, avo, "a_out", this->thresh);
+
+  // Into a transposed output, which the fused path stores to directly
+  tensor_t<TestType, 2> avt{{fft_dim, batches}};
+  (transpose(avt) = fft(conj(avc))).run(this->exec);
+  this->exec.sync();
+  MATX_TEST_ASSERT_COMPARE(this->pb, transpose(avt), "a_out", this->thresh);
+
+  const index_t fft_dim2[] = {16, 32};
+  this->pb->template InitAndRunTVGenerator<TestType>(
+      "00_transforms", "fft_operators", "fft_2d", {fft_dim2[0], fft_dim2[1]});
+  tensor_t<TestType, 2> a2{{fft_dim2[0], fft_dim2[1]}};
+  tensor_t<TestType, 2> a2c{{fft_dim2[0], fft_dim2[1]}};
+  tensor_t<TestType, 2> a2o{{fft_dim2[0], fft_dim2[1]}};
+  this->pb->NumpyToTensorView(a2, "a_in");
+  (a2c = conj(a2)).run(this->exec);
+
+  (a2o = fft2(conj(a2c))).run(this->exec);
+  this->exec.sync();
+  MATX_TEST_ASSERT_COMPARE(this->pb, a2o, "a_out", this->thresh);
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(FFTTestComplexNonHalfTypesAllExecs, FFTInPlaceReorderedInput)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  const index_t batches = 64;
+  const index_t fft_dim = 1000;
+
+  // An in-place FFT whose input reads the output's rows in reverse order. Enough batches
+  // for several host staging blocks, so every row must be read before any is overwritten.
+  tensor_t<TestType, 2> av{{batches, fft_dim}};
+  tensor_t<TestType, 2> ref{{batches, fft_dim}};
+  (av = random<TestType>(av.Shape(), NORMAL)).run(this->exec);
+  (ref = fft(flipud(av))).run(this->exec);
+  (av = fft(flipud(av))).run(this->exec);
+  this->exec.sync();
+
+  for (index_t b = 0; b < batches; b++) {
+    for (index_t j = 0; j < fft_dim; j++) {
+      EXPECT_TRUE(MatXUtils::MatXTypeCompare(av(b, j), ref(b, j), this->thresh));
+    }
+  }
+
+  const index_t fft_dim2 = 64;
+  tensor_t<TestType, 3> a2{{16, fft_dim2, fft_dim2}};
+  tensor_t<TestType, 3> ref2{{16, fft_dim2, fft_dim2}};
+  (a2 = random<TestType>(a2.Shape(), NORMAL)).run(this->exec);
+  (ref2 = fft2(reverse<0>(a2))).run(this->exec);
+  (a2 = fft2(reverse<0>(a2))).run(this->exec);
+  this->exec.sync();
+
+  for (index_t b = 0; b < a2.Size(0); b++) {
+    for (index_t i = 0; i < fft_dim2; i++) {
+      for (index_t j = 0; j < fft_dim2; j++) {
+        EXPECT_TRUE(MatXUtils::MatXTypeCompare(a2(b, i, j), ref2(b, i, j), this->thresh));
+      }
+    }
+  }
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(FFTTestComplexNonHalfTypesAllExecs, FFT1DPlannerEffortWarmup)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+
+  if constexpr (!is_host_executor_v<ExecType>) {
+    GTEST_SKIP();
+  } else {
+    const index_t fft_dim = 1024;
+    this->pb->template InitAndRunTVGenerator<TestType>(
+        "00_transforms", "fft_operators", "fft_1d", {fft_dim, fft_dim});
+
+    tensor_t<TestType, 1> av{{fft_dim}};
+    tensor_t<TestType, 1> avo{{fft_dim}};
+    this->pb->NumpyToTensorView(av, "a_in");
+
+    // Measuring must not disturb the input of the first transform
+    HostExecParams params{this->exec.GetNumThreads(), FFTWPlannerEffort::MEASURE};
+    HostExecutor<ThreadsMode::SELECT> measure_exec{params};
+    matxFFTWarmup<TestType, 1>({{fft_dim}, {fft_dim / 2}}, measure_exec);
+
+    (avo = fft(av)).run(measure_exec);
+    measure_exec.sync();
+    MATX_TEST_ASSERT_COMPARE(this->pb, avo, "a_out", this->thresh);
+
+    matxSetFFTWPlannerEffort(FFTWPlannerEffort::PATIENT);
+    ASSERT_EQ(matxGetFFTWPlannerEffort(), FFTWPlannerEffort::PATIENT);
+    (avo = fft(av)).run(this->exec);
+    this->exec.sync();
+    matxSetFFTWPlannerEffort(FFTWPlannerEffort::DEFAULT);
+    ASSERT_EQ(matxGetFFTWPlannerEffort(), FFTWPlannerEffort::ESTIMATE);
+    MATX_TEST_ASSERT_COMPARE(this->pb, avo, "a_out", this->thresh);
+
+#ifdef MATX_EN_X86_FFTW
+    const std::string wisdom_file = "matx_fftw_wisdom_test.txt";
+    matxExportFFTWWisdom(wisdom_file);
+    matxImportFFTWWisdom(wisdom_file);
+    std::remove(wisdom_file.c_str());
+#endif
+  }
+  MATX_EXIT_HANDLER();
+}
+
+TYPED_TEST(FFTTestComplexNonHalfTypesAllExecs, FFTPlanCacheStats)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+
+  const index_t fft_dim = 1031;
+  auto av = make_tensor<TestType>({fft_dim});
+  auto avo = make_tensor<TestType>({fft_dim});
+  (av = 1).run(this->exec);
+
+  // The second transform of the same shape reuses the cached plan
+  const auto before = matxGetPlanCacheStats();
+  (avo = fft(av)).run(this->exec);
+  (avo = fft(av)).run(this->exec);
+  this->exec.sync();
+  const auto after = matxGetPlanCacheStats();
+  ASSERT_GE(after.hits, before.hits + 1);
+  ASSERT_GE(after.hits + after.misses, before.hits + before.misses + 2);
+
+  // With room for one plan per type, a second shape evicts the first
+  matxSetPlanCacheCapacity(1);
+  auto ah = slice(av, {0}, {fft_dim / 2});
+  auto aho = slice(avo, {0}, {fft_dim / 2});
+  (aho = fft(ah)).run(this->exec);
+  (avo = fft(av)).run(this->exec);
+  this->exec.sync();
+  const auto evicted = matxGetPlanCacheStats();
+  matxSetPlanCacheCapacity(detail::DEFAULT_CACHE_CAPACITY);
+  ASSERT_GT(evicted.evictions, after.evictions);
+
+  MATX_EXIT_HANDLER();
+}
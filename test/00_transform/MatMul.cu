@@ -137,6 +137,52 @@ TYPED_TEST(MatMulTestFloatTypes, SmallRect)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(MatMulTestFloatTypes, SmallRectTempReuse)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+  if constexpr (!detail::CheckMatMulSupport<ExecType, TestType>() || !is_host_executor_v<ExecType>) {
+    GTEST_SKIP();
+  } else {
+    constexpr index_t m = 4;
+    constexpr index_t k = 8;
+    constexpr index_t n = 16;
+    tensor_t<TestType, 2> a{{m, k}};
+    tensor_t<TestType, 2> b{{k, n}};
+    tensor_t<TestType, 2> c{{m, n}};
+    tensor_t<TestType, 2> ct{{n, m}};
+
+    this->pb->template InitAndRunTVGenerator<TestType>(
+        "00_transforms", "matmul_operators", "run", {m, k, n});
+
+    this->pb->NumpyToTensorView(a, "a");
+    this->pb->NumpyToTensorView(b, "b");
+
+    // The nested matmul's temporary output comes from the executor's pool, so only the
+    // first run allocates
+    size_t current = 0, total = 0, max = 0;
+    for (int i = 0; i < 3; i++) {
+      if (i == 1) {
+        matxGetMemoryStats(&current, &total, &max);
+      }
+      (ct = transpose_matrix(matmul(a, b))).run(this->exec);
+    }
+
+    size_t current2, total2, max2;
+    matxGetMemoryStats(&current2, &total2, &max2);
+    ASSERT_EQ(total, total2);
+    ASSERT_GT(this->exec.GetTempPool().CachedBytes(), 0);
+
+    (c = transpose_matrix(ct)).run(this->exec);
+    MATX_TEST_ASSERT_COMPARE(this->pb, c, "c", this->thresh);
+
+    this->exec.ReleaseTempBuffers();
+    ASSERT_EQ(this->exec.GetTempPool().CachedBytes(), 0);
+  }
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(MatMulTestFloatTypes, SmallRectATranspose)
 {
   MATX_ENTER_HANDLER();
@@ -359,6 +405,35 @@ TYPED_TEST(MatMulTestFloatTypes, MediumRect)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(MatMulTestFloatNonHalfTypes, LargeRectBlocked)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+  if constexpr (!detail::CheckMatMulSupport<ExecType, TestType>()) {
+    GTEST_SKIP();
+  } else {
+    // Sizes that are not multiples of any host GEMM block size and span
+    // several cache blocks in every dimension.
+    constexpr index_t m = 301;
+    constexpr index_t k = 613;
+    constexpr index_t n = 259;
+    tensor_t<TestType, 2> a{{m, k}};
+    tensor_t<TestType, 2> b{{k, n}};
+    tensor_t<TestType, 2> c{{m, n}};
+
+    this->pb->template InitAndRunTVGenerator<TestType>(
+        "00_transforms", "matmul_operators", "run", {m, k, n});
+
+    this->pb->NumpyToTensorView(a, "a");
+    this->pb->NumpyToTensorView(b, "b");
+
+    (c = matmul(a, b)).run(this->exec);
+    MATX_TEST_ASSERT_COMPARE(this->pb, c, "c", this->thresh);
+  }
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(MatMulTestFloatTypes, MediumRectBatched)
 {
   MATX_ENTER_HANDLER();
@@ -393,6 +468,38 @@ TYPED_TEST(MatMulTestFloatTypes, MediumRectBatched)
   MATX_EXIT_HANDLER();
 }
 
+TYPED_TEST(MatMulTestFloatTypes, SmallBatched)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+  if constexpr (!detail::CheckMatMulSupport<ExecType, TestType>()) {
+    GTEST_SKIP();
+  } else {
+    // Many tiny GEMMs, including a partial final group on the host's
+    // batch-interleaved small-matrix path
+    constexpr index_t batches = 37;
+    constexpr index_t m = 4;
+    constexpr index_t k = 6;
+    constexpr index_t n = 3;
+
+    tensor_t<TestType, 3> a{{batches, m, k}};
+    tensor_t<TestType, 3> b{{batches, k, n}};
+    tensor_t<TestType, 3> c{{batches, m, n}};
+
+    this->pb->template InitAndRunTVGenerator<TestType>(
+        "00_transforms", "matmul_operators", "run", {batches, m, k, n});
+
+    this->pb->NumpyToTensorView(a, "a");
+    this->pb->NumpyToTensorView(b, "b");
+
+    (c = matmul(a, b)).run(this->exec);
+
+    MATX_TEST_ASSERT_COMPARE(this->pb, c, "c", this->thresh);
+  }
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(MatMulTestFloatTypes, MediumRectBatched0StrideA)
 {
   MATX_ENTER_HANDLER();
@@ -1011,6 +1118,48 @@ TYPED_TEST(MatMulTestFloatTypes, MatVecRowVector)
 
 
 
+TYPED_TEST(MatMulTestFloatTypes, MatVecStrided)
+{
+  MATX_ENTER_HANDLER();
+  using TestType = cuda::std::tuple_element_t<0, TypeParam>;
+  using ExecType = cuda::std::tuple_element_t<1, TypeParam>;
+  if constexpr (!detail::CheckMatMulSupport<ExecType, TestType>()) {
+    GTEST_SKIP();
+  } else {
+    // Column-major A and non-unit vector strides
+    constexpr index_t m = 128;
+    constexpr index_t k = 256;
+    constexpr index_t n = 1;
+
+    tensor_t<TestType, 2> a{{m, k}};
+    tensor_t<TestType, 2> b{{k, n}};
+    tensor_t<TestType, 2> c{{m, n}};
+    this->pb->template InitAndRunTVGenerator<TestType>(
+        "00_transforms", "matmul_operators", "run", {m, k, n});
+
+    this->pb->NumpyToTensorView(a, "a");
+    this->pb->NumpyToTensorView(b, "b");
+
+    auto at = make_tensor<TestType>({k, m});
+    (at = transpose_matrix(a)).run(this->exec);
+
+    auto b2 = make_tensor<TestType>({k, 2});
+    auto c3 = make_tensor<TestType>({m, 3});
+    (b2 = 0).run(this->exec);
+    (c3 = 0).run(this->exec);
+    auto bs = slice<1>(b2, {0,0}, {matxEnd, matxDropDim});
+    auto cs = slice<1>(c3, {0,0}, {matxEnd, matxDropDim});
+    (bs = slice<1>(b, {0,0}, {matxEnd, matxDropDim})).run(this->exec);
+
+    (cs = matvec(transpose_matrix(at), bs)).run(this->exec);
+
+    this->exec.sync();
+    auto csc = clone<2>(cs, {matxKeepDim, 1});
+    MATX_TEST_ASSERT_COMPARE(this->pb, csc, "c", this->thresh);
+  }
+  MATX_EXIT_HANDLER();
+}
+
 TYPED_TEST(MatMulTestFloatTypes, OuterProduct)
 {
   MATX_ENTER_HANDLER();
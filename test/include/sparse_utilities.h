@@ -0,0 +1,91 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, NVIDIA Corporation
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "matx.h"
+
+namespace matx {
+
+//
+// Helper method to build the COO, CSR and CSC forms of a dense matrix
+// directly on the host, so the sparse kernels can be tested on any
+// executor without relying on dense2sparse.
+//
+template <typename T> auto makeSparseForms(const tensor_t<T, 2> &A) {
+  const index_t m = A.Size(0);
+  const index_t n = A.Size(1);
+  index_t nse = 0;
+  for (index_t i = 0; i < m; i++) {
+    for (index_t j = 0; j < n; j++) {
+      nse += A(i, j) != static_cast<T>(0);
+    }
+  }
+  auto val = make_tensor<T>({nse});
+  auto row = make_tensor<index_t>({nse});
+  auto col = make_tensor<index_t>({nse});
+  auto rowp = make_tensor<index_t>({m + 1});
+  auto cval = make_tensor<T>({nse});
+  auto crow = make_tensor<index_t>({nse});
+  auto colp = make_tensor<index_t>({n + 1});
+  index_t e = 0;
+  for (index_t i = 0; i < m; i++) {
+    rowp(i) = e;
+    for (index_t j = 0; j < n; j++) {
+      if (A(i, j) != static_cast<T>(0)) {
+        val(e) = A(i, j);
+        row(e) = i;
+        col(e) = j;
+        e++;
+      }
+    }
+  }
+  rowp(m) = e;
+  e = 0;
+  for (index_t j = 0; j < n; j++) {
+    colp(j) = e;
+    for (index_t i = 0; i < m; i++) {
+      if (A(i, j) != static_cast<T>(0)) {
+        cval(e) = A(i, j);
+        crow(e) = i;
+        e++;
+      }
+    }
+  }
+  colp(n) = e;
+  return cuda::std::make_tuple(
+      experimental::make_tensor_coo(val, row, col, {m, n}),
+      experimental::make_tensor_csr(val, rowp, col, {m, n}),
+      experimental::make_tensor_csc(cval, colp, crow, {m, n}));
+}
+
+} // end namespace matx